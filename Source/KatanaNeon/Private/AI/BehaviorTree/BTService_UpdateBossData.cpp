@@ -9,16 +9,21 @@
 #include "BehaviorTree/Blackboard/BlackboardKeyType_Bool.h"
 #include "AIController.h"
 #include "AbilitySystemComponent.h"
-#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemGlobals.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "GAS/Tags/KNStatsTags.h"
+#include "Misc/ScopeExit.h"
 
 #pragma region 기본 생성자 및 초기화 구현
 UBTService_UpdateBossData::UBTService_UpdateBossData()
 {
     NodeName = TEXT("보스 데이터 갱신");
-    // 하드코딩 지양: 틱 간격은 에디터 디테일에서 조정 가능하도록 기본값만 제공합니다.
+    // 실제 점검 간격은 TickNode가 거리 구간 경계까지의 거리로 매번 다시 예약합니다.
     Interval = 0.1f;
-    RandomDeviation = 0.05f;
+    RandomDeviation = 0.0f;
+    bCallTickOnSearchStart = true;
+    bNotifyBecomeRelevant = true;
+    bNotifyCeaseRelevant = true;
 
     // 타입 안전 필터 — 에디터 드롭다운에서 올바른 키 타입만 표시됩니다.
     TargetPlayerKey.AddObjectFilter(
@@ -44,10 +49,83 @@ void UBTService_UpdateBossData::InitializeFromAsset(UBehaviorTree& Asset)
         DistToPlayerKey.ResolveSelectedKey(*BBAsset);
         IsStunnedKey.ResolveSelectedKey(*BBAsset);
     }
+
+    // 경계는 순서와 무관하게 정렬하고, 틱에서는 제곱 거리만 비교하도록 미리 제곱해 둡니다.
+    BandEdges = { MeleeRange, RetreatRange, EngageRange };
+    BandEdges.Sort();
+
+    OuterEdgesSq.Reset();
+    InnerEdgesSq.Reset();
+    for (const float Edge : BandEdges)
+    {
+        OuterEdgesSq.Add(FMath::Square(Edge + BandHysteresis));
+        InnerEdgesSq.Add(FMath::Square(FMath::Max(Edge - BandHysteresis, 0.0f)));
+    }
 }
 #pragma endregion 기본 생성자 및 초기화 구현
 
 #pragma region 서비스 오버라이드 구현
+uint16 UBTService_UpdateBossData::GetInstanceMemorySize() const
+{
+    return sizeof(FBTUpdateBossDataMemory);
+}
+
+void UBTService_UpdateBossData::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+    InitializeNodeMemory<FBTUpdateBossDataMemory>(NodeMemory, InitType);
+}
+
+void UBTService_UpdateBossData::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+    CleanupNodeMemory<FBTUpdateBossDataMemory>(NodeMemory, CleanupType);
+}
+
+void UBTService_UpdateBossData::OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+    Super::OnBecomeRelevant(OwnerComp, NodeMemory);
+
+    FBTUpdateBossDataMemory* Memory = CastInstanceNodeMemory<FBTUpdateBossDataMemory>(NodeMemory);
+    Memory->Band = INDEX_NONE;
+    Memory->LastTarget.Reset();
+
+    UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
+    const AAIController* Controller = OwnerComp.GetAIOwner();
+    UAbilitySystemComponent* ASC = Controller
+        ? UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Controller->GetPawn())
+        : nullptr;
+    if (!BB || !ASC) return;
+
+    // 그로기 태그 증감 시에만 기록합니다. (서비스 노드는 트리 인스턴스 간 공유되므로 블랙보드를 약참조로 묶음)
+    const FBlackboard::FKey StunnedKeyID = IsStunnedKey.GetSelectedKeyID();
+    Memory->ASC = ASC;
+    Memory->GroggyHandle = ASC->RegisterGameplayTagEvent(
+        KatanaNeon::State::Combat::Groggy,
+        EGameplayTagEventType::NewOrRemoved)
+        .AddWeakLambda(BB, [BB, StunnedKeyID](const FGameplayTag, int32 NewCount)
+        {
+            BB->SetValue<UBlackboardKeyType_Bool>(StunnedKeyID, NewCount > 0);
+        });
+
+    BB->SetValue<UBlackboardKeyType_Bool>(
+        StunnedKeyID, UKNAbilitySystemComponent::HasState(ASC, EKNStateTag::Groggy));
+}
+
+void UBTService_UpdateBossData::OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+    FBTUpdateBossDataMemory* Memory = CastInstanceNodeMemory<FBTUpdateBossDataMemory>(NodeMemory);
+    if (UAbilitySystemComponent* ASC = Memory->ASC.Get())
+    {
+        ASC->RegisterGameplayTagEvent(
+            KatanaNeon::State::Combat::Groggy,
+            EGameplayTagEventType::NewOrRemoved)
+            .Remove(Memory->GroggyHandle);
+    }
+    Memory->ASC.Reset();
+    Memory->GroggyHandle.Reset();
+
+    Super::OnCeaseRelevant(OwnerComp, NodeMemory);
+}
+
 void UBTService_UpdateBossData::TickNode(
     UBehaviorTreeComponent& OwnerComp,
     uint8* NodeMemory,
@@ -55,35 +133,76 @@ void UBTService_UpdateBossData::TickNode(
 {
     Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
 
+    float NextInterval = MaxCheckInterval;
+    ON_SCOPE_EXIT
+    {
+        SetNextTickTime(NodeMemory, NextInterval);
+    };
+
     UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
     if (!BB) return;
 
     const AAIController* Controller = OwnerComp.GetAIOwner();
-    if (!Controller) return;
-
-    const APawn* Boss = Controller->GetPawn();
+    const APawn* Boss = Controller ? Controller->GetPawn() : nullptr;
     if (!Boss) return;
 
-    // 플레이어 거리 갱신
+    FBTUpdateBossDataMemory* Memory = CastInstanceNodeMemory<FBTUpdateBossDataMemory>(NodeMemory);
+
+    // 대기 상태(대상 없음): 구간만 초기화하고 최대 간격으로 잠듭니다.
     const AActor* Target = Cast<AActor>(
         BB->GetValue<UBlackboardKeyType_Object>(TargetPlayerKey.GetSelectedKeyID()));
+    if (!Target)
+    {
+        Memory->Band = INDEX_NONE;
+        Memory->LastTarget.Reset();
+        return;
+    }
 
-    if (Target)
+    if (Memory->LastTarget.Get() != Target)
     {
-        const float Dist = FVector::Dist(
-            Boss->GetActorLocation(), Target->GetActorLocation());
-        BB->SetValue<UBlackboardKeyType_Float>(DistToPlayerKey.GetSelectedKeyID(), Dist);
+        Memory->LastTarget = Target;
+        Memory->Band = INDEX_NONE;
     }
 
-    // 그로기 태그 확인 → bIsStunned 갱신
-    if (const UAbilitySystemComponent* ASC =
-        UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(
-            const_cast<APawn*>(Boss)))
+    const float DistSq = FVector::DistSquared(Boss->GetActorLocation(), Target->GetActorLocation());
+    const int32 Band = ComputeBand(DistSq, Memory->Band);
+    const float Dist = FMath::Sqrt(DistSq);
+
+    // 구간이 바뀐 경우에만 기록하여 데코레이터 재평가(옵저버 통지)를 실제 변화로 제한합니다.
+    if (Band != Memory->Band)
     {
-        const bool bStunned =
-            ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::Groggy);
-        BB->SetValue<UBlackboardKeyType_Bool>(
-            IsStunnedKey.GetSelectedKeyID(), bStunned);
+        Memory->Band = Band;
+        BB->SetValue<UBlackboardKeyType_Float>(DistToPlayerKey.GetSelectedKeyID(), Dist);
     }
+
+    NextInterval = ComputeNextInterval(Dist);
 }
 #pragma endregion 서비스 오버라이드 구현
+
+#pragma region 내부 헬퍼 함수 구현
+int32 UBTService_UpdateBossData::ComputeBand(float DistSq, int32 Current) const
+{
+    int32 Band = 0;
+    for (int32 i = 0; i < BandEdges.Num(); ++i)
+    {
+        // 경계 i의 바깥에 있던 중이면 안쪽 여유 경계, 안쪽에 있던 중이면 바깥쪽 여유 경계를 넘어야 바뀝니다.
+        const float EdgeSq = Current == INDEX_NONE
+            ? FMath::Square(BandEdges[i])
+            : (Current > i ? InnerEdgesSq[i] : OuterEdgesSq[i]);
+        if (DistSq <= EdgeSq) break;
+        Band = i + 1;
+    }
+    return Band;
+}
+
+float UBTService_UpdateBossData::ComputeNextInterval(float Dist) const
+{
+    float NearestGap = TNumericLimits<float>::Max();
+    for (const float Edge : BandEdges)
+    {
+        NearestGap = FMath::Min(NearestGap, FMath::Abs(Dist - Edge));
+    }
+
+    return FMath::Clamp(NearestGap / MaxClosingSpeed, MinCheckInterval, MaxCheckInterval);
+}
+#pragma endregion 내부 헬퍼 함수 구현
@@ -4,6 +4,7 @@
 #include "AI/BehaviorTree/BTTask_BossPhaseAction.h"
 #include "AIController.h"
 #include "AbilitySystemComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "GameFramework/Character.h"
 #include "GAS/Tags/KNStatsTags.h"
@@ -32,7 +33,7 @@ EBTNodeResult::Type UBTTask_BossPhaseAction::ExecuteTask(
     if (!ASC) return EBTNodeResult::Failed;
 
     // 1. 전환 중 피격 방지를 위해 무적 태그 부여
-    ASC->AddLooseGameplayTag(KatanaNeon::State::Combat::Invincible);
+    UKNAbilitySystemComponent::AddState(ASC, EKNStateTag::Invincible);
 
     // 2. 전환 몽타주 재생 (nullptr이면 연출 없이 즉시 진행)
     if (PhaseTransitionMontage)
@@ -47,10 +48,7 @@ EBTNodeResult::Type UBTTask_BossPhaseAction::ExecuteTask(
         TimerHandle,
         FTimerDelegate::CreateWeakLambda(BossChar, [ASC]()
             {
-                if (ASC && ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::Invincible))
-                {
-                    ASC->RemoveLooseGameplayTag(KatanaNeon::State::Combat::Invincible);
-                }
+                UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::Invincible);
             }),
         InvincibleDuration,
         false);
@@ -2,10 +2,7 @@
 
 
 #include "Animation/Notifies/KNAnimNotifyState_WeaponTrail.h"
-#include "NiagaraFunctionLibrary.h"
-#include "NiagaraComponent.h"
 #include "Components/SkeletalMeshComponent.h"
-#include "Components/StaticMeshComponent.h"
 #include "Characters/Player/KNPlayerCharacter.h"
 
 #pragma region 노티파이 오버라이드 구현
@@ -17,72 +14,13 @@ void UKNAnimNotifyState_WeaponTrail::NotifyBegin(
 {
     Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 
-    // 이전 콤보의 Trail이 잔존할 경우 먼저 정리합니다.
-    // (두 번째 콤보에서 Trail이 안 나오는 버그 방지)
-    if (UNiagaraComponent* Root = SpawnedTrailRoot.Get())
-    {
-        Root->Deactivate();
-        SpawnedTrailRoot = nullptr;
-    }
-    if (UNiagaraComponent* Tip = SpawnedTrailTip.Get())
-    {
-        Tip->Deactivate();
-        SpawnedTrailTip = nullptr;
-    }
-
-    if (!MeshComp || !TrailVFX) return;
+    if (!MeshComp) return;
 
-    // 최적화: FindComponentByClass O(N) 배제 → GetKatanaMesh() O(1) Getter 사용
-    AKNPlayerCharacter* Player = Cast<AKNPlayerCharacter>(MeshComp->GetOwner());
-    if (!Player) return;
-
-    UStaticMeshComponent* KatanaMesh = Player->GetKatanaMesh();
-    if (!KatanaMesh) return;
-
-    // 소켓 존재 여부 사전 검사
-    if (!KatanaMesh->DoesSocketExist(FirstSocketName) ||
-        !KatanaMesh->DoesSocketExist(SecondSocketName))
+    // 궤적 컴포넌트와 재생 상태는 캐릭터가 소유하므로 여기서는 방출만 요청합니다.
+    if (AKNPlayerCharacter* Player = Cast<AKNPlayerCharacter>(MeshComp->GetOwner()))
     {
-        UE_LOG(LogTemp, Warning,
-            TEXT("[WeaponTrail] 소켓을 찾을 수 없습니다. First: %s / Second: %s"),
-            *FirstSocketName.ToString(), *SecondSocketName.ToString());
-        return;
+        Player->BeginWeaponTrail(TrailVFX, EnchantSize);
     }
-
-    // 코등이 소켓에 Trail 스폰
-    UNiagaraComponent* TrailRoot = UNiagaraFunctionLibrary::SpawnSystemAttached(
-        TrailVFX,
-        KatanaMesh,
-        FirstSocketName,
-        FVector::ZeroVector,
-        FRotator::ZeroRotator,
-        EAttachLocation::SnapToTarget,
-        /*bAutoDestroy=*/false);
-
-    // 칼끝 소켓에 Trail 스폰
-    UNiagaraComponent* TrailTip = UNiagaraFunctionLibrary::SpawnSystemAttached(
-        TrailVFX,
-        KatanaMesh,
-        SecondSocketName,
-        FVector::ZeroVector,
-        FRotator::ZeroRotator,
-        EAttachLocation::SnapToTarget,
-        /*bAutoDestroy=*/false);
-
-    // Niagara 크기 파라미터 전달
-    if (TrailRoot)
-    {
-        TrailRoot->SetFloatParameter(TEXT("_EnchantSize"), EnchantSize);
-        TrailRoot->ResetSystem();
-    }
-    if (TrailTip)
-    {
-        TrailTip->SetFloatParameter(TEXT("_EnchantSize"), EnchantSize);
-        TrailTip->ResetSystem();
-    }
-
-    SpawnedTrailRoot = TrailRoot;
-    SpawnedTrailTip = TrailTip;
 }
 
 void UKNAnimNotifyState_WeaponTrail::NotifyEnd(
@@ -90,18 +28,14 @@ void UKNAnimNotifyState_WeaponTrail::NotifyEnd(
     UAnimSequenceBase* Animation,
     const FAnimNotifyEventReference& EventReference)
 {
-    // 파티클이 자연스럽게 사그라들도록 Destroy가 아닌 Deactivate 사용
-    if (UNiagaraComponent* Root = SpawnedTrailRoot.Get())
-    {
-        Root->Deactivate();
-        SpawnedTrailRoot = nullptr;
-    }
-    if (UNiagaraComponent* Tip = SpawnedTrailTip.Get())
+    if (MeshComp)
     {
-        Tip->Deactivate();
-        SpawnedTrailTip = nullptr;
+        if (AKNPlayerCharacter* Player = Cast<AKNPlayerCharacter>(MeshComp->GetOwner()))
+        {
+            Player->EndWeaponTrail();
+        }
     }
 
     Super::NotifyEnd(MeshComp, Animation, EventReference);
 }
-#pragma endregion 노티파이 오버라이드 구현
\ No newline at end of file
+#pragma endregion 노티파이 오버라이드 구현
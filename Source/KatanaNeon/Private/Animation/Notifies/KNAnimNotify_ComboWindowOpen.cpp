@@ -3,8 +3,7 @@
 
 #include "Animation/Notifies/KNAnimNotify_ComboWindowOpen.h"
 #include "Components/SkeletalMeshComponent.h"
-#include "AbilitySystemBlueprintLibrary.h"
-#include "AbilitySystemComponent.h"
+#include "Characters/Base/KNCharacterBase.h"
 #include "GAS/Abilities/KNAbilityComboAttack.h"
 #include "GAS/Tags/KNStatsTags.h"
 
@@ -15,27 +14,15 @@ void UKNAnimNotify_ComboWindowOpen::Notify(USkeletalMeshComponent* MeshComp, UAn
 
     if (!MeshComp) return;
 
-    UAbilitySystemComponent* ASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(MeshComp->GetOwner());
-    if (!ASC) return;
+    // 레지스트리 O(1) 조회: 스펙 배열 생성과 인스턴스 선형 탐색을 제거했습니다.
+    const AKNCharacterBase* Character = Cast<AKNCharacterBase>(MeshComp->GetOwner());
+    if (!Character) return;
 
-    TArray<FGameplayAbilitySpec*> Specs;
-    ASC->GetActivatableGameplayAbilitySpecsByAllMatchingTags(
-        FGameplayTagContainer(KatanaNeon::Ability::Combat::Attack),
-        Specs, false);
-
-    for (FGameplayAbilitySpec* Spec : Specs)
+    if (UKNAbilityComboAttack* Ability =
+        Character->GetAbilityRegistry().GetActiveInstance<UKNAbilityComboAttack>(KatanaNeon::Ability::Combat::Attack))
     {
-        if (!Spec || !Spec->IsActive()) continue;
-
-        for (UGameplayAbility* Instance : Spec->GetAbilityInstances())
-        {
-            if (UKNAbilityComboAttack* ComboAbility = Cast<UKNAbilityComboAttack>(Instance))
-            {
-                // 어빌리티 내부에 구현된 OpenComboWindow()를 직접 호출 (선입력 큐 처리 진입점)
-                ComboAbility->OpenComboWindow();
-                return;
-            }
-        }
+        // 어빌리티 내부에 구현된 OpenComboWindow()를 직접 호출 (선입력 큐 처리 진입점)
+        Ability->OpenComboWindow();
     }
 }
 #pragma endregion 노티파이 구현
\ No newline at end of file
@@ -3,8 +3,7 @@
 
 #include "Animation/Notifies/KNAnimNotify_SlashRelease.h"
 #include "Components/SkeletalMeshComponent.h"
-#include "AbilitySystemBlueprintLibrary.h"
-#include "AbilitySystemComponent.h"
+#include "Characters/Base/KNCharacterBase.h"
 #include "GAS/Abilities/KNAbilityOverclockLv2.h"
 #include "GAS/Tags/KNStatsTags.h"
 
@@ -15,26 +14,15 @@ void UKNAnimNotify_SlashRelease::Notify(USkeletalMeshComponent* MeshComp,
     Super::Notify(MeshComp, Animation, EventReference);
     if (!MeshComp) return;
 
-    UAbilitySystemComponent* ASC =
-        UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(MeshComp->GetOwner());
-    if (!ASC) return;
+    // 레지스트리 O(1) 조회: 스펙 배열 생성과 인스턴스 선형 탐색을 제거했습니다.
+    const AKNCharacterBase* Character = Cast<AKNCharacterBase>(MeshComp->GetOwner());
+    if (!Character) return;
 
-    // KNAnimNotify_HitboxOpen과 동일한 패턴 — ASC에서 활성 인스턴스 직접 탐색
-    TArray<FGameplayAbilitySpec*> Specs;
-    ASC->GetActivatableGameplayAbilitySpecsByAllMatchingTags(
-        FGameplayTagContainer(KatanaNeon::Ability::Overclock::Lv2),
-        Specs, false);
-
-    for (FGameplayAbilitySpec* Spec : Specs)
+    if (UKNAbilityOverclockLv2* Ability =
+        Character->GetAbilityRegistry().GetActiveInstance<UKNAbilityOverclockLv2>(KatanaNeon::Ability::Overclock::Lv2))
     {
-        if (!Spec || !Spec->IsActive()) continue;
-
-        UGameplayAbility* Instance = Spec->GetPrimaryInstance();
-        if (UKNAbilityOverclockLv2* Lv2Ability = Cast<UKNAbilityOverclockLv2>(Instance))
-        {
-            Lv2Ability->OnSlashReleaseNotify();
-            return;
-        }
+        // 참격파 발사 시점 전달
+        Ability->OnSlashReleaseNotify();
     }
 }
 #pragma endregion 노티파이 구현
\ No newline at end of file
@@ -3,6 +3,10 @@
 
 #include "Characters/AIUnit/KNEnemyMelee.h"
 #include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "GAS/Effects/KNDamageEffect.h"
+#include "Framework/System/KNHitQueueSubsystem.h"
+#include "Framework/System/KNCollisionChannels.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Data/Structs/KNEnemyStatTable.h"
 
@@ -15,6 +19,8 @@ AKNEnemyMelee::AKNEnemyMelee()
         GetCharacterMovement()->bOrientRotationToMovement = true;
         GetCharacterMovement()->RotationRate = FRotator(0.0f, 720.0f, 0.0f);
     }
+
+    MeleeDamageGEClass = UKNDamageEffect::StaticClass();
 }
 
 void AKNEnemyMelee::BeginPlay()
@@ -41,33 +47,78 @@ void AKNEnemyMelee::PerformMeleeAttack()
 
 void AKNEnemyMelee::ActivateMeleeHitbox()
 {
-    if (!AbilitySystemComponent) return;
+    if (!AbilitySystemComponent || !MeleeDamageGEClass) return;
 
-    // 공격 사거리 내의 플레이어를 구체 오버랩으로 감지합니다.
-    TArray<FOverlapResult> Overlaps;
+    // 공격 사거리 내의 플레이어를 구체 오버랩으로 감지합니다. EnemyAttack 채널은 플레이어 허트박스만 응답합니다.
     const FCollisionShape AttackSphere =
         FCollisionShape::MakeSphere(CachedEnemyStat.AttackRange);
+    const FVector AttackCenter =
+        GetActorLocation() + GetActorForwardVector() * (CachedEnemyStat.AttackRange * 0.5f);
+
+    if (bUseAsyncMeleeQuery)
+    {
+        // 예약만 하고 반환합니다. 결과는 다음 프레임 OnAsyncMeleeOverlapCompleted로 들어옵니다.
+        const FOverlapDelegate OverlapDelegate =
+            FOverlapDelegate::CreateUObject(this, &AKNEnemyMelee::OnAsyncMeleeOverlapCompleted);
+
+        GetWorld()->AsyncOverlapByChannel(
+            AttackCenter,
+            FQuat::Identity,
+            KatanaNeon::Collision::EnemyAttack,
+            AttackSphere,
+            FCollisionQueryParams::DefaultQueryParam,
+            FCollisionResponseParams::DefaultResponseParam,
+            &OverlapDelegate);
+        return;
+    }
 
+    TArray<FOverlapResult> Overlaps;
     GetWorld()->OverlapMultiByChannel(
         Overlaps,
-        GetActorLocation() + GetActorForwardVector() * (CachedEnemyStat.AttackRange * 0.5f),
+        AttackCenter,
         FQuat::Identity,
-        ECollisionChannel::ECC_Pawn,
+        KatanaNeon::Collision::EnemyAttack,
         AttackSphere);
 
+    ResolveMeleeOverlaps(Overlaps);
+}
+
+void AKNEnemyMelee::ResolveMeleeOverlaps(TConstArrayView<FOverlapResult> Overlaps)
+{
+    UKNHitQueueSubsystem* HitQueue = UKNHitQueueSubsystem::Get(this);
+    if (!HitQueue || !AbilitySystemComponent) return;
+
+    // 한 액터의 여러 컴포넌트가 겹쳐도 데미지는 1회만 등록합니다.
+    TArray<const AActor*, TInlineAllocator<4>> HitActors;
+
     for (const FOverlapResult& Overlap : Overlaps)
     {
-        if (Overlap.GetActor() == this) continue;
+        AActor* HitActor = Overlap.GetActor();
+        if (!HitActor || HitActor == this || HitActors.Contains(HitActor)) continue;
+        HitActors.Add(HitActor);
 
         if (UAbilitySystemComponent* TargetASC =
-            Overlap.GetActor()->FindComponentByClass<UAbilitySystemComponent>())
+            UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(HitActor))
         {
-            // TODO: 데미지 GE 클래스를 에디터에서 할당 후 SetByCaller로 전달
-            // FGameplayEffectSpecHandle DmgSpec = ...
-            // TargetASC->ApplyGameplayEffectSpecToTarget(...);
+            FKNHitRecord Record;
+            Record.SourceASC = AbilitySystemComponent;
+            Record.TargetASC = TargetASC;
+            Record.DamageGEClass = MeleeDamageGEClass;
+            Record.BaseDamage = CachedEnemyStat.AttackDamage;
+            Record.Instigator = this;
+            Record.EffectCauser = this;
+            HitQueue->Enqueue(MoveTemp(Record));
         }
     }
 }
+
+void AKNEnemyMelee::OnAsyncMeleeOverlapCompleted(const FTraceHandle& TraceHandle, FOverlapDatum& OverlapDatum)
+{
+    // 요청 이후 제거 중이라면 결과를 버립니다.
+    if (IsActorBeingDestroyed()) return;
+
+    ResolveMeleeOverlaps(OverlapDatum.OutOverlaps);
+}
 #pragma endregion 근접 공격 구현 끝
 
 #pragma region 돌진 공격 구현
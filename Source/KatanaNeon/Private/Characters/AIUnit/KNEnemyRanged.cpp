@@ -2,11 +2,16 @@
 
 
 #include "Characters/AIUnit/KNEnemyRanged.h"
+#include "Framework/System/KNTimeDilationSubsystem.h"
+#include "Framework/System/KNProjectileSubsystem.h"
+#include "Framework/System/KNActorPoolSubsystem.h"
+#include "GAS/Effects/KNDamageEffect.h"
 
 
 #pragma region 기본 생성자 및 초기화 구현
 AKNEnemyRanged::AKNEnemyRanged()
 {
+    ProjectileDamageGEClass = UKNDamageEffect::StaticClass();
 }
 
 void AKNEnemyRanged::BeginPlay()
@@ -21,13 +26,23 @@ void AKNEnemyRanged::BeginPlay()
     {
         CachedRangedStat = *RangedRow;
     }
+
+    // 액터 경로에서는 발사체를 스폰 시점에 풀에 미리 채워 첫 사격 히치를 없앱니다.
+    if (!bUseProjectileManager)
+    {
+        if (UKNActorPoolSubsystem* Pool = UKNActorPoolSubsystem::Get(this))
+        {
+            Pool->Prewarm(ProjectileClass, CachedRangedStat.ProjectilePoolSize);
+        }
+    }
 }
 #pragma endregion 기본 생성자 및 초기화 구현
 
 #pragma region 원거리 공격 구현
 void AKNEnemyRanged::FireProjectile(const FVector& TargetLocation)
 {
-    if (!ProjectileClass)
+    UKNProjectileSubsystem* Projectiles = bUseProjectileManager ? UKNProjectileSubsystem::Get(this) : nullptr;
+    if (!Projectiles && !ProjectileClass)
     {
         UE_LOG(LogTemp, Warning,
             TEXT("[KNEnemyRanged] %s : ProjectileClass 미할당."), *GetName());
@@ -36,18 +51,51 @@ void AKNEnemyRanged::FireProjectile(const FVector& TargetLocation)
 
     BroadcastAttackWarning(); // 발사 직전 저스트 회피 판정 알림
 
-    // 총구 위치에서 목표 방향으로 발사체 스폰
+    // 총구 위치에서 목표 방향으로 발사
     const FVector MuzzleLocation = GetMesh()->GetSocketLocation(FName("MuzzleSocket"));
-    const FRotator FireRotation =
-        (TargetLocation - MuzzleLocation).GetSafeNormal().Rotation();
+    const FVector FireDirection = (TargetLocation - MuzzleLocation).GetSafeNormal();
+
+    // ── 관리형 발사체: 액터 스폰 없이 서브시스템 배열에 1발 추가 ──
+    if (Projectiles)
+    {
+        FKNProjectileLaunchParams Params;
+        Params.Location = MuzzleLocation;
+        Params.Velocity = FireDirection * CachedRangedStat.ProjectileSpeed;
+        Params.LifeTime = CachedRangedStat.ProjectileLifeSpan;
+        Params.Shape = FCollisionShape::MakeSphere(CachedRangedStat.ProjectileCollisionRadius);
+        Params.Team = EKNTimeTeam::Enemy;
+        Params.Owner = this;
+        Params.SourceASC = AbilitySystemComponent;
+        Params.DamageGEClass = ProjectileDamageGEClass;
+        Params.BaseDamage = CachedEnemyStat.AttackDamage;
+        Params.ProxySystem = ProjectileFX;
+        Projectiles->Launch(Params);
+        return;
+    }
 
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.Owner = this;
-    SpawnParams.Instigator = GetInstigator();
-    SpawnParams.SpawnCollisionHandlingOverride =
-        ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+    // IKNPooledActor를 구현한 발사체 클래스는 풀에서 재사용하고, 그 외에는 매번 스폰합니다.
+    const FTransform MuzzleTransform(FireDirection.Rotation(), MuzzleLocation);
+    UKNActorPoolSubsystem* Pool = UKNActorPoolSubsystem::Get(this);
+    AActor* Projectile = Pool ? Pool->AcquireDeferred(ProjectileClass, MuzzleTransform, this, GetInstigator()) : nullptr;
+    if (Projectile)
+    {
+        Pool->FinishAcquire(Projectile);
+    }
+    else
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Owner = this;
+        SpawnParams.Instigator = GetInstigator();
+        SpawnParams.SpawnCollisionHandlingOverride =
+            ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
-    GetWorld()->SpawnActor<AActor>(
-        ProjectileClass, MuzzleLocation, FireRotation, SpawnParams);
+        Projectile = GetWorld()->SpawnActor<AActor>(ProjectileClass, MuzzleTransform, SpawnParams);
+    }
+
+    // 적 발사체도 적 진영으로 등록하여 진영 레이어와 시간 정지(틱 정지)를 함께 받습니다.
+    if (UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this))
+    {
+        TimeDilation->RegisterActor(Projectile, EKNTimeTeam::Enemy, EKNTimeBody::Projectile);
+    }
 }
 #pragma endregion 원거리 공격 구현
\ No newline at end of file
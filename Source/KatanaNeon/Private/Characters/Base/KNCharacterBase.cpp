@@ -3,10 +3,12 @@
 
 #include "Characters/Base/KNCharacterBase.h"
 #include "AbilitySystemComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "Abilities/GameplayAbility.h"
 #include "Components/CapsuleComponent.h"
 #include "GAS/Attributes/KNAttributeSet.h"
 #include "GAS/Tags/KNStatsTags.h"
+#include "Framework/System/KNCollisionChannels.h"
 
 #pragma region 기본 생성자 및 초기화 구현
 AKNCharacterBase::AKNCharacterBase()
@@ -14,27 +16,65 @@ AKNCharacterBase::AKNCharacterBase()
     // 매 프레임 Tick 업데이트를 기본적으로 비활성화하여 액션 게임의 CPU 연산을 최적화합니다.
     PrimaryActorTick.bCanEverTick = false;
 
-    // 1. 능력 시스템 컴포넌트(ASC) 생성
-    AbilitySystemComponent = CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
+    // 1. 능력 시스템 컴포넌트(ASC) 생성 (State 태그 비트셋 미러 포함)
+    AbilitySystemComponent = CreateDefaultSubobject<UKNAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
 
     // 2. 핵심 스탯 데이터 셋 생성
     AttributeSet = CreateDefaultSubobject<UKNAttributeSet>(TEXT("AttributeSet"));
+
+    // 3. 피격 판정 캡슐 — 기본은 적 프로필이며 플레이어 생성자에서 덮어씁니다.
+    HurtboxComponent = CreateDefaultSubobject<UCapsuleComponent>(TEXT("HurtboxComponent"));
+    HurtboxComponent->SetupAttachment(GetCapsuleComponent());
+    HurtboxComponent->SetCollisionProfileName(KatanaNeon::Collision::Profile::EnemyHurtbox);
+    HurtboxComponent->SetCanEverAffectNavigation(false);
+    HurtboxComponent->CanCharacterStepUpOn = ECB_No;
 }
 
 void AKNCharacterBase::BeginPlay()
 {
     Super::BeginPlay();
 
+    // 블루프린트에서 이동 캡슐 크기를 바꿔도 피격 판정이 따라가도록 여기서 맞춥니다.
+    if (HurtboxComponent)
+    {
+        if (const UCapsuleComponent* CapsuleComp = GetCapsuleComponent())
+        {
+            HurtboxComponent->SetCapsuleSize(
+                CapsuleComp->GetUnscaledCapsuleRadius(),
+                CapsuleComp->GetUnscaledCapsuleHalfHeight());
+        }
+    }
+
+    if (UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this))
+    {
+        TimeDilation->RegisterActor(this, TimeTeam);
+    }
+
     // 싱글 플레이어 게임이므로 BeginPlay에서 즉시 GAS를 초기화합니다.
     if (ensure(AbilitySystemComponent))
     {
         // 액터가 시스템의 소유자(Owner)이자 화신(Avatar)임을 엔진에 명시적으로 알립니다.
         AbilitySystemComponent->InitAbilityActorInfo(this, this);
 
+        // 어빌리티 부여 전에 레지스트리를 ASC에 연결해야 부여 직후 항목이 채워집니다.
+        AbilityRegistry.Bind(AbilitySystemComponent);
+
         // 등록된 기본 어빌리티들(점프, 기본 공격 등)을 부여합니다.
         GiveDefaultAbilities();
     }
 }
+
+void AKNCharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    AbilityRegistry.Unbind();
+
+    if (UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this))
+    {
+        TimeDilation->UnregisterActor(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
 #pragma endregion 기본 생성자 및 초기화 구현
 
 #pragma region 캐릭터 상태 관리 구현
@@ -44,10 +84,7 @@ void AKNCharacterBase::Landed(const FHitResult& Hit)
 
     if (UAbilitySystemComponent* ASC = GetAbilitySystemComponent())
     {
-        if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Movement::DoubleJumped))
-        {
-            ASC->RemoveLooseGameplayTag(KatanaNeon::State::Movement::DoubleJumped);
-        }
+        UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::DoubleJumped);
     }
 }
 #pragma endregion 캐릭터 상태 관리 구현
@@ -62,7 +99,13 @@ UAbilitySystemComponent* AKNCharacterBase::GetAbilitySystemComponent() const
 #pragma region 사망 처리 구현
 void AKNCharacterBase::Die()
 {
-    // 중복 사망 이벤트를 방지하기 위해 캡슐과 메시의 콜리전을 비활성화합니다.
+    // 중복 사망 이벤트를 방지하기 위해 캡슐, 피격 판정, 메시의 콜리전을 비활성화합니다.
+    // 허트박스가 꺼지면 이후 블레이드/근접 쿼리의 브로드페이즈에서 자동으로 제외됩니다.
+    if (HurtboxComponent)
+    {
+        HurtboxComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    }
+
     if (UCapsuleComponent* CapsuleComp = GetCapsuleComponent())
     {
         CapsuleComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
@@ -92,7 +135,11 @@ void AKNCharacterBase::GiveDefaultAbilities()
         {
             // 어빌리티를 레벨 1로 부여합니다. 
             // 1주차 프로토타입 단계이므로 입력 ID(InputID)는 Enhanced Input 방식에 맞춰 INDEX_NONE으로 처리합니다.
-            AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(AbilityClass, 1, INDEX_NONE, this));
+            const FGameplayAbilitySpecHandle Handle =
+                AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(AbilityClass, 1, INDEX_NONE, this));
+
+            // 태그 → 핸들/주 인스턴스 레지스트리에 등록하여 이후 O(1) 조회를 보장합니다.
+            AbilityRegistry.RegisterSpec(Handle);
         }
     }
 }
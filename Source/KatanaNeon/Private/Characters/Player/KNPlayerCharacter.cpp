@@ -6,10 +6,15 @@
 #include "GameFramework/SpringArmComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "AbilitySystemComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "GAS/Components/KNStatsComponent.h"
 #include "Components/StaticMeshComponent.h" 
 #include "GAS/Tags/KNStatsTags.h"
 #include "Components/KNChronosSphereComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "Framework/System/KNCollisionChannels.h"
 
 #pragma region 기본 생성자 및 초기화 구현
 AKNPlayerCharacter::AKNPlayerCharacter()
@@ -37,6 +42,11 @@ AKNPlayerCharacter::AKNPlayerCharacter()
 
     StatsComponent = CreateDefaultSubobject<UKNStatsComponent>(TEXT("StatsComponent"));
 
+    // 플레이어 피격 판정은 적 공격 채널에만 응답하며, 크로노스 구체와는 겹치지 않습니다.
+    HurtboxComponent->SetCollisionProfileName(KatanaNeon::Collision::Profile::PlayerHurtbox);
+    HurtboxComponent->SetGenerateOverlapEvents(false);
+    TimeTeam = EKNTimeTeam::Player;
+
     // ── 무기 컴포넌트 생성 및 초기 부착 (게임 시작 시 납도 상태) ──
     KatanaMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("KatanaMesh"));
     KatanaMesh->SetupAttachment(GetMesh(), TEXT("SheathSocket_L")); // 왼손 허리에 납도
@@ -46,6 +56,15 @@ AKNPlayerCharacter::AKNPlayerCharacter()
     SheathMesh->SetupAttachment(GetMesh(), TEXT("SheathSocket_L"));
     SheathMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
+    // ── 무기 궤적: 칼날 소켓에 1회만 부착하고, 노티파이는 방출만 켜고 끕니다 ──
+    TrailRootComponent = CreateDefaultSubobject<UNiagaraComponent>(TEXT("TrailRootComponent"));
+    TrailRootComponent->SetupAttachment(KatanaMesh, BladeRootSocketName);
+    TrailRootComponent->bAutoActivate = false;
+
+    TrailTipComponent = CreateDefaultSubobject<UNiagaraComponent>(TEXT("TrailTipComponent"));
+    TrailTipComponent->SetupAttachment(KatanaMesh, BladeTipSocketName);
+    TrailTipComponent->bAutoActivate = false;
+
     ChronosSphereComponent = CreateDefaultSubobject<UKNChronosSphereComponent>(TEXT("ChronosSphereComponent"));
     ChronosSphereComponent->SetupAttachment(GetRootComponent());
 }
@@ -60,6 +79,16 @@ void AKNPlayerCharacter::BeginPlay()
         StatsComponent->InitializeStatComponent(AbilitySystemComponent);
     }
 
+    // ASC 초기화 이후에 전투 컨텍스트를 해석해야 ASC 포인터가 유효합니다.
+    RefreshCombatContext();
+
+    // 기본 궤적 에셋은 게임 시작 시 1회만 지정합니다. (노티파이가 같은 에셋이면 이후 교체 없음)
+    if (WeaponTrailVFX)
+    {
+        TrailRootComponent->SetAsset(WeaponTrailVFX);
+        TrailTipComponent->SetAsset(WeaponTrailVFX);
+    }
+
     // 카메라 상하(Pitch) 회전 제한 적용
     // bUsePawnControlRotation이 true일 때, 카메라 회전은 PlayerCameraManager가 통제합니다.
     if (APlayerController* PC = Cast<APlayerController>(GetController()))
@@ -81,11 +110,12 @@ void AKNPlayerCharacter::EquipWeapon()
         // 1. 오른손 소켓으로 물리적 부착 (스케일은 유지, 위치/회전은 소켓에 스냅)
         KatanaMesh->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, TEXT("WeaponSocket_R"));
         bIsWeaponDrawn = true;
+        RefreshCombatContext();
 
         // 2. GAS에 '무기 들었음' 태그 부여
         if (UAbilitySystemComponent* ASC = GetAbilitySystemComponent())
         {
-            ASC->AddLooseGameplayTag(KatanaNeon::State::Combat::WeaponDrawn);
+            UKNAbilitySystemComponent::AddState(ASC, EKNStateTag::WeaponDrawn);
         }
     }
 }
@@ -97,16 +127,54 @@ void AKNPlayerCharacter::UnequipWeapon()
         // 1. 왼쪽 칼집 소켓으로 물리적 부착 귀환
         KatanaMesh->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, TEXT("SheathSocket_L"));
         bIsWeaponDrawn = false;
+        RefreshCombatContext();
 
         // 2. GAS에서 '무기 들었음' 태그 제거
         if (UAbilitySystemComponent* ASC = GetAbilitySystemComponent())
         {
-            ASC->RemoveLooseGameplayTag(KatanaNeon::State::Combat::WeaponDrawn);
+            UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::WeaponDrawn);
         }
     }
 }
 #pragma endregion 무기 스왑 제어 구현
 
+#pragma region 무기 궤적 구현
+void AKNPlayerCharacter::BeginWeaponTrail(UNiagaraSystem* TrailSystem, float EnchantSize)
+{
+    static const FName NAME_EnchantSize(TEXT("_EnchantSize"));
+
+    for (UNiagaraComponent* Trail : { TrailRootComponent.Get(), TrailTipComponent.Get() })
+    {
+        if (!Trail) continue;
+
+        // 에셋 교체는 몽타주가 다른 궤적을 지정했을 때만 발생합니다.
+        if (TrailSystem && Trail->GetAsset() != TrailSystem)
+        {
+            Trail->SetAsset(TrailSystem);
+        }
+        if (!Trail->GetAsset()) continue;
+
+        Trail->SetFloatParameter(NAME_EnchantSize, EnchantSize);
+
+        // 기존 스폰 직후 ResetSystem과 같은 효과 — 컴포넌트 생성·등록 없이 시스템만 재시작합니다.
+        Trail->Activate(true);
+    }
+}
+
+void AKNPlayerCharacter::EndWeaponTrail()
+{
+    // 파티클이 자연스럽게 사그라들도록 Destroy가 아닌 Deactivate 사용
+    if (TrailRootComponent)
+    {
+        TrailRootComponent->Deactivate();
+    }
+    if (TrailTipComponent)
+    {
+        TrailTipComponent->Deactivate();
+    }
+}
+#pragma endregion 무기 궤적 구현
+
 #pragma region 락온 시스템 구현
 void AKNPlayerCharacter::SetLockOnState(bool bNewLockOn)
 {
@@ -129,4 +197,31 @@ void AKNPlayerCharacter::SetLockOnState(bool bNewLockOn)
         }
     }
 }
-#pragma endregion 락온 시스템 구현
\ No newline at end of file
+#pragma endregion 락온 시스템 구현
+
+#pragma region 전투 컨텍스트 캐시 구현
+/*static*/ const FKNCombatContext* AKNPlayerCharacter::GetCombatContext(const AActor* Avatar)
+{
+    const AKNPlayerCharacter* Player = Cast<AKNPlayerCharacter>(Avatar);
+    return Player ? &Player->CombatContext : nullptr;
+}
+
+void AKNPlayerCharacter::RefreshCombatContext()
+{
+    CombatContext.AbilitySystem = AbilitySystemComponent;
+    CombatContext.Stats = StatsComponent;
+    CombatContext.WeaponMesh = KatanaMesh;
+    CombatContext.BladeRootSocket = BladeRootSocketName;
+    CombatContext.BladeTipSocket = BladeTipSocketName;
+    CombatContext.bWeaponDrawn = bIsWeaponDrawn;
+    CombatContext.bBladeSocketsResolved = false;
+
+    // 스태틱 메시 소켓은 컴포넌트 공간에서 불변이므로 이름 조회는 여기서 1회만 수행합니다.
+    if (KatanaMesh && KatanaMesh->DoesSocketExist(BladeRootSocketName) && KatanaMesh->DoesSocketExist(BladeTipSocketName))
+    {
+        CombatContext.LocalBladeRoot = KatanaMesh->GetSocketTransform(BladeRootSocketName, RTS_Component).GetLocation();
+        CombatContext.LocalBladeTip = KatanaMesh->GetSocketTransform(BladeTipSocketName, RTS_Component).GetLocation();
+        CombatContext.bBladeSocketsResolved = true;
+    }
+}
+#pragma endregion 전투 컨텍스트 캐시 구현
@@ -76,36 +76,41 @@ void AKNPlayerController::SetupInputComponent()
 #pragma endregion 셋업 및 바인딩 구현
 
 #pragma region 입력 콜백 헬퍼 함수 구현
+AKNCharacterBase* AKNPlayerController::GetControlledKNCharacter() const
+{
+    return Cast<AKNCharacterBase>(GetPawn());
+}
+
 void AKNPlayerController::TryActivateAbilityByTag(const FGameplayTag& Tag)
 {
     // 최적화: 7곳에서 반복되던 캐스팅과 컨테이너 생성을 여기서 단 1번만 수행합니다. (리뷰 7번)
-    if (AKNCharacterBase* ControlledCharacter = Cast<AKNCharacterBase>(GetPawn()))
+    if (AKNCharacterBase* ControlledCharacter = GetControlledKNCharacter())
     {
         if (UAbilitySystemComponent* ASC = ControlledCharacter->GetAbilitySystemComponent())
         {
+            // 레지스트리에 등록된 어빌리티는 핸들로 직접 활성화합니다. (태그 컨테이너 매칭 생략)
+            const FGameplayAbilitySpecHandle Handle = ControlledCharacter->GetAbilityRegistry().GetHandle(Tag);
+            if (Handle.IsValid())
+            {
+                ASC->TryActivateAbility(Handle);
+                return;
+            }
+
             ASC->TryActivateAbilitiesByTag(FGameplayTagContainer(Tag));
         }
     }
 }
 void AKNPlayerController::CancelAbilityByTag(const FGameplayTag& Tag)
 {
-    // 최적화: 종료할 때도 여기서 컨테이너를 단 1번만 생성하여 처리합니다.
-    if (AKNCharacterBase* ControlledCharacter = Cast<AKNCharacterBase>(GetPawn()))
+    if (AKNCharacterBase* ControlledCharacter = GetControlledKNCharacter())
     {
         if (UAbilitySystemComponent* ASC = ControlledCharacter->GetAbilitySystemComponent())
         {
-            TArray<FGameplayAbilitySpec*> MatchingSpecs;
-            ASC->GetActivatableGameplayAbilitySpecsByAllMatchingTags(
-                FGameplayTagContainer(Tag),
-                MatchingSpecs,
-                /*bOnlyAbilitiesThatSatisfyTagRequirements=*/false);
-
-            for (FGameplayAbilitySpec* Spec : MatchingSpecs)
+            // 최적화: 스펙 배열을 만들지 않고 레지스트리의 핸들로 즉시 취소합니다.
+            const FKNAbilityRegistry& Registry = ControlledCharacter->GetAbilityRegistry();
+            if (Registry.IsActive(Tag))
             {
-                if (Spec && Spec->IsActive())
-                {
-                    ASC->CancelAbilityHandle(Spec->Handle);
-                }
+                ASC->CancelAbilityHandle(Registry.GetHandle(Tag));
             }
         }
     }
@@ -172,116 +177,53 @@ void AKNPlayerController::Input_JumpStop(const FInputActionValue&)
 void AKNPlayerController::Input_SprintToggle(const FInputActionValue&)
 {
     /** @brief Shift 토글 시 Sprint 활성/비활성을 전환합니다. */
-    if (AKNCharacterBase* ControlledCharacter = Cast<AKNCharacterBase>(GetPawn()))
+    if (const AKNCharacterBase* ControlledCharacter = GetControlledKNCharacter())
     {
-        if (UAbilitySystemComponent* ASC = ControlledCharacter->GetAbilitySystemComponent())
-        {
-            TArray<FGameplayAbilitySpec*> MatchingSpecs;
-            ASC->GetActivatableGameplayAbilitySpecsByAllMatchingTags(
-                FGameplayTagContainer(KatanaNeon::Ability::Movement::Sprint),
-                MatchingSpecs,
-                /*bOnlyAbilitiesThatSatisfyTagRequirements=*/false);
-
-            bool bIsActive = false;
-            for (FGameplayAbilitySpec* Spec : MatchingSpecs)
-            {
-                if (Spec && Spec->IsActive())
-                {
-                    bIsActive = true;
-                    break;
-                }
-            }
-
-            bIsActive
-                ? CancelAbilityByTag(KatanaNeon::Ability::Movement::Sprint)
-                : TryActivateAbilityByTag(KatanaNeon::Ability::Movement::Sprint);
-        }
+        ControlledCharacter->GetAbilityRegistry().IsActive(KatanaNeon::Ability::Movement::Sprint)
+            ? CancelAbilityByTag(KatanaNeon::Ability::Movement::Sprint)
+            : TryActivateAbilityByTag(KatanaNeon::Ability::Movement::Sprint);
     }
 }
 
 // ── GAS 어빌리티 호출 로직 (공통 헬퍼 사용으로 획기적 최적화) ──
 void AKNPlayerController::Input_Attack(const FInputActionValue&)
 {
-    // 최적화: 스마트 포인터 방식의 nullptr 안전 검사
-    AKNCharacterBase* ControlledCharacter = Cast<AKNCharacterBase>(GetPawn());
+    const AKNCharacterBase* ControlledCharacter = GetControlledKNCharacter();
     if (ControlledCharacter == nullptr)
     {
         return;
     }
 
-    UAbilitySystemComponent* ASC = ControlledCharacter->GetAbilitySystemComponent();
-    if (ASC == nullptr)
+    // 최적화: 레지스트리 O(1) 조회로 활성 콤보 인스턴스를 바로 가져옵니다.
+    if (UKNAbilityComboAttack* ComboAbility = ControlledCharacter->GetAbilityRegistry()
+        .GetActiveInstance<UKNAbilityComboAttack>(KatanaNeon::Ability::Combat::Attack))
     {
+        // 콤보 진행 중 → TryActivate 하지 않고 어빌리티 내부 버퍼에만 저장 (SRP)
+        ComboAbility->BufferNextInput(false); // Light Attack
         return;
     }
 
-    TArray<FGameplayAbilitySpec*> MatchingSpecs;
-    ASC->GetActivatableGameplayAbilitySpecsByAllMatchingTags(
-        FGameplayTagContainer(KatanaNeon::Ability::Combat::Attack),
-        MatchingSpecs,
-        false
-    );
-
-    for (FGameplayAbilitySpec* Spec : MatchingSpecs)
-    {
-        if (Spec == nullptr) continue;
-
-        if (Spec->IsActive())
-        {
-            // 최적화: InstancedPerActor이므로 배열 루프 없이 PrimaryInstance를 직접 가져옵니다.
-            UGameplayAbility* PrimaryInstance = Spec->GetPrimaryInstance();
-            UKNAbilityComboAttack* ComboAbility = Cast<UKNAbilityComboAttack>(PrimaryInstance);
-
-            if (ComboAbility != nullptr)
-            {
-                // 콤보 진행 중 → TryActivate 하지 않고 어빌리티 내부 버퍼에만 저장 (SRP)
-                ComboAbility->BufferNextInput(false); // Light Attack
-                return;
-            }
-        }
-    }
-
     // 콤보 비활성 → 어빌리티 새로 시작
-    ASC->TryActivateAbilitiesByTag(FGameplayTagContainer(KatanaNeon::Ability::Combat::Attack));
+    TryActivateAbilityByTag(KatanaNeon::Ability::Combat::Attack);
 }
 
 void AKNPlayerController::Input_HeavyAttack(const FInputActionValue& Value)
 {
-    AKNCharacterBase* ControlledCharacter = Cast<AKNCharacterBase>(GetPawn());
+    const AKNCharacterBase* ControlledCharacter = GetControlledKNCharacter();
     if (!ControlledCharacter) return;
 
-    UAbilitySystemComponent* ASC = ControlledCharacter->GetAbilitySystemComponent();
-    if (!ASC) return;
-
-    TArray<FGameplayAbilitySpec*> MatchingSpecs;
-    ASC->GetActivatableGameplayAbilitySpecsByAllMatchingTags(
-        FGameplayTagContainer(KatanaNeon::Ability::Combat::Attack),
-        MatchingSpecs, false);
-
-    for (FGameplayAbilitySpec* Spec : MatchingSpecs)
+    const FKNAbilityRegistry& Registry = ControlledCharacter->GetAbilityRegistry();
+    if (UKNAbilityComboAttack* ComboAbility =
+        Registry.GetInstance<UKNAbilityComboAttack>(KatanaNeon::Ability::Combat::Attack))
     {
-        if (!Spec) continue;
-
-        if (Spec->IsActive())
+        if (Registry.IsActive(KatanaNeon::Ability::Combat::Attack))
         {
-            UGameplayAbility* PrimaryInstance = Spec->GetPrimaryInstance();
-            UKNAbilityComboAttack* ComboAbility = Cast<UKNAbilityComboAttack>(PrimaryInstance);
-            if (ComboAbility != nullptr)
-            {
-                // Input_Attack과 동일한 패턴 — BufferNextInput 후 early return
-                ComboAbility->BufferNextInput(true);
-                return;
-            }
-        }
-        else
-        {
-            UGameplayAbility* PrimaryInstance = Spec->GetPrimaryInstance();
-            UKNAbilityComboAttack* ComboAbility = Cast<UKNAbilityComboAttack>(PrimaryInstance);
-            if (ComboAbility != nullptr)
-            {
-                ComboAbility->PrepareHeavyStart();
-            }
+            // Input_Attack과 동일한 패턴 — BufferNextInput 후 early return
+            ComboAbility->BufferNextInput(true);
+            return;
         }
+
+        ComboAbility->PrepareHeavyStart();
     }
 
     TryActivateAbilityByTag(KatanaNeon::Ability::Combat::Attack);
@@ -299,30 +241,11 @@ void AKNPlayerController::Input_Parry(const FInputActionValue&)
 
 void AKNPlayerController::Input_Chronos(const FInputActionValue&)
 {
-    if (AKNCharacterBase* ControlledCharacter = Cast<AKNCharacterBase>(GetPawn()))
+    if (const AKNCharacterBase* ControlledCharacter = GetControlledKNCharacter())
     {
-        if (UAbilitySystemComponent* ASC = ControlledCharacter->GetAbilitySystemComponent())
-        {
-            TArray<FGameplayAbilitySpec*> MatchingSpecs;
-            ASC->GetActivatableGameplayAbilitySpecsByAllMatchingTags(
-                FGameplayTagContainer(KatanaNeon::Ability::Combat::Chronos),
-                MatchingSpecs,
-                /*bOnlyAbilitiesThatSatisfyTagRequirements=*/false);
-
-            bool bIsActive = false;
-            for (FGameplayAbilitySpec* Spec : MatchingSpecs)
-            {
-                if (Spec && Spec->IsActive())
-                {
-                    bIsActive = true;
-                    break;
-                }
-            }
-
-            bIsActive
-                ? CancelAbilityByTag(KatanaNeon::Ability::Combat::Chronos)
-                : TryActivateAbilityByTag(KatanaNeon::Ability::Combat::Chronos);
-        }
+        ControlledCharacter->GetAbilityRegistry().IsActive(KatanaNeon::Ability::Combat::Chronos)
+            ? CancelAbilityByTag(KatanaNeon::Ability::Combat::Chronos)
+            : TryActivateAbilityByTag(KatanaNeon::Ability::Combat::Chronos);
     }
 }
 
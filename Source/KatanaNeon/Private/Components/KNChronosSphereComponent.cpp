@@ -2,10 +2,10 @@
 
 
 #include "Components/KNChronosSphereComponent.h"
-#include "AbilitySystemComponent.h"
-#include "AbilitySystemInterface.h"
 #include "GameFramework/Actor.h"
-#include "GAS/Tags/KNStatsTags.h" 
+#include "Characters/Base/KNCharacterBase.h"
+#include "Framework/System/KNCollisionChannels.h"
+#include "Framework/System/KNTimeDilationSubsystem.h"
 
 #pragma region 기본 생성자 및 초기화 구현
 UKNChronosSphereComponent::UKNChronosSphereComponent()
@@ -14,14 +14,10 @@ UKNChronosSphereComponent::UKNChronosSphereComponent()
     PrimaryComponentTick.bCanEverTick = true;
     PrimaryComponentTick.bStartWithTickEnabled = false;
 
+    // KNChronosField 프로필: 허트박스와 발사체 채널에만 겹치므로 이동 캡슐·지형·소품은 브로드페이즈에서 제외됩니다.
+    SetCollisionProfileName(KatanaNeon::Collision::Profile::ChronosField);
     SetCollisionEnabled(ECollisionEnabled::NoCollision);
-    SetCollisionObjectType(ECC_WorldDynamic);
-    SetCollisionResponseToAllChannels(ECR_Ignore);
-    SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
-    SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Overlap);
     SetGenerateOverlapEvents(false);
-
-    ProjectileTag = KatanaNeon::Data::Actor::Projectile;
 }
 
 void UKNChronosSphereComponent::BeginPlay()
@@ -58,9 +54,14 @@ void UKNChronosSphereComponent::TickComponent(
         /*Thickness=*/2.f);
 
     // 현재 슬로우 중인 액터 수 화면 출력
+    const UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this);
+    const int32 NumSlowed = (bUseSpatialField && TimeDilation)
+        ? TimeDilation->GetNumLayerMembers(SphereLayer)
+        : SlowedActors.Num();
+
     const FString DebugText = FString::Printf(
-        TEXT("Chronos Active | R: %.0f | Slowed: %d"),
-        Radius, SlowedActors.Num());
+        TEXT("Chronos %s | R: %.0f | Slowed: %d"),
+        bUseSpatialField ? TEXT("Field") : TEXT("Overlap"), Radius, NumSlowed);
 
     DrawDebugString(
         World,
@@ -85,26 +86,38 @@ void UKNChronosSphereComponent::ActivateSphere(
     CachedProjectileSlowScale = InProjectileSlowScale;
 
     SetSphereRadius(InRadius);
-    SetGenerateOverlapEvents(true);
-    SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-    bChronosActive = true;
 
-    TArray<AActor*> AlreadyOverlapping;
-    GetOverlappingActors(AlreadyOverlapping);
+    // 멤버별 배율은 시간 서브시스템이 다른 레이어와 합성해 프레임당 1회 기록합니다.
+    UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this);
 
-    for (AActor* Actor : AlreadyOverlapping)
+    if (bUseSpatialField)
     {
-        if (!Actor || Actor == GetOwner()) continue;
-
-        if (IsProjectileActor(Actor))
+        // 필드 모드는 콜리전을 켜지 않으므로 오버랩 브로드페이즈 비용이 없습니다.
+        if (TimeDilation)
+        {
+            SphereLayer = TimeDilation->PushFieldLayer(
+                this, GetScaledSphereRadius(), GetTargetTeam(),
+                CachedEnemySlowScale, CachedProjectileSlowScale,
+                UKNTimeDilationSubsystem::PriorityChronos);
+        }
+    }
+    else
+    {
+        if (TimeDilation)
         {
-            ApplyTimeDilationToActor(Actor, CachedProjectileSlowScale);
-            SlowedActors.Add(Actor);
+            SphereLayer = TimeDilation->PushSphereLayer(UKNTimeDilationSubsystem::PriorityChronos);
         }
-        else if (IsEnemyActor(Actor))
+
+        SetGenerateOverlapEvents(true);
+        SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+
+        // 콜리전 활성화 중 발생한 BeginOverlap은 아직 비활성 상태라 무시되며, 이미 겹친 대상은 여기서 한 번에 처리합니다.
+        TArray<UPrimitiveComponent*> AlreadyOverlapping;
+        GetOverlappingComponents(AlreadyOverlapping);
+
+        for (UPrimitiveComponent* Comp : AlreadyOverlapping)
         {
-            ApplyTimeDilationToActor(Actor, CachedEnemySlowScale);
-            SlowedActors.Add(Actor);
+            TrySlowComponent(Comp);
         }
     }
 
@@ -129,14 +142,10 @@ void UKNChronosSphereComponent::DeactivateSphere()
     SetCollisionEnabled(ECollisionEnabled::NoCollision);
     SetGenerateOverlapEvents(false);
 
-    PurgeInvalidActors();
-
-    for (const TWeakObjectPtr<AActor>& WeakActor : SlowedActors)
+    // 레이어 제거만으로 모든 멤버가 다음 재계산에서 하위 레이어(없으면 1.0)로 복구됩니다.
+    if (UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this))
     {
-        if (AActor* Actor = WeakActor.Get())
-        {
-            ApplyTimeDilationToActor(Actor, 1.0f);
-        }
+        TimeDilation->PopLayer(SphereLayer);
     }
     SlowedActors.Empty();
 
@@ -154,18 +163,9 @@ void UKNChronosSphereComponent::OnSphereBeginOverlap(
     bool                 bFromSweep,
     const FHitResult& SweepResult)
 {
-    if (!OtherActor || OtherActor == GetOwner() || !bChronosActive) return;
+    if (!bChronosActive) return;
 
-    if (IsProjectileActor(OtherActor))
-    {
-        ApplyTimeDilationToActor(OtherActor, CachedProjectileSlowScale);
-        SlowedActors.Add(OtherActor);
-    }
-    else if (IsEnemyActor(OtherActor))
-    {
-        ApplyTimeDilationToActor(OtherActor, CachedEnemySlowScale);
-        SlowedActors.Add(OtherActor);
-    }
+    TrySlowComponent(OtherComp);
 }
 
 void UKNChronosSphereComponent::OnSphereEndOverlap(
@@ -177,57 +177,73 @@ void UKNChronosSphereComponent::OnSphereEndOverlap(
     if (!OtherActor || !bChronosActive) return;
 
     const TWeakObjectPtr<AActor> WeakOther(OtherActor);
-    if (SlowedActors.Contains(WeakOther))
+    if (SlowedActors.Remove(WeakOther) > 0)
     {
-        ApplyTimeDilationToActor(OtherActor, 1.0f);
-        SlowedActors.Remove(WeakOther);
+        if (UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this))
+        {
+            TimeDilation->RemoveSphereMember(SphereLayer, OtherActor);
+        }
     }
 }
 #pragma endregion 오버랩 콜백 구현
 
 #pragma region 내부 헬퍼 함수 구현
-bool UKNChronosSphereComponent::IsProjectileActor(const AActor* Actor) const
+void UKNChronosSphereComponent::TrySlowComponent(UPrimitiveComponent* OtherComp)
 {
-    if (!Actor || !ProjectileTag.IsValid()) return false;
+    if (!OtherComp) return;
+
+    AActor* OtherActor = OtherComp->GetOwner();
+    if (!OtherActor || OtherActor == GetOwner()) return;
+
+    // 채널은 진영을 구분하지 않으므로, 소유자 쪽 발사체(참격파 등)와 아군은 진영으로 걸러냅니다.
+    if (ResolveActorTeam(OtherActor) != GetTargetTeam()) return;
 
-    // 베테랑 최적화: IAbilitySystemInterface 캐스팅 (O(1)) 사용
-    if (const IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(Actor))
+    // 응답 매트릭스상 겹칠 수 있는 것은 허트박스와 발사체뿐이므로 오브젝트 타입만으로 분류합니다.
+    const ECollisionChannel ObjectType = OtherComp->GetCollisionObjectType();
+    if (ObjectType == KatanaNeon::Collision::Projectile)
     {
-        if (const UAbilitySystemComponent* ASC = ASI->GetAbilitySystemComponent())
-        {
-            return ASC->HasMatchingGameplayTag(ProjectileTag);
-        }
+        SetActorSlowScale(OtherActor, CachedProjectileSlowScale);
+    }
+    else if (ObjectType == KatanaNeon::Collision::Hurtbox)
+    {
+        SetActorSlowScale(OtherActor, CachedEnemySlowScale);
     }
-
-    // 베테랑 최적화: FName 파싱 비용 제거를 위한 static 캐싱
-    static const FName NAME_KNProjectile(TEXT("KNProjectile"));
-    return Actor->ActorHasTag(NAME_KNProjectile);
 }
 
-bool UKNChronosSphereComponent::IsEnemyActor(const AActor* Actor) const
+EKNTimeTeam UKNChronosSphereComponent::GetTargetTeam() const
 {
-    if (!Actor || Actor == GetOwner()) return false;
-
-    // 베테랑 최적화: 컴포넌트 전체를 뒤지는 FindComponentByClass(O(N)) 제거.
-    // ASC 인터페이스를 상속받은 캐릭터인지 즉시 캐스팅(O(1))하여 판별합니다.
-    return Cast<IAbilitySystemInterface>(Actor) != nullptr;
+    const AKNCharacterBase* OwnerCharacter = Cast<AKNCharacterBase>(GetOwner());
+    return (OwnerCharacter && OwnerCharacter->GetTimeTeam() == EKNTimeTeam::Enemy)
+        ? EKNTimeTeam::Player
+        : EKNTimeTeam::Enemy;
 }
 
-/*static*/ void UKNChronosSphereComponent::ApplyTimeDilationToActor(AActor* Actor, float Scale)
+EKNTimeTeam UKNChronosSphereComponent::ResolveActorTeam(const AActor* Actor)
 {
-    if (!Actor) return;
-    Actor->CustomTimeDilation = Scale;
+    // 캐릭터는 자신의 진영, 발사체는 발사한 캐릭터(Owner → Instigator 순)의 진영을 따릅니다.
+    if (const AKNCharacterBase* Character = Cast<AKNCharacterBase>(Actor))
+    {
+        return Character->GetTimeTeam();
+    }
+    if (const AKNCharacterBase* OwnerCharacter = Cast<AKNCharacterBase>(Actor->GetOwner()))
+    {
+        return OwnerCharacter->GetTimeTeam();
+    }
+    if (const AKNCharacterBase* InstigatorCharacter = Cast<AKNCharacterBase>(Actor->GetInstigator()))
+    {
+        return InstigatorCharacter->GetTimeTeam();
+    }
+    return EKNTimeTeam::None;
 }
 
-void UKNChronosSphereComponent::PurgeInvalidActors()
+void UKNChronosSphereComponent::SetActorSlowScale(AActor* Actor, float Scale)
 {
-    // 베테랑 최적화: TSet은 RemoveAll을 지원하지 않으므로 Iterator로 순회 삭제합니다.
-    for (auto It = SlowedActors.CreateIterator(); It; ++It)
+    if (!Actor) return;
+
+    if (UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this))
     {
-        if (!It->IsValid())
-        {
-            It.RemoveCurrent();
-        }
+        TimeDilation->SetSphereMember(SphereLayer, Actor, Scale);
     }
+    SlowedActors.Add(Actor);
 }
 #pragma endregion 내부 헬퍼 함수 구현
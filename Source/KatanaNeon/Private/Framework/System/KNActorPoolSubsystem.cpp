@@ -0,0 +1,236 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/KNActorPoolSubsystem.h"
+#include "Framework/System/KNPooledActorInterface.h"
+#include "Framework/System/KNTimeDilationSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+
+#pragma region 서브시스템 생명주기 구현
+void UKNActorPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // 레벨 로드 시점에 발사체를 미리 스폰해 두어 첫 발사의 스폰 히치를 없앱니다.
+    for (const FKNActorPoolPrewarmEntry& Entry : PrewarmClasses)
+    {
+        if (UClass* ActorClass = Entry.ActorClass.LoadSynchronous())
+        {
+            Prewarm(ActorClass, Entry.Count);
+        }
+    }
+}
+
+void UKNActorPoolSubsystem::Deinitialize()
+{
+    // 풀 액터는 월드와 함께 정리되므로 참조만 놓습니다.
+    Pools.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UKNActorPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+#pragma endregion 서브시스템 생명주기 구현
+
+#pragma region 풀 인터페이스 구현
+UKNActorPoolSubsystem* UKNActorPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = GEngine
+        ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+        : nullptr;
+    return World ? World->GetSubsystem<UKNActorPoolSubsystem>() : nullptr;
+}
+
+void UKNActorPoolSubsystem::ReleaseActor(AActor* Actor)
+{
+    if (!IsValid(Actor)) return;
+
+    UKNActorPoolSubsystem* Pool = Get(Actor);
+    if (!Pool || !Pool->Release(Actor))
+    {
+        Actor->Destroy();
+    }
+}
+
+bool UKNActorPoolSubsystem::IsPoolable(const UClass* ActorClass)
+{
+    return ActorClass && ActorClass->ImplementsInterface(UKNPooledActor::StaticClass());
+}
+
+AActor* UKNActorPoolSubsystem::AcquireDeferred(UClass* ActorClass, const FTransform& Transform, AActor* Owner, APawn* Instigator)
+{
+    if (!IsPoolable(ActorClass)) return nullptr;
+
+    FKNActorPoolBucket& Bucket = Pools.FindOrAdd(ActorClass);
+
+    AActor* Actor = nullptr;
+    while (!Actor && !Bucket.Free.IsEmpty())
+    {
+        AActor* Candidate = Bucket.Free.Pop(EAllowShrinking::No);
+        Actor = IsValid(Candidate) ? Candidate : nullptr;
+    }
+
+    if (Actor)
+    {
+        ++Stats.PoolHits;
+        Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+    }
+    else
+    {
+        Actor = SpawnPooledActor(ActorClass, Transform);
+        if (!Actor) return nullptr;
+        ++Stats.PoolMisses;
+        ++Bucket.Misses;
+    }
+
+    Actor->SetOwner(Owner);
+    Actor->SetInstigator(Instigator);
+
+    // 레벨 스트리밍 등으로 사용 중에 파괴된 액터는 최대치 집계에서 뺍니다.
+    Bucket.InUse.RemoveAllSwap([](const AActor* InUseActor) { return !IsValid(InUseActor); }, EAllowShrinking::No);
+    Bucket.InUse.Add(Actor);
+    Bucket.PeakInUse = FMath::Max(Bucket.PeakInUse, Bucket.InUse.Num());
+    return Actor;
+}
+
+void UKNActorPoolSubsystem::FinishAcquire(AActor* Actor)
+{
+    if (!IsValid(Actor)) return;
+
+    Actor->SetActorHiddenInGame(false);
+    Actor->SetActorEnableCollision(true);
+    Actor->SetActorTickEnabled(Actor->PrimaryActorTick.bStartWithTickEnabled);
+
+    IKNPooledActor::Execute_OnAcquiredFromPool(Actor);
+}
+
+bool UKNActorPoolSubsystem::Release(AActor* Actor)
+{
+    if (!IsValid(Actor)) return false;
+
+    FKNActorPoolBucket* Bucket = Pools.Find(Actor->GetClass());
+    if (!Bucket || Bucket->InUse.RemoveSwap(Actor, EAllowShrinking::No) == 0) return false;
+
+    ++Stats.Releases;
+
+    // 진영 등록을 먼저 풀어 시간 정지가 기록해 둔 틱이 비활성화 이후에 되살아나지 않게 합니다.
+    if (UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this))
+    {
+        TimeDilation->UnregisterActor(Actor);
+    }
+
+    IKNPooledActor::Execute_OnReleasedToPool(Actor);
+    DeactivateActor(Actor);
+
+    // 순간 피크로 늘어난 액터는 상한을 넘는 만큼 파괴하여 상주 메모리를 제한합니다.
+    if (Bucket->Free.Num() >= MaxFreePerClass)
+    {
+        ++Stats.OverflowDestroyed;
+        Actor->Destroy();
+        return true;
+    }
+
+    Bucket->Free.Add(Actor);
+    return true;
+}
+
+void UKNActorPoolSubsystem::Prewarm(UClass* ActorClass, int32 Count)
+{
+    if (!IsPoolable(ActorClass)) return;
+
+    const int32 Target = FMath::Min(Count, MaxFreePerClass);
+    FKNActorPoolBucket& Bucket = Pools.FindOrAdd(ActorClass);
+
+    while (Bucket.Free.Num() < Target)
+    {
+        AActor* Actor = SpawnPooledActor(ActorClass, FTransform::Identity);
+        if (!Actor) break;
+
+        Bucket.Free.Add(Actor);
+        ++Stats.Prewarmed;
+    }
+}
+
+void UKNActorPoolSubsystem::ResetStats()
+{
+    Stats = FKNActorPoolStats();
+    for (TPair<TObjectPtr<UClass>, FKNActorPoolBucket>& Pair : Pools)
+    {
+        Pair.Value.PeakInUse = Pair.Value.InUse.Num();
+        Pair.Value.Misses = 0;
+    }
+}
+#pragma endregion 풀 인터페이스 구현
+
+#pragma region 내부 헬퍼 함수 구현
+AActor* UKNActorPoolSubsystem::SpawnPooledActor(UClass* ActorClass, const FTransform& Transform)
+{
+    UWorld* World = GetWorld();
+    if (!World || !ActorClass) return nullptr;
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    // BeginPlay는 생성 시 한 번만 거치고, 이후 활성화는 재사용과 같이 FinishAcquire가 담당합니다.
+    AActor* Actor = World->SpawnActor<AActor>(ActorClass, Transform, SpawnParams);
+    if (!Actor) return nullptr;
+
+    DeactivateActor(Actor);
+    return Actor;
+}
+
+void UKNActorPoolSubsystem::DeactivateActor(AActor* Actor)
+{
+    Actor->SetLifeSpan(0.0f);
+    Actor->SetActorTickEnabled(false);
+    Actor->SetActorEnableCollision(false);
+    Actor->SetActorHiddenInGame(true);
+}
+#pragma endregion 내부 헬퍼 함수 구현
+
+#pragma region 액터 풀 통계
+#if !UE_BUILD_SHIPPING
+namespace
+{
+    /** @brief 현재 월드의 액터 풀 통계를 클래스별로 출력합니다. ("reset" 인자 시 출력 후 초기화) */
+    FAutoConsoleCommandWithWorldAndArgs GKNActorPoolStatsCommand(
+        TEXT("KN.Pool.Stats"),
+        TEXT("액터 풀 재사용/스폰 횟수와 클래스별 최대 동시 사용량을 출력합니다. 인자 reset 시 통계를 초기화합니다."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            UKNActorPoolSubsystem* Pool = World ? World->GetSubsystem<UKNActorPoolSubsystem>() : nullptr;
+            if (!Pool)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[KNActorPoolSubsystem] 이 월드에는 액터 풀이 없습니다."));
+                return;
+            }
+
+            const FKNActorPoolStats& Stats = Pool->GetStats();
+            UE_LOG(LogTemp, Log,
+                TEXT("[KNActorPoolSubsystem] 풀 적중 %d / 미스 %d, 워밍업 %d, 반납 %d (상한 초과 파괴 %d)"),
+                Stats.PoolHits, Stats.PoolMisses, Stats.Prewarmed, Stats.Releases, Stats.OverflowDestroyed);
+
+            // 최대 동시 사용량(PeakInUse)을 DataTable 풀 크기에 반영하면 미스가 0이 됩니다.
+            for (const TPair<TObjectPtr<UClass>, FKNActorPoolBucket>& Pair : Pool->GetPools())
+            {
+                UE_LOG(LogTemp, Log,
+                    TEXT("[KNActorPoolSubsystem]   %s — 사용 %d (최대 %d), 대기 %d, 미스 %d"),
+                    *GetNameSafe(Pair.Key), Pair.Value.InUse.Num(), Pair.Value.PeakInUse,
+                    Pair.Value.Free.Num(), Pair.Value.Misses);
+            }
+
+            if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+            {
+                Pool->ResetStats();
+            }
+        }));
+}
+#endif
+#pragma endregion 액터 풀 통계
@@ -0,0 +1,247 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/KNCombatVFXSubsystem.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+
+#pragma region 서브시스템 생명주기 구현
+void UKNCombatVFXSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // 레벨 로드 시점에 공용 이펙트를 미리 만들어 첫 타격의 컴포넌트 생성·등록 비용을 없앱니다.
+    for (const TSoftObjectPtr<UNiagaraSystem>& SoftSystem : WarmupSystems)
+    {
+        if (UNiagaraSystem* System = SoftSystem.LoadSynchronous())
+        {
+            Prewarm(System);
+        }
+    }
+}
+
+void UKNCombatVFXSubsystem::Deinitialize()
+{
+    for (TPair<TObjectPtr<UNiagaraSystem>, FKNVFXPoolBucket>& Pair : Pools)
+    {
+        for (TArray<TObjectPtr<UNiagaraComponent>>* List : { &Pair.Value.Free, &Pair.Value.Active })
+        {
+            for (UNiagaraComponent* Comp : *List)
+            {
+                if (IsValid(Comp))
+                {
+                    Comp->OnSystemFinished.RemoveAll(this);
+                    Comp->DestroyComponent();
+                }
+            }
+        }
+    }
+    Pools.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UKNCombatVFXSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+#pragma endregion 서브시스템 생명주기 구현
+
+#pragma region VFX 스폰 인터페이스 구현
+UKNCombatVFXSubsystem* UKNCombatVFXSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = GEngine
+        ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+        : nullptr;
+    return World ? World->GetSubsystem<UKNCombatVFXSubsystem>() : nullptr;
+}
+
+UNiagaraComponent* UKNCombatVFXSubsystem::SpawnAtLocation(
+    UNiagaraSystem* System,
+    const FVector& Location,
+    const FRotator& Rotation,
+    EKNVFXPriority Priority)
+{
+    if (!System) return nullptr;
+
+    // 예산 확인은 프레임 카운터 갱신을 겸하므로 Essential도 먼저 호출합니다.
+    const bool bHasBudget = HasSpawnBudget();
+
+    if (Priority == EKNVFXPriority::Cosmetic)
+    {
+        if (IsBeyondCullDistance(Location))
+        {
+            ++Stats.DistanceCulled;
+            return nullptr;
+        }
+        if (!bHasBudget)
+        {
+            ++Stats.BudgetCulled;
+            return nullptr;
+        }
+    }
+    ++SpawnsThisFrame;
+
+    FKNVFXPoolBucket& Bucket = Pools.FindOrAdd(System);
+
+    UNiagaraComponent* Comp = nullptr;
+    while (!Comp && !Bucket.Free.IsEmpty())
+    {
+        UNiagaraComponent* Candidate = Bucket.Free.Pop(EAllowShrinking::No);
+        Comp = IsValid(Candidate) ? Candidate : nullptr;
+    }
+
+    if (Comp)
+    {
+        ++Stats.PoolHits;
+    }
+    else
+    {
+        Comp = CreatePooledComponent(System);
+        if (!Comp) return nullptr;
+        ++Stats.PoolMisses;
+    }
+
+    // 즉시 완료되는 시스템도 회수되도록 활성화 전에 재생 목록에 넣습니다.
+    Bucket.Active.Add(Comp);
+    Comp->SetWorldLocationAndRotation(Location, Rotation);
+    Comp->Activate(true);
+
+    Stats.PeakActive = FMath::Max(Stats.PeakActive, GetNumActive());
+    return Comp;
+}
+
+void UKNCombatVFXSubsystem::Prewarm(UNiagaraSystem* System, int32 Count)
+{
+    if (!System) return;
+
+    const int32 Target = FMath::Min(Count > 0 ? Count : PrewarmCount, MaxFreePerSystem);
+    FKNVFXPoolBucket& Bucket = Pools.FindOrAdd(System);
+
+    while (Bucket.Free.Num() < Target)
+    {
+        UNiagaraComponent* Comp = CreatePooledComponent(System);
+        if (!Comp) break;
+
+        Bucket.Free.Add(Comp);
+        ++Stats.Prewarmed;
+    }
+}
+
+int32 UKNCombatVFXSubsystem::GetNumActive() const
+{
+    int32 Num = 0;
+    for (const TPair<TObjectPtr<UNiagaraSystem>, FKNVFXPoolBucket>& Pair : Pools)
+    {
+        Num += Pair.Value.Active.Num();
+    }
+    return Num;
+}
+
+int32 UKNCombatVFXSubsystem::GetNumFree() const
+{
+    int32 Num = 0;
+    for (const TPair<TObjectPtr<UNiagaraSystem>, FKNVFXPoolBucket>& Pair : Pools)
+    {
+        Num += Pair.Value.Free.Num();
+    }
+    return Num;
+}
+#pragma endregion VFX 스폰 인터페이스 구현
+
+#pragma region 내부 헬퍼 함수 구현
+UNiagaraComponent* UKNCombatVFXSubsystem::CreatePooledComponent(UNiagaraSystem* System)
+{
+    UWorld* World = GetWorld();
+    if (!World || !System) return nullptr;
+
+    // SpawnSystemAtLocation과 같이 월드를 Outer로 두되, 자동 파괴 대신 풀로 회수합니다.
+    UNiagaraComponent* Comp = NewObject<UNiagaraComponent>(World);
+    Comp->SetAutoDestroy(false);
+    Comp->bAutoActivate = false;
+    Comp->SetAsset(System);
+    Comp->OnSystemFinished.AddUniqueDynamic(this, &UKNCombatVFXSubsystem::OnPooledSystemFinished);
+    Comp->RegisterComponentWithWorld(World);
+    return Comp;
+}
+
+bool UKNCombatVFXSubsystem::IsBeyondCullDistance(const FVector& Location) const
+{
+    if (CullDistance <= 0.0f) return false;
+
+    const UWorld* World = GetWorld();
+    const APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+    if (!PC || !PC->PlayerCameraManager) return false;
+
+    return FVector::DistSquared(PC->PlayerCameraManager->GetCameraLocation(), Location) > FMath::Square(CullDistance);
+}
+
+bool UKNCombatVFXSubsystem::HasSpawnBudget()
+{
+    if (BudgetFrame != GFrameCounter)
+    {
+        BudgetFrame = GFrameCounter;
+        SpawnsThisFrame = 0;
+    }
+    return SpawnsThisFrame < SpawnBudgetPerFrame;
+}
+
+void UKNCombatVFXSubsystem::OnPooledSystemFinished(UNiagaraComponent* FinishedComponent)
+{
+    if (!FinishedComponent) return;
+
+    FKNVFXPoolBucket* Bucket = Pools.Find(FinishedComponent->GetAsset());
+    if (!Bucket || Bucket->Active.RemoveSwap(FinishedComponent, EAllowShrinking::No) == 0) return;
+
+    // 순간 피크로 늘어난 컴포넌트는 상한을 넘는 만큼 파괴하여 상주 메모리를 제한합니다.
+    if (Bucket->Free.Num() >= MaxFreePerSystem)
+    {
+        FinishedComponent->OnSystemFinished.RemoveAll(this);
+        FinishedComponent->DestroyComponent();
+        return;
+    }
+
+    Bucket->Free.Add(FinishedComponent);
+}
+#pragma endregion 내부 헬퍼 함수 구현
+
+#pragma region VFX 풀 통계
+#if !UE_BUILD_SHIPPING
+namespace
+{
+    /** @brief 현재 월드의 VFX 풀 통계를 출력합니다. ("reset" 인자 시 출력 후 초기화) */
+    FAutoConsoleCommandWithWorldAndArgs GKNCombatVFXStatsCommand(
+        TEXT("KN.VFX.PoolStats"),
+        TEXT("전투 VFX 풀 재사용/생성 횟수와 컬링된 스폰 수를 출력합니다. 인자 reset 시 통계를 초기화합니다."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            UKNCombatVFXSubsystem* VFX = World ? World->GetSubsystem<UKNCombatVFXSubsystem>() : nullptr;
+            if (!VFX)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[KNCombatVFXSubsystem] 이 월드에는 VFX 서비스가 없습니다."));
+                return;
+            }
+
+            const FKNCombatVFXStats& Stats = VFX->GetStats();
+            const int32 Requests = Stats.PoolHits + Stats.PoolMisses;
+            const double HitRate = Requests > 0 ? 100.0 * Stats.PoolHits / Requests : 0.0;
+
+            UE_LOG(LogTemp, Log,
+                TEXT("[KNCombatVFXSubsystem] 풀 적중 %d / 미스 %d (%.1f%%), 워밍업 %d — 컬링: 거리 %d, 예산 %d — 재생 %d (최대 %d), 대기 %d"),
+                Stats.PoolHits, Stats.PoolMisses, HitRate, Stats.Prewarmed,
+                Stats.DistanceCulled, Stats.BudgetCulled,
+                VFX->GetNumActive(), Stats.PeakActive, VFX->GetNumFree());
+
+            if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+            {
+                VFX->ResetStats();
+            }
+        }));
+}
+#endif
+#pragma endregion VFX 풀 통계
@@ -5,100 +5,211 @@
 #include "Framework/Core/KNGameInstance.h"
 #include "Data/Structs/KNPlayerStatTable.h"
 #include "Data/Structs/KNEnemyStatTable.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "HAL/IConsoleManager.h"
 
 #pragma region 서브시스템 생명주기 구현
 void UKNDataManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
-    UE_LOG(LogTemp, Log, TEXT("[KNDataManagerSubsystem] 12종 마스터 데이터 테이블 시스템 활성화"));
+
+    const UKNGameInstance* GI = Cast<UKNGameInstance>(GetGameInstance());
+    ensureAlwaysMsgf(GI, TEXT("[KNDataManagerSubsystem] 게임 인스턴스가 UKNGameInstance가 아닙니다."));
+
+    BuildCaches(GI);
+    UE_LOG(LogTemp, Log, TEXT("[KNDataManagerSubsystem] 13종 마스터 데이터 테이블 평탄화 캐시 활성화"));
 }
 
 void UKNDataManagerSubsystem::Deinitialize()
 {
+    ResetCaches();
     Super::Deinitialize();
 }
 #pragma endregion 서브시스템 생명주기 구현
 
+#pragma region 내부 헬퍼 함수 구현
+void UKNDataManagerSubsystem::BuildCaches(const UKNGameInstance* GI)
+{
+    ResetCaches();
+    if (!GI) return;
+
+    PlayerBaseStatCache.Build(GI->GetPlayerBaseStatTable());
+    ActionCostCache.Build(GI->GetActionCostTable());
+    JumpSettingCache.Build(GI->GetJumpSettingTable());
+    DrawnComboAttackCache.Build(GI->GetDrawnComboAttackTable());
+    SheathComboAttackCache.Build(GI->GetSheathComboAttackTable());
+    OverclockSettingCache.Build(GI->GetOverclockSettingTable());
+    OverclockLv1Cache.Build(GI->GetOverclockLv1Table());
+    OverclockLv2Cache.Build(GI->GetOverclockLv2Table());
+    OverclockLv3Cache.Build(GI->GetOverclockLv3Table());
+    ChronosSettingCache.Build(GI->GetChronosSettingTable());
+    EnemyStatCache.Build(GI->GetEnemyStatTable());
+    EnemyRangedStatCache.Build(GI->GetEnemyRangedTable());
+    BossPhaseCache.Build(GI->GetBossPhaseTable());
+
+    // 모든 쓰기가 끝난 뒤 게시하여, acquire로 읽는 워커 스레드가 완성된 배열만 보도록 합니다.
+    bDataReady.store(true, std::memory_order_release);
+}
+
+void UKNDataManagerSubsystem::ResetCaches()
+{
+    bDataReady.store(false, std::memory_order_release);
+
+    PlayerBaseStatCache.Reset();
+    ActionCostCache.Reset();
+    JumpSettingCache.Reset();
+    DrawnComboAttackCache.Reset();
+    SheathComboAttackCache.Reset();
+    OverclockSettingCache.Reset();
+    OverclockLv1Cache.Reset();
+    OverclockLv2Cache.Reset();
+    OverclockLv3Cache.Reset();
+    ChronosSettingCache.Reset();
+    EnemyStatCache.Reset();
+    EnemyRangedStatCache.Reset();
+    BossPhaseCache.Reset();
+}
+#pragma endregion 내부 헬퍼 함수 구현
+
 #pragma region 글로벌 데이터 조회 구현
+UKNDataManagerSubsystem* UKNDataManagerSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<UKNDataManagerSubsystem>() : nullptr;
+}
+
 const FKNBaseStatRow* UKNDataManagerSubsystem::GetPlayerBaseStat(const FName& RowName) const
 {
-    UKNGameInstance* GI = Cast<UKNGameInstance>(GetGameInstance());
-    return (GI && GI->GetPlayerBaseStatTable()) ? GI->GetPlayerBaseStatTable()->FindRow<FKNBaseStatRow>(RowName, TEXT("GetPlayerBaseStat")) : nullptr;
+    return PlayerBaseStatCache.Find(RowName);
 }
 
 const FKNActionCostRow* UKNDataManagerSubsystem::GetActionCost(const FName& RowName) const
 {
-    UKNGameInstance* GI = Cast<UKNGameInstance>(GetGameInstance());
-    return (GI && GI->GetActionCostTable()) ? GI->GetActionCostTable()->FindRow<FKNActionCostRow>(RowName, TEXT("GetActionCost")) : nullptr;
+    return ActionCostCache.Find(RowName);
 }
 
 const FKNJumpSettingRow* UKNDataManagerSubsystem::GetJumpSetting(const FName& RowName) const
 {
-    UKNGameInstance* GI = Cast<UKNGameInstance>(GetGameInstance());
-    return (GI && GI->GetJumpSettingTable()) ? GI->GetJumpSettingTable()->FindRow<FKNJumpSettingRow>(RowName, TEXT("GetJumpSetting")) : nullptr;
+    return JumpSettingCache.Find(RowName);
 }
 
 const FKNComboAttackRow* UKNDataManagerSubsystem::GetDrawnComboAttackData(const FName& RowName) const
 {
-    UKNGameInstance* GI = Cast<UKNGameInstance>(GetGameInstance());
-    return (GI && GI->GetDrawnComboAttackTable())
-        ? GI->GetDrawnComboAttackTable()->FindRow<FKNComboAttackRow>(RowName, TEXT("GetDrawnComboAttackData"))
-        : nullptr;
+    return DrawnComboAttackCache.Find(RowName);
 }
 
 const FKNComboAttackRow* UKNDataManagerSubsystem::GetSheathComboAttackData(const FName& RowName) const
 {
-    UKNGameInstance* GI = Cast<UKNGameInstance>(GetGameInstance());
-    return (GI && GI->GetSheathComboAttackTable())
-        ? GI->GetSheathComboAttackTable()->FindRow<FKNComboAttackRow>(RowName, TEXT("GetSheathComboAttackData"))
-        : nullptr;
+    return SheathComboAttackCache.Find(RowName);
 }
 
 const FKNOverclockSettingRow* UKNDataManagerSubsystem::GetOverclockSetting(const FName& RowName) const
 {
-    UKNGameInstance* GI = Cast<UKNGameInstance>(GetGameInstance());
-    return (GI && GI->GetOverclockSettingTable()) ? GI->GetOverclockSettingTable()->FindRow<FKNOverclockSettingRow>(RowName, TEXT("GetOverclockSetting")) : nullptr;
+    return OverclockSettingCache.Find(RowName);
 }
 
 const FKNOverclockLv1Row* UKNDataManagerSubsystem::GetOverclockLv1Setting(const FName& RowName) const
 {
-    UKNGameInstance* GI = Cast<UKNGameInstance>(GetGameInstance());
-    return (GI && GI->GetOverclockLv1Table()) ? GI->GetOverclockLv1Table()->FindRow<FKNOverclockLv1Row>(RowName, TEXT("GetOverclockLv1Setting")) : nullptr;
+    return OverclockLv1Cache.Find(RowName);
 }
 
 const FKNOverclockLv2Row* UKNDataManagerSubsystem::GetOverclockLv2Setting(const FName& RowName) const
 {
-    UKNGameInstance* GI = Cast<UKNGameInstance>(GetGameInstance());
-    return (GI && GI->GetOverclockLv2Table()) ? GI->GetOverclockLv2Table()->FindRow<FKNOverclockLv2Row>(RowName, TEXT("GetOverclockLv2Setting")) : nullptr;
+    return OverclockLv2Cache.Find(RowName);
 }
 
 const FKNOverclockLv3Row* UKNDataManagerSubsystem::GetOverclockLv3Setting(const FName& RowName) const
 {
-    UKNGameInstance* GI = Cast<UKNGameInstance>(GetGameInstance());
-    return (GI && GI->GetOverclockLv3Table()) ? GI->GetOverclockLv3Table()->FindRow<FKNOverclockLv3Row>(RowName, TEXT("GetOverclockLv3Setting")) : nullptr;
+    return OverclockLv3Cache.Find(RowName);
 }
 
 const FKNChronosSettingRow* UKNDataManagerSubsystem::GetChronosSetting(const FName& RowName) const
 {
-    UKNGameInstance* GI = Cast<UKNGameInstance>(GetGameInstance());
-    return (GI && GI->GetChronosSettingTable()) ? GI->GetChronosSettingTable()->FindRow<FKNChronosSettingRow>(RowName, TEXT("GetChronosSetting")) : nullptr;
+    return ChronosSettingCache.Find(RowName);
 }
 
 const FKNEnemyBaseStatRow* UKNDataManagerSubsystem::GetEnemyStat(const FName& RowName) const
 {
-    UKNGameInstance* GI = Cast<UKNGameInstance>(GetGameInstance());
-    return (GI && GI->GetEnemyStatTable()) ? GI->GetEnemyStatTable()->FindRow<FKNEnemyBaseStatRow>(RowName, TEXT("GetEnemyStat")) : nullptr;
+    return EnemyStatCache.Find(RowName);
 }
 
 const FKNEnemyRangedStatRow* UKNDataManagerSubsystem::GetEnemyRangedStat(const FName& RowName) const
 {
-    UKNGameInstance* GI = Cast<UKNGameInstance>(GetGameInstance());
-    return (GI && GI->GetEnemyRangedTable()) ? GI->GetEnemyRangedTable()->FindRow<FKNEnemyRangedStatRow>(RowName, TEXT("GetEnemyRangedStat")) : nullptr;
+    return EnemyRangedStatCache.Find(RowName);
 }
 
 const FKNBossPhaseRow* UKNDataManagerSubsystem::GetBossPhase(const FName& RowName) const
 {
-    UKNGameInstance* GI = Cast<UKNGameInstance>(GetGameInstance());
-    return (GI && GI->GetBossPhaseTable()) ? GI->GetBossPhaseTable()->FindRow<FKNBossPhaseRow>(RowName, TEXT("GetBossPhase")) : nullptr;
+    return BossPhaseCache.Find(RowName);
 }
-#pragma endregion 글로벌 데이터 조회 구현
\ No newline at end of file
+#pragma endregion 글로벌 데이터 조회 구현
+
+#pragma region 조회 비용 벤치마크
+#if !UE_BUILD_SHIPPING
+/**
+ * @brief KN.Data.Benchmark [반복 횟수]
+ * 기본 스탯 "Default" 행을 기존 FindRow 경로 / 이름 캐시 경로 / 정수 핸들 경로로 각각 N회 조회하여
+ * 1회당 평균 비용(ns)을 로그로 출력합니다.
+ */
+static FAutoConsoleCommandWithWorldAndArgs GKNDataBenchmarkCommand(
+    TEXT("KN.Data.Benchmark"),
+    TEXT("데이터 테이블 조회 비용 비교: FindRow vs 평탄화 캐시. 사용법: KN.Data.Benchmark [Iterations]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+        const UKNGameInstance* GI = Cast<UKNGameInstance>(GameInstance);
+        const UKNDataManagerSubsystem* DataManager = GameInstance ? GameInstance->GetSubsystem<UKNDataManagerSubsystem>() : nullptr;
+        const UDataTable* Table = GI ? GI->GetPlayerBaseStatTable() : nullptr;
+        if (!DataManager || !Table || !DataManager->IsDataReady())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[KNDataManagerSubsystem] 벤치마크 대상 테이블이 준비되지 않았습니다."));
+            return;
+        }
+
+        const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000;
+        const FName RowName = TKNDataRowCache<FKNBaseStatRow>::GetDefaultRowName();
+        const TKNDataRowCache<FKNBaseStatRow>& Cache = DataManager->GetPlayerBaseStatCache();
+        const TKNDataRowId<FKNBaseStatRow> RowId = Cache.FindId(RowName);
+
+        // 최적화로 루프가 제거되지 않도록 결과를 누적합니다.
+        float Sink = 0.0f;
+
+        const double FindRowStart = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            if (const FKNBaseStatRow* Row = Table->FindRow<FKNBaseStatRow>(RowName, TEXT(""), false))
+            {
+                Sink += Row->MovementSpeed;
+            }
+        }
+        const double FindRowSec = FPlatformTime::Seconds() - FindRowStart;
+
+        const double NameStart = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            if (const FKNBaseStatRow* Row = Cache.Find(RowName))
+            {
+                Sink += Row->MovementSpeed;
+            }
+        }
+        const double NameSec = FPlatformTime::Seconds() - NameStart;
+
+        const double HandleStart = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            if (const FKNBaseStatRow* Row = Cache.Get(RowId))
+            {
+                Sink += Row->MovementSpeed;
+            }
+        }
+        const double HandleSec = FPlatformTime::Seconds() - HandleStart;
+
+        const double ToNs = 1.0e9 / Iterations;
+        UE_LOG(LogTemp, Log,
+            TEXT("[KNDataManagerSubsystem] %d회 조회 — FindRow: %.1f ns / 이름 캐시: %.1f ns / 정수 핸들: %.1f ns (Sink=%.0f)"),
+            Iterations, FindRowSec * ToNs, NameSec * ToNs, HandleSec * ToNs, Sink);
+    }));
+#endif
+#pragma endregion 조회 비용 벤치마크
@@ -0,0 +1,266 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/KNHitQueueSubsystem.h"
+#include "AbilitySystemComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
+#include "GAS/Components/KNStatsComponent.h"
+#include "GAS/Effects/KNDamageEffect.h"
+#include "Framework/System/KNCombatVFXSubsystem.h"
+#include "NiagaraSystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+
+#pragma region 피격 큐 틱 함수 구현
+void FKNHitQueueTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    if (Owner)
+    {
+        Owner->Flush();
+    }
+}
+
+FString FKNHitQueueTickFunction::DiagnosticMessage()
+{
+    return TEXT("FKNHitQueueTickFunction");
+}
+
+FName FKNHitQueueTickFunction::DiagnosticContext(bool bDetailed)
+{
+    return FName(TEXT("KNHitQueue"));
+}
+#pragma endregion 피격 큐 틱 함수 구현
+
+#pragma region 서브시스템 생명주기 구현
+void UKNHitQueueSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // 모든 액터 · 타이머 · 애님 노티파이가 끝난 뒤 해결하여 같은 프레임의 피격을 빠짐없이 모읍니다.
+    TickFunction.Owner = this;
+    TickFunction.TickGroup = TG_PostUpdateWork;
+    TickFunction.bCanEverTick = true;
+    TickFunction.bStartWithTickEnabled = true;
+    TickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UKNHitQueueSubsystem::Deinitialize()
+{
+    if (TickFunction.IsTickFunctionRegistered())
+    {
+        TickFunction.UnRegisterTickFunction();
+    }
+    TickFunction.Owner = nullptr;
+
+    PendingHits.Empty();
+    ResolvingHits.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UKNHitQueueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+#pragma endregion 서브시스템 생명주기 구현
+
+#pragma region 피격 큐 인터페이스 구현
+UKNHitQueueSubsystem* UKNHitQueueSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = GEngine
+        ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+        : nullptr;
+    return World ? World->GetSubsystem<UKNHitQueueSubsystem>() : nullptr;
+}
+
+void UKNHitQueueSubsystem::Enqueue(FKNHitRecord&& Record)
+{
+    PendingHits.Add(MoveTemp(Record));
+}
+
+void UKNHitQueueSubsystem::Flush()
+{
+    if (PendingHits.IsEmpty()) return;
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // 해결 중 콜백(사망 처리 등)에서 들어오는 피격은 비워진 PendingHits에 쌓여 다음 프레임에 처리됩니다.
+    Swap(PendingHits, ResolvingHits);
+
+    ResolveDamage();
+    ResolveOverclock();
+    ResolveVFX();
+
+    const int32 NumHits = ResolvingHits.Num();
+    ResolvingHits.Reset();
+
+    const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    Stats.LastFrameHits = NumHits;
+    Stats.PeakFrameHits = FMath::Max(Stats.PeakFrameHits, NumHits);
+    Stats.TotalHits += NumHits;
+    ++Stats.ResolvedFrames;
+    Stats.LastResolveMs = ElapsedMs;
+    Stats.TotalResolveMs += ElapsedMs;
+}
+#pragma endregion 피격 큐 인터페이스 구현
+
+#pragma region 내부 헬퍼 함수 구현
+void UKNHitQueueSubsystem::ResolveDamage()
+{
+    // 합산 대표 레코드 인덱스와 누적 데미지 (프레임당 피격 수가 적으므로 선형 탐색)
+    TArray<int32, TInlineAllocator<16>> Leaders;
+    TArray<float, TInlineAllocator<16>> Totals;
+
+    for (int32 Index = 0; Index < ResolvingHits.Num(); ++Index)
+    {
+        const FKNHitRecord& Record = ResolvingHits[Index];
+        if (!Record.DamageGEClass || !Record.SourceASC.IsValid() || !Record.TargetASC.IsValid()) continue;
+
+        const float Damage = Record.BaseDamage * Record.DamageMultiplier;
+        if (Damage <= 0.0f) continue;
+
+        int32 Slot = INDEX_NONE;
+        for (int32 LeaderSlot = 0; LeaderSlot < Leaders.Num(); ++LeaderSlot)
+        {
+            const FKNHitRecord& Leader = ResolvingHits[Leaders[LeaderSlot]];
+            if (Leader.SourceASC == Record.SourceASC
+                && Leader.TargetASC == Record.TargetASC
+                && Leader.DamageGEClass == Record.DamageGEClass)
+            {
+                Slot = LeaderSlot;
+                break;
+            }
+        }
+
+        if (Slot == INDEX_NONE)
+        {
+            Leaders.Add(Index);
+            Totals.Add(Damage);
+        }
+        else
+        {
+            Totals[Slot] += Damage;
+        }
+    }
+
+    for (int32 Slot = 0; Slot < Leaders.Num(); ++Slot)
+    {
+        const FKNHitRecord& Leader = ResolvingHits[Leaders[Slot]];
+
+        // 앞선 적용의 콜백으로 대상이 파괴되었을 수 있으므로 다시 확인합니다.
+        UAbilitySystemComponent* TargetASC = Leader.TargetASC.Get();
+        if (!TargetASC) continue;
+
+        FGameplayEffectSpecHandle DmgSpec = UKNAbilitySystemComponent::MakePooledSpec(
+            Leader.SourceASC.Get(), Leader.DamageGEClass, 1.0f,
+            Leader.Instigator.Get(), Leader.EffectCauser.Get());
+
+        if (FGameplayEffectSpec* Spec = DmgSpec.Data.Get())
+        {
+            if (Leader.bHasHitResult)
+            {
+                Spec->GetContext().AddHitResult(Leader.Hit, true);
+            }
+
+            // 배율은 합산 단계에서 이미 곱해졌습니다.
+            UKNDamageExecution::SetDamage(*Spec, Totals[Slot]);
+            TargetASC->ApplyGameplayEffectSpecToSelf(*Spec);
+            ++Stats.DamageApplications;
+        }
+    }
+}
+
+void UKNHitQueueSubsystem::ResolveOverclock()
+{
+    TArray<TPair<UKNStatsComponent*, float>, TInlineAllocator<4>> Gains;
+
+    for (const FKNHitRecord& Record : ResolvingHits)
+    {
+        UKNStatsComponent* Receiver = Record.OverclockReceiver.Get();
+        if (!Receiver || Record.OverclockGain <= 0.0f) continue;
+
+        TPair<UKNStatsComponent*, float>* Existing =
+            Gains.FindByPredicate([Receiver](const TPair<UKNStatsComponent*, float>& Pair) { return Pair.Key == Receiver; });
+
+        if (Existing)
+        {
+            Existing->Value += Record.OverclockGain;
+        }
+        else
+        {
+            Gains.Emplace(Receiver, Record.OverclockGain);
+        }
+    }
+
+    for (const TPair<UKNStatsComponent*, float>& Gain : Gains)
+    {
+        Gain.Key->GainOverclockPoint(Gain.Value);
+        ++Stats.OverclockApplications;
+    }
+}
+
+void UKNHitQueueSubsystem::ResolveVFX()
+{
+    UKNCombatVFXSubsystem* VFX = UKNCombatVFXSubsystem::Get(this);
+    if (!VFX) return;
+
+    constexpr float MergeDistSq = VFXMergeDistance * VFXMergeDistance;
+    TArray<TPair<const UNiagaraSystem*, FVector>, TInlineAllocator<16>> Spawned;
+
+    for (const FKNHitRecord& Record : ResolvingHits)
+    {
+        if (!Record.HitVFX) continue;
+
+        const bool bDuplicate = Spawned.ContainsByPredicate([&Record, MergeDistSq](const TPair<const UNiagaraSystem*, FVector>& Pair)
+        {
+            return Pair.Key == Record.HitVFX && FVector::DistSquared(Pair.Value, Record.VFXLocation) <= MergeDistSq;
+        });
+        if (bDuplicate) continue;
+
+        Spawned.Emplace(Record.HitVFX, Record.VFXLocation);
+
+        // 적중 스파크는 풀에서 재사용하며, 예산 초과·원거리 스폰은 VFX 서비스가 생략합니다.
+        if (VFX->SpawnAtLocation(Record.HitVFX, Record.VFXLocation, Record.VFXRotation, EKNVFXPriority::Cosmetic))
+        {
+            ++Stats.VFXSpawned;
+        }
+    }
+}
+#pragma endregion 내부 헬퍼 함수 구현
+
+#pragma region 피격 큐 통계
+#if !UE_BUILD_SHIPPING
+namespace
+{
+    /** @brief 현재 월드의 피격 큐 통계를 출력합니다. ("reset" 인자 시 출력 후 초기화) */
+    FAutoConsoleCommandWithWorldAndArgs GKNHitQueueStatsCommand(
+        TEXT("KN.Combat.HitQueueStats"),
+        TEXT("프레임당 피격 수, 병합 후 적용 횟수, 해결 소요 시간을 출력합니다. 인자 reset 시 통계를 초기화합니다."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            UKNHitQueueSubsystem* Queue = World ? World->GetSubsystem<UKNHitQueueSubsystem>() : nullptr;
+            if (!Queue)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[KNHitQueueSubsystem] 이 월드에는 피격 큐가 없습니다."));
+                return;
+            }
+
+            const FKNHitQueueStats& Stats = Queue->GetStats();
+            const double AvgMs = Stats.ResolvedFrames > 0 ? Stats.TotalResolveMs / Stats.ResolvedFrames : 0.0;
+            const double AvgHits = Stats.ResolvedFrames > 0 ? static_cast<double>(Stats.TotalHits) / Stats.ResolvedFrames : 0.0;
+
+            UE_LOG(LogTemp, Log,
+                TEXT("[KNHitQueueSubsystem] 피격 %d건 / %d프레임 (평균 %.2f, 최대 %d, 최근 %d) — 데미지 GE %d, 오버클럭 %d, VFX %d — 해결 최근 %.3f ms / 평균 %.3f ms"),
+                Stats.TotalHits, Stats.ResolvedFrames, AvgHits, Stats.PeakFrameHits, Stats.LastFrameHits,
+                Stats.DamageApplications, Stats.OverclockApplications, Stats.VFXSpawned,
+                Stats.LastResolveMs, AvgMs);
+
+            if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+            {
+                Queue->ResetStats();
+            }
+        }));
+}
+#endif
+#pragma endregion 피격 큐 통계
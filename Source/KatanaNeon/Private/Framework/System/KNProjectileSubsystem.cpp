@@ -0,0 +1,462 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/KNProjectileSubsystem.h"
+#include "Framework/System/KNHitQueueSubsystem.h"
+#include "Framework/System/KNCollisionChannels.h"
+#include "Characters/Base/KNCharacterBase.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemInterface.h"
+#include "GameplayEffect.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+
+#pragma region 발사체 틱 함수 구현
+void FKNProjectileTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    if (Owner && TickType != LEVELTICK_ViewportsOnly)
+    {
+        Owner->Tick(DeltaTime);
+    }
+}
+
+FString FKNProjectileTickFunction::DiagnosticMessage()
+{
+    return TEXT("FKNProjectileTickFunction");
+}
+
+FName FKNProjectileTickFunction::DiagnosticContext(bool bDetailed)
+{
+    return FName(TEXT("KNProjectile"));
+}
+#pragma endregion 발사체 틱 함수 구현
+
+#pragma region 서브시스템 생명주기 구현
+void UKNProjectileSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // 시간 레이어(고우선순위 PrePhysics)가 배율을 확정한 뒤, 물리 이전에 전진합니다.
+    TickFunction.Owner = this;
+    TickFunction.TickGroup = TG_PrePhysics;
+    TickFunction.bCanEverTick = true;
+    TickFunction.bStartWithTickEnabled = true;
+    TickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UKNProjectileSubsystem::Deinitialize()
+{
+    if (TickFunction.IsTickFunctionRegistered())
+    {
+        TickFunction.UnRegisterTickFunction();
+    }
+    TickFunction.Owner = nullptr;
+
+    for (UNiagaraComponent* Comp : BoundProxies)
+    {
+        if (IsValid(Comp))
+        {
+            Comp->DestroyComponent();
+        }
+    }
+    for (TPair<TObjectPtr<UNiagaraSystem>, FKNProjectileProxyBucket>& Pair : ProxyPool)
+    {
+        for (UNiagaraComponent* Comp : Pair.Value.Free)
+        {
+            if (IsValid(Comp))
+            {
+                Comp->DestroyComponent();
+            }
+        }
+    }
+    ProxyPool.Empty();
+
+    Positions.Empty();
+    Velocities.Empty();
+    RemainingLife.Empty();
+    DilationScales.Empty();
+    Owners.Empty();
+    Payloads.Empty();
+    PendingSweeps.Empty();
+    BoundProxies.Empty();
+    NumBoundProxies = 0;
+
+    Super::Deinitialize();
+}
+
+bool UKNProjectileSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+#pragma endregion 서브시스템 생명주기 구현
+
+#pragma region 발사 인터페이스 구현
+UKNProjectileSubsystem* UKNProjectileSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = GEngine
+        ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+        : nullptr;
+    return World ? World->GetSubsystem<UKNProjectileSubsystem>() : nullptr;
+}
+
+bool UKNProjectileSubsystem::Launch(const FKNProjectileLaunchParams& Params)
+{
+    if (Params.LifeTime <= 0.0f || Positions.Num() >= MaxProjectiles)
+    {
+        ++Stats.Rejected;
+        return false;
+    }
+
+    Positions.Add(Params.Location);
+    Velocities.Add(Params.Velocity);
+    RemainingLife.Add(Params.LifeTime);
+    DilationScales.Add(1.0f);
+    Owners.Add(Params.Owner);
+
+    FPayload& Payload = Payloads.AddDefaulted_GetRef();
+    Payload.SourceASC = Params.SourceASC;
+    Payload.DamageGEClass = Params.DamageGEClass;
+    Payload.GrogyGEClass = Params.GrogyGEClass;
+    Payload.ProxySystem = Params.ProxySystem;
+    Payload.Shape = Params.Shape;
+    Payload.BaseDamage = Params.BaseDamage;
+    Payload.GrogyDuration = Params.GrogyDuration;
+    Payload.Team = Params.Team;
+
+    PendingSweeps.AddDefaulted();
+    BoundProxies.Add(nullptr);
+
+    ++Stats.Launched;
+    Stats.PeakLive = FMath::Max(Stats.PeakLive, Positions.Num());
+    return true;
+}
+
+void UKNProjectileSubsystem::Tick(float DeltaTime)
+{
+    UWorld* World = GetWorld();
+    if (!World || Positions.IsEmpty()) return;
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    ResolvePendingSweeps(*World);
+    UpdateDilation();
+    Integrate(*World, DeltaTime);
+    RemoveDead();
+    UpdateProxies(*World);
+
+    const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    Stats.LastTickMs = ElapsedMs;
+    Stats.PeakTickMs = FMath::Max(Stats.PeakTickMs, ElapsedMs);
+}
+#pragma endregion 발사 인터페이스 구현
+
+#pragma region 내부 헬퍼 함수 구현
+void UKNProjectileSubsystem::ResolvePendingSweeps(UWorld& World)
+{
+    FTraceDatum Datum;
+    for (int32 i = 0; i < PendingSweeps.Num(); ++i)
+    {
+        FTraceHandle& Handle = PendingSweeps[i];
+        if (!Handle.IsValid()) continue;
+
+        const bool bReady = World.QueryTraceData(Handle, Datum);
+        Handle = FTraceHandle();
+        if (!bReady || RemainingLife[i] < 0.0f) continue;
+
+        if (ProcessSweepHits(i, Datum.OutHits))
+        {
+            Kill(i);
+        }
+    }
+}
+
+void UKNProjectileSubsystem::UpdateDilation()
+{
+    const UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this);
+    if (!TimeDilation) return;
+
+    // 배율은 진영·필드 레이어만으로 정해지므로 액터 등록 없이 위치 질의로 계산합니다.
+    for (int32 i = 0; i < Positions.Num(); ++i)
+    {
+        DilationScales[i] = TimeDilation->GetPointScale(Positions[i], Payloads[i].Team, EKNTimeBody::Projectile);
+    }
+}
+
+void UKNProjectileSubsystem::Integrate(UWorld& World, float DeltaTime)
+{
+    FCollisionObjectQueryParams ObjectParams;
+    ObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+    ObjectParams.AddObjectTypesToQuery(KatanaNeon::Collision::Hurtbox);
+
+    // 발사체마다 소유자 무시 목록을 만들지 않고 배치 전체가 파라미터 하나를 공유합니다. 소유자는 ProcessSweepHits에서 거릅니다.
+    const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(KNProjectileSweep), false);
+
+    TArray<FHitResult> Hits;
+    for (int32 i = 0; i < Positions.Num(); ++i)
+    {
+        if (RemainingLife[i] < 0.0f) continue;
+
+        // 시간 정지 중인 발사체는 수명도 흐르지 않습니다.
+        const float Step = DeltaTime * DilationScales[i];
+        if (Step <= 0.0f) continue;
+
+        RemainingLife[i] -= Step;
+        if (RemainingLife[i] <= 0.0f)
+        {
+            ++Stats.Expired;
+            Kill(i);
+            continue;
+        }
+
+        const FVector Start = Positions[i];
+        const FVector End = Start + Velocities[i] * Step;
+        Positions[i] = End;
+
+        const FQuat Rotation = Velocities[i].ToOrientationQuat();
+        const FPayload& Payload = Payloads[i];
+
+        ++Stats.Sweeps;
+        if (bUseAsyncSweeps)
+        {
+            PendingSweeps[i] = World.AsyncSweepByObjectType(
+                EAsyncTraceType::Multi, Start, End, Rotation, ObjectParams, Payload.Shape, QueryParams);
+        }
+        else
+        {
+            Hits.Reset();
+            World.SweepMultiByObjectType(Hits, Start, End, Rotation, ObjectParams, Payload.Shape, QueryParams);
+            if (ProcessSweepHits(i, Hits))
+            {
+                Kill(i);
+            }
+        }
+    }
+}
+
+bool UKNProjectileSubsystem::ProcessSweepHits(int32 Index, TArray<FHitResult>& Hits)
+{
+    if (Hits.IsEmpty()) return false;
+    if (Hits.Num() > 1)
+    {
+        Hits.Sort([](const FHitResult& A, const FHitResult& B) { return A.Time < B.Time; });
+    }
+
+    const EKNTimeTeam Team = Payloads[Index].Team;
+    const AActor* Owner = Owners[Index].Get();
+    for (const FHitResult& Hit : Hits)
+    {
+        const UPrimitiveComponent* HitComp = Hit.GetComponent();
+        if (!HitComp || Hit.GetActor() == Owner) continue;
+
+        if (HitComp->GetCollisionObjectType() == ECC_WorldStatic)
+        {
+            ++Stats.WorldHits;
+            return true;
+        }
+
+        // 같은 진영 허트박스와 사망(허트박스 비활성 직전) 캐릭터는 통과합니다.
+        const AKNCharacterBase* Target = Cast<AKNCharacterBase>(Hit.GetActor());
+        if (!Target || Target->GetTimeTeam() == Team) continue;
+
+        ApplyCharacterHit(Index, Hit.GetActor(), Hit);
+        ++Stats.CharacterHits;
+        return true;
+    }
+    return false;
+}
+
+void UKNProjectileSubsystem::ApplyCharacterHit(int32 Index, AActor* TargetActor, const FHitResult& Hit)
+{
+    const FPayload& Payload = Payloads[Index];
+    UAbilitySystemComponent* SourceASC = Payload.SourceASC.Get();
+    const IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(TargetActor);
+    UAbilitySystemComponent* TargetASC = ASI ? ASI->GetAbilitySystemComponent() : nullptr;
+    if (!SourceASC || !TargetASC) return;
+
+    // ── 1. 데미지 GE — 프레임 말 피격 큐에서 일괄 적용 ──
+    if (Payload.DamageGEClass)
+    {
+        if (UKNHitQueueSubsystem* HitQueue = UKNHitQueueSubsystem::Get(this))
+        {
+            FKNHitRecord Record;
+            Record.SourceASC = SourceASC;
+            Record.TargetASC = TargetASC;
+            Record.DamageGEClass = Payload.DamageGEClass;
+            Record.BaseDamage = Payload.BaseDamage;
+            Record.Instigator = Owners[Index];
+            Record.EffectCauser = Owners[Index];
+            Record.Hit = Hit;
+            Record.bHasHitResult = true;
+            HitQueue->Enqueue(MoveTemp(Record));
+        }
+    }
+
+    // ── 2. 그로기 Duration GE — 같은 프레임의 후속 판정이 상태를 보도록 즉시 적용 ──
+    if (Payload.GrogyGEClass)
+    {
+        FGameplayEffectContextHandle Context = SourceASC->MakeEffectContext();
+        FGameplayEffectSpecHandle GrogySpec = SourceASC->MakeOutgoingSpec(Payload.GrogyGEClass, 1.0f, Context);
+        if (FGameplayEffectSpec* Spec = GrogySpec.Data.Get())
+        {
+            Spec->SetDuration(Payload.GrogyDuration, true);
+            TargetASC->ApplyGameplayEffectSpecToSelf(*Spec);
+        }
+    }
+}
+
+void UKNProjectileSubsystem::RemoveDead()
+{
+    if (!bHasDead) return;
+    bHasDead = false;
+
+    // 뒤에서부터 스왑 제거하여 아직 검사하지 않은 인덱스가 밀리지 않게 합니다.
+    for (int32 i = Positions.Num() - 1; i >= 0; --i)
+    {
+        if (RemainingLife[i] >= 0.0f) continue;
+
+        ReleaseProxy(i);
+        Positions.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        Velocities.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        RemainingLife.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        DilationScales.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        Owners.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        Payloads.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        PendingSweeps.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        BoundProxies.RemoveAtSwap(i, 1, EAllowShrinking::No);
+    }
+}
+
+void UKNProjectileSubsystem::UpdateProxies(UWorld& World)
+{
+    const APlayerController* PC = World.GetFirstPlayerController();
+    const APlayerCameraManager* Camera = PC ? PC->PlayerCameraManager.Get() : nullptr;
+    if (!Camera) return;
+
+    const FVector CameraLocation = Camera->GetCameraLocation();
+    const FVector CameraForward = Camera->GetCameraRotation().Vector();
+    const float MaxDistSq = FMath::Square(ProxyCullDistance);
+    // 화면 가장자리에서 튀어나오지 않도록 시야각보다 조금 넓게 봅니다.
+    const float CosHalfFov = FMath::Cos(FMath::DegreesToRadians(FMath::Min(Camera->GetFOVAngle() * 0.5f + 15.0f, 89.0f)));
+
+    for (int32 i = 0; i < Positions.Num(); ++i)
+    {
+        const FVector ToProjectile = Positions[i] - CameraLocation;
+        const float DistSq = ToProjectile.SizeSquared();
+        const bool bVisible = DistSq <= MaxDistSq
+            && (DistSq < KINDA_SMALL_NUMBER || FVector::DotProduct(ToProjectile, CameraForward) >= CosHalfFov * FMath::Sqrt(DistSq));
+
+        UNiagaraComponent* Proxy = BoundProxies[i];
+        if (!bVisible)
+        {
+            if (Proxy) ReleaseProxy(i);
+            continue;
+        }
+
+        if (!Proxy)
+        {
+            if (NumBoundProxies >= MaxBoundProxies) continue;
+            BindProxy(World, i);
+            Proxy = BoundProxies[i];
+            if (!Proxy) continue;
+        }
+
+        Proxy->SetWorldLocationAndRotation(Positions[i], Velocities[i].Rotation());
+        if (!FMath::IsNearlyEqual(Proxy->GetCustomTimeDilation(), DilationScales[i]))
+        {
+            Proxy->SetCustomTimeDilation(DilationScales[i]);
+        }
+    }
+}
+
+void UKNProjectileSubsystem::BindProxy(UWorld& World, int32 Index)
+{
+    UNiagaraSystem* System = Payloads[Index].ProxySystem.Get();
+    if (!System) return;
+
+    FKNProjectileProxyBucket& Bucket = ProxyPool.FindOrAdd(System);
+
+    UNiagaraComponent* Comp = nullptr;
+    while (!Comp && !Bucket.Free.IsEmpty())
+    {
+        UNiagaraComponent* Candidate = Bucket.Free.Pop(EAllowShrinking::No);
+        Comp = IsValid(Candidate) ? Candidate : nullptr;
+    }
+
+    if (!Comp)
+    {
+        // 전투 VFX 풀과 같이 월드를 Outer로 두되, 루프 시스템이므로 발사체 제거 시 직접 회수합니다.
+        Comp = NewObject<UNiagaraComponent>(&World);
+        Comp->SetAutoDestroy(false);
+        Comp->bAutoActivate = false;
+        Comp->SetAsset(System);
+        Comp->RegisterComponentWithWorld(&World);
+    }
+
+    Comp->SetWorldLocationAndRotation(Positions[Index], Velocities[Index].Rotation());
+    Comp->Activate(true);
+
+    BoundProxies[Index] = Comp;
+    ++NumBoundProxies;
+    ++Stats.ProxyBinds;
+}
+
+void UKNProjectileSubsystem::ReleaseProxy(int32 Index)
+{
+    UNiagaraComponent* Comp = BoundProxies[Index];
+    if (!Comp) return;
+
+    BoundProxies[Index] = nullptr;
+    --NumBoundProxies;
+
+    if (!IsValid(Comp)) return;
+
+    Comp->DeactivateImmediate();
+    if (FKNProjectileProxyBucket* Bucket = ProxyPool.Find(Comp->GetAsset()))
+    {
+        Bucket->Free.Add(Comp);
+    }
+    else
+    {
+        Comp->DestroyComponent();
+    }
+}
+#pragma endregion 내부 헬퍼 함수 구현
+
+#pragma region 발사체 통계
+#if !UE_BUILD_SHIPPING
+namespace
+{
+    /** @brief 현재 월드의 관리형 발사체 통계를 출력합니다. ("reset" 인자 시 출력 후 초기화) */
+    FAutoConsoleCommandWithWorldAndArgs GKNProjectileStatsCommand(
+        TEXT("KN.Projectile.Stats"),
+        TEXT("관리형 발사체 수, 적중/만료 횟수, 스윕 수와 틱 비용을 출력합니다. 인자 reset 시 통계를 초기화합니다."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            UKNProjectileSubsystem* Projectiles = World ? World->GetSubsystem<UKNProjectileSubsystem>() : nullptr;
+            if (!Projectiles)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[KNProjectileSubsystem] 이 월드에는 발사체 서비스가 없습니다."));
+                return;
+            }
+
+            const FKNProjectileStats& Stats = Projectiles->GetStats();
+            UE_LOG(LogTemp, Log,
+                TEXT("[KNProjectileSubsystem] 발사 %d (거부 %d), 생존 %d (최대 %d) — 적중: 캐릭터 %d, 지형 %d, 만료 %d — 스윕 %d, 프록시 %d (바인딩 %d회) — 틱 %.3fms (최대 %.3fms)"),
+                Stats.Launched, Stats.Rejected, Projectiles->GetNumLive(), Stats.PeakLive,
+                Stats.CharacterHits, Stats.WorldHits, Stats.Expired,
+                Stats.Sweeps, Projectiles->GetNumBoundProxies(), Stats.ProxyBinds,
+                Stats.LastTickMs, Stats.PeakTickMs);
+
+            if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+            {
+                Projectiles->ResetStats();
+            }
+        }));
+}
+#endif
+#pragma endregion 발사체 통계
@@ -0,0 +1,868 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/KNTimeDilationSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/WorldSettings.h"
+#include "Components/SceneComponent.h"
+#include "NiagaraComponent.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Misc/App.h"
+#include "HAL/IConsoleManager.h"
+
+#pragma region 시간 레이어 틱 함수 구현
+void FKNTimeDilationTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    if (Owner)
+    {
+        Owner->Tick();
+    }
+}
+
+FString FKNTimeDilationTickFunction::DiagnosticMessage()
+{
+    return TEXT("FKNTimeDilationTickFunction");
+}
+
+FName FKNTimeDilationTickFunction::DiagnosticContext(bool bDetailed)
+{
+    return FName(TEXT("KNTimeDilation"));
+}
+#pragma endregion 시간 레이어 틱 함수 구현
+
+#pragma region 서브시스템 생명주기 구현
+void UKNTimeDilationSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // 액터 틱보다 먼저 배율을 확정해야 같은 프레임의 이동·애니메이션에 반영됩니다.
+    TickFunction.Owner = this;
+    TickFunction.TickGroup = TG_PrePhysics;
+    TickFunction.bHighPriority = true;
+    TickFunction.bCanEverTick = true;
+    TickFunction.bStartWithTickEnabled = true;
+    TickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UKNTimeDilationSubsystem::Deinitialize()
+{
+    if (TickFunction.IsTickFunctionRegistered())
+    {
+        TickFunction.UnRegisterTickFunction();
+    }
+    TickFunction.Owner = nullptr;
+
+    for (const TPair<TWeakObjectPtr<AActor>, FSuspendedTicks>& Pair : FrozenActors)
+    {
+        ResumeTicks(Pair.Value);
+    }
+    FrozenActors.Empty();
+
+    // 레벨 전환 후에도 살아남는 액터가 감속된 채로 남지 않도록 원래 배율로 되돌립니다.
+    for (const TPair<TWeakObjectPtr<AActor>, FTrackedActor>& Pair : TrackedActors)
+    {
+        if (AActor* Actor = Pair.Key.Get())
+        {
+            Actor->CustomTimeDilation = 1.0f;
+        }
+    }
+
+    const UWorld* World = GetWorld();
+    if (AWorldSettings* WorldSettings = World ? World->GetWorldSettings() : nullptr)
+    {
+        if (AppliedGlobalScale != 1.0f)
+        {
+            WorldSettings->SetTimeDilation(1.0f);
+        }
+    }
+
+    Layers.Empty();
+    TrackedActors.Empty();
+    RealTimers.Empty();
+    FieldCandidates.Empty();
+    SpatialHash.Empty();
+    FieldScratchMembers.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UKNTimeDilationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+#pragma endregion 서브시스템 생명주기 구현
+
+#pragma region 레이어 인터페이스 구현
+UKNTimeDilationSubsystem* UKNTimeDilationSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = GEngine
+        ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+        : nullptr;
+    return World ? World->GetSubsystem<UKNTimeDilationSubsystem>() : nullptr;
+}
+
+FKNTimeLayerHandle UKNTimeDilationSubsystem::PushGlobalLayer(float Scale, int32 Priority)
+{
+    FLayer Layer;
+    Layer.Scope = EKNTimeLayerScope::Global;
+    Layer.Priority = Priority;
+    Layer.Scale = Scale;
+    return AddLayer(MoveTemp(Layer));
+}
+
+FKNTimeLayerHandle UKNTimeDilationSubsystem::PushTeamLayer(EKNTimeTeam Team, float Scale, int32 Priority, bool bRealTime)
+{
+    if (Team == EKNTimeTeam::None) return FKNTimeLayerHandle();
+
+    FLayer Layer;
+    Layer.Scope = EKNTimeLayerScope::Team;
+    Layer.Priority = Priority;
+    Layer.Scale = Scale;
+    Layer.bRealTime = bRealTime;
+    Layer.Team = Team;
+    return AddLayer(MoveTemp(Layer));
+}
+
+FKNTimeLayerHandle UKNTimeDilationSubsystem::PushActorLayer(AActor* Actor, float Scale, int32 Priority, bool bRealTime)
+{
+    if (!IsValid(Actor)) return FKNTimeLayerHandle();
+
+    TrackActor(Actor);
+
+    FLayer Layer;
+    Layer.Scope = EKNTimeLayerScope::Actor;
+    Layer.Priority = Priority;
+    Layer.Scale = Scale;
+    Layer.bRealTime = bRealTime;
+    Layer.Actor = Actor;
+    return AddLayer(MoveTemp(Layer));
+}
+
+FKNTimeLayerHandle UKNTimeDilationSubsystem::PushSphereLayer(int32 Priority)
+{
+    FLayer Layer;
+    Layer.Scope = EKNTimeLayerScope::Sphere;
+    Layer.Priority = Priority;
+    return AddLayer(MoveTemp(Layer));
+}
+
+FKNTimeLayerHandle UKNTimeDilationSubsystem::PushFreezeLayer(EKNTimeTeam Team)
+{
+    if (Team == EKNTimeTeam::None) return FKNTimeLayerHandle();
+
+    FLayer Layer;
+    Layer.Scope = EKNTimeLayerScope::Freeze;
+    Layer.Team = Team;
+    return AddLayer(MoveTemp(Layer));
+}
+
+FKNTimeLayerHandle UKNTimeDilationSubsystem::PushFieldLayer(
+    USceneComponent* Center,
+    float Radius,
+    EKNTimeTeam TargetTeam,
+    float CharacterScale,
+    float ProjectileScale,
+    int32 Priority)
+{
+    if (!IsValid(Center) || TargetTeam == EKNTimeTeam::None) return FKNTimeLayerHandle();
+
+    FLayer Layer;
+    Layer.Scope = EKNTimeLayerScope::Sphere;
+    Layer.Priority = Priority;
+    Layer.Scale = CharacterScale;
+    Layer.Team = TargetTeam;
+    Layer.bField = true;
+    Layer.FieldCenter = Center;
+    Layer.FieldRadius = Radius;
+    Layer.FieldProjectileScale = ProjectileScale;
+
+    // 활성화 프레임에 바로 감속되도록 주기를 기다리지 않고 다음 틱에 채웁니다.
+    bFieldUpdatePending = true;
+    return AddLayer(MoveTemp(Layer));
+}
+
+int32 UKNTimeDilationSubsystem::GetNumLayerMembers(const FKNTimeLayerHandle& Handle) const
+{
+    const FLayer* Layer = Handle.IsValid()
+        ? Layers.FindByPredicate([&Handle](const FLayer& Candidate) { return Candidate.Id == Handle.Id; })
+        : nullptr;
+    return Layer ? Layer->Members.Num() : 0;
+}
+
+void UKNTimeDilationSubsystem::SetSphereMember(const FKNTimeLayerHandle& Handle, AActor* Actor, float Scale)
+{
+    FLayer* Layer = FindLayer(Handle);
+    if (!Layer || Layer->Scope != EKNTimeLayerScope::Sphere || !IsValid(Actor)) return;
+
+    float& MemberScale = Layer->Members.FindOrAdd(Actor, -1.0f);
+    if (MemberScale == Scale) return;
+
+    MemberScale = Scale;
+    TrackActor(Actor);
+    bDirty = true;
+}
+
+void UKNTimeDilationSubsystem::RemoveSphereMember(const FKNTimeLayerHandle& Handle, AActor* Actor)
+{
+    FLayer* Layer = FindLayer(Handle);
+    if (!Layer || Layer->Scope != EKNTimeLayerScope::Sphere) return;
+
+    if (Layer->Members.Remove(Actor) > 0)
+    {
+        bDirty = true;
+    }
+}
+
+void UKNTimeDilationSubsystem::PopLayer(FKNTimeLayerHandle& Handle)
+{
+    if (!Handle.IsValid()) return;
+
+    const int32 Index = Layers.IndexOfByPredicate([&Handle](const FLayer& Layer) { return Layer.Id == Handle.Id; });
+    if (Index != INDEX_NONE)
+    {
+        // 같은 우선순위에서 나중 레이어가 이기므로 추가 순서를 유지한 채 제거합니다.
+        Layers.RemoveAt(Index);
+        bDirty = true;
+    }
+    Handle.Invalidate();
+}
+
+void UKNTimeDilationSubsystem::RegisterActor(AActor* Actor, EKNTimeTeam Team, EKNTimeBody Body)
+{
+    if (!IsValid(Actor)) return;
+
+    FTrackedActor& Tracked = TrackedActors.FindOrAdd(Actor);
+    Tracked.Team = Team;
+    Tracked.Body = Body;
+    Tracked.bRegistered = true;
+    AddFieldCandidate(Actor, Tracked);
+    bDirty = true;
+}
+
+void UKNTimeDilationSubsystem::UnregisterActor(AActor* Actor)
+{
+    FTrackedActor* Tracked = TrackedActors.Find(Actor);
+    if (!Tracked) return;
+
+    // 레이어가 아직 직접 가리키면 추적은 유지하고, 다음 재계산에서 정리합니다.
+    Tracked->Team = EKNTimeTeam::None;
+    Tracked->bRegistered = false;
+    bDirty = true;
+
+    if (Tracked->FieldCandidateIndex != INDEX_NONE)
+    {
+        RemoveFieldCandidate(Tracked->FieldCandidateIndex);
+    }
+
+    // 정지 기록은 즉시 되돌려, 호출자가 이어서 바꾼 틱 상태(풀 반납 등)를 다음 재계산이 덮어쓰지 않게 합니다.
+    FSuspendedTicks Record;
+    if (FrozenActors.RemoveAndCopyValue(Actor, Record))
+    {
+        ResumeTicks(Record);
+    }
+}
+
+float UKNTimeDilationSubsystem::GetPointScale(const FVector& Location, EKNTimeTeam Team, EKNTimeBody Body) const
+{
+    const FLayer* Winner = nullptr;
+    float WinnerScale = 1.0f;
+
+    for (const FLayer& Layer : Layers)
+    {
+        if (Layer.Team != Team || Team == EKNTimeTeam::None) continue;
+
+        float Scale = Layer.Scale;
+        if (Layer.Scope == EKNTimeLayerScope::Freeze)
+        {
+            return 0.0f;
+        }
+        if (Layer.bField)
+        {
+            const USceneComponent* Center = Layer.FieldCenter.Get();
+            if (!Center || FVector::DistSquared(Center->GetComponentLocation(), Location) > FMath::Square(Layer.FieldRadius)) continue;
+            Scale = Body == EKNTimeBody::Projectile ? Layer.FieldProjectileScale : Layer.Scale;
+        }
+        else if (Layer.Scope != EKNTimeLayerScope::Team)
+        {
+            continue;
+        }
+
+        if (!Winner || Layer.Priority >= Winner->Priority)
+        {
+            Winner = &Layer;
+            WinnerScale = Scale;
+        }
+    }
+
+    if (!Winner) return 1.0f;
+    return (Winner->bRealTime && AppliedGlobalScale > UE_SMALL_NUMBER) ? WinnerScale / AppliedGlobalScale : WinnerScale;
+}
+#pragma endregion 레이어 인터페이스 구현
+
+#pragma region 시계 인터페이스 구현
+double UKNTimeDilationSubsystem::GetDilatedTimeSeconds() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void UKNTimeDilationSubsystem::SetRealTimeTimer(FKNRealTimerHandle& InOutHandle, FTimerDelegate Delegate, float Seconds)
+{
+    ClearRealTimeTimer(InOutHandle);
+
+    FRealTimer& Timer = RealTimers.AddDefaulted_GetRef();
+    Timer.Id = ++NextTimerId;
+    Timer.ExpireTime = RealTimeSeconds + FMath::Max(0.0f, Seconds);
+    Timer.Delegate = MoveTemp(Delegate);
+
+    InOutHandle.Id = Timer.Id;
+}
+
+void UKNTimeDilationSubsystem::ClearRealTimeTimer(FKNRealTimerHandle& InOutHandle)
+{
+    if (!InOutHandle.IsValid()) return;
+
+    const uint32 Id = InOutHandle.Id;
+    RealTimers.RemoveAllSwap([Id](const FRealTimer& Timer) { return Timer.Id == Id; }, EAllowShrinking::No);
+    InOutHandle.Invalidate();
+}
+
+void UKNTimeDilationSubsystem::Tick()
+{
+    // FApp 델타는 월드 TimeDilation 적용 전 값이며, 일시정지 중에는 이 틱 자체가 돌지 않습니다.
+    const float RealDeltaTime = FApp::GetDeltaTime();
+    RealTimeSeconds += RealDeltaTime;
+    FireExpiredRealTimers();
+
+    // 필드 멤버는 고정 주기로만 갱신하고, 바뀐 필드가 있으면 같은 틱의 재계산에 합류합니다.
+    if (Layers.ContainsByPredicate([](const FLayer& Layer) { return Layer.bField; }))
+    {
+        FieldAccumulator += RealDeltaTime;
+        if (bFieldUpdatePending || FieldAccumulator >= FieldUpdateInterval)
+        {
+            FieldAccumulator = 0.0f;
+            bFieldUpdatePending = false;
+            UpdateFields();
+        }
+    }
+
+    if (bDirty)
+    {
+        Recompute();
+    }
+}
+
+void UKNTimeDilationSubsystem::DumpLayers() const
+{
+    static const TCHAR* ScopeNames[] = { TEXT("Global"), TEXT("Team"), TEXT("Actor"), TEXT("Sphere"), TEXT("Freeze") };
+
+    for (const FLayer& Layer : Layers)
+    {
+        const AActor* Actor = Layer.Actor.Get();
+        UE_LOG(LogTemp, Log, TEXT("[KNTimeDilationSubsystem]   #%d %s%s P%d x%.4f%s%s (멤버 %d)"),
+            Layer.Id, ScopeNames[static_cast<uint8>(Layer.Scope)], Layer.bField ? TEXT("(Field)") : TEXT(""),
+            Layer.Priority, Layer.Scale,
+            Layer.bRealTime ? TEXT(" RealTime") : TEXT(""),
+            Actor ? *FString::Printf(TEXT(" %s"), *Actor->GetName()) : TEXT(""),
+            Layer.Members.Num());
+    }
+}
+#pragma endregion 시계 인터페이스 구현
+
+#pragma region 내부 헬퍼 함수 구현
+FKNTimeLayerHandle UKNTimeDilationSubsystem::AddLayer(FLayer&& Layer)
+{
+    Layer.Id = NextLayerId++;
+
+    FKNTimeLayerHandle Handle;
+    Handle.Id = Layer.Id;
+
+    Layers.Add(MoveTemp(Layer));
+    ++Stats.LayersPushed;
+    bDirty = true;
+    return Handle;
+}
+
+UKNTimeDilationSubsystem::FLayer* UKNTimeDilationSubsystem::FindLayer(const FKNTimeLayerHandle& Handle)
+{
+    if (!Handle.IsValid()) return nullptr;
+    return Layers.FindByPredicate([&Handle](const FLayer& Layer) { return Layer.Id == Handle.Id; });
+}
+
+void UKNTimeDilationSubsystem::TrackActor(AActor* Actor)
+{
+    TrackedActors.FindOrAdd(Actor);
+}
+
+float UKNTimeDilationSubsystem::ResolveGlobalScale() const
+{
+    const FLayer* Winner = nullptr;
+    for (const FLayer& Layer : Layers)
+    {
+        if (Layer.Scope == EKNTimeLayerScope::Global && (!Winner || Layer.Priority >= Winner->Priority))
+        {
+            Winner = &Layer;
+        }
+    }
+    return Winner ? Winner->Scale : 1.0f;
+}
+
+float UKNTimeDilationSubsystem::ResolveActorScale(const AActor* Actor, EKNTimeTeam Team, float GlobalScale, bool& bOutTargeted) const
+{
+    bOutTargeted = false;
+
+    const FLayer* Winner = nullptr;
+    float WinnerScale = 1.0f;
+
+    for (const FLayer& Layer : Layers)
+    {
+        float Scale = Layer.Scale;
+        switch (Layer.Scope)
+        {
+        case EKNTimeLayerScope::Team:
+            if (Team == EKNTimeTeam::None || Layer.Team != Team) continue;
+            break;
+
+        case EKNTimeLayerScope::Actor:
+            if (Layer.Actor.Get() != Actor) continue;
+            bOutTargeted = true;
+            break;
+
+        case EKNTimeLayerScope::Sphere:
+        {
+            const float* MemberScale = Layer.Members.Find(Actor);
+            if (!MemberScale) continue;
+            Scale = *MemberScale;
+            bOutTargeted = true;
+            break;
+        }
+
+        default:
+            continue;
+        }
+
+        if (!Winner || Layer.Priority >= Winner->Priority)
+        {
+            Winner = &Layer;
+            WinnerScale = Scale;
+        }
+    }
+
+    // 실시간 대비 체감 배율을 구한 뒤 글로벌 배율로 나누어 CustomTimeDilation으로 변환합니다.
+    const float Perceived = !Winner ? GlobalScale
+        : Winner->bRealTime ? WinnerScale
+        : GlobalScale * WinnerScale;
+
+    return GlobalScale > UE_SMALL_NUMBER ? Perceived / GlobalScale : 1.0f;
+}
+
+void UKNTimeDilationSubsystem::Recompute()
+{
+    bDirty = false;
+    ++Stats.Recomputes;
+
+    UWorld* World = GetWorld();
+    AWorldSettings* WorldSettings = World ? World->GetWorldSettings() : nullptr;
+    if (!WorldSettings) return;
+
+    // 파괴된 액터를 가리키는 레이어와 멤버를 정리합니다.
+    for (int32 Index = Layers.Num() - 1; Index >= 0; --Index)
+    {
+        FLayer& Layer = Layers[Index];
+        if (Layer.Scope == EKNTimeLayerScope::Actor && !Layer.Actor.IsValid())
+        {
+            Layers.RemoveAt(Index);
+            continue;
+        }
+        for (auto It = Layer.Members.CreateIterator(); It; ++It)
+        {
+            if (!It.Key().IsValid())
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    const float DesiredGlobal = ResolveGlobalScale();
+    if (WorldSettings->TimeDilation != DesiredGlobal)
+    {
+        WorldSettings->SetTimeDilation(DesiredGlobal);
+        ++Stats.GlobalWrites;
+    }
+    // SetTimeDilation이 Min/MaxGlobalTimeDilation으로 클램프하므로 실제 값을 기준으로 보정합니다.
+    AppliedGlobalScale = WorldSettings->TimeDilation;
+
+    for (auto It = TrackedActors.CreateIterator(); It; ++It)
+    {
+        AActor* Actor = It.Key().Get();
+        if (!Actor)
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+
+        bool bTargeted = false;
+        const float Scale = ResolveActorScale(Actor, It.Value().Team, AppliedGlobalScale, bTargeted);
+
+        if (FMath::IsNearlyEqual(Actor->CustomTimeDilation, Scale))
+        {
+            ++Stats.ActorWritesSkipped;
+        }
+        else
+        {
+            Actor->CustomTimeDilation = Scale;
+            ++Stats.ActorWrites;
+        }
+
+        // 진영 등록도 레이어 참조도 없으면 1.0으로 되돌린 뒤 추적을 끝냅니다.
+        if (!It.Value().bRegistered && !bTargeted)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    ApplyFreezeLayers();
+}
+
+void UKNTimeDilationSubsystem::ApplyFreezeLayers()
+{
+    if (FrozenActors.IsEmpty() && !Layers.ContainsByPredicate([](const FLayer& Layer) { return Layer.Scope == EKNTimeLayerScope::Freeze; }))
+    {
+        return;
+    }
+
+    auto IsTeamFrozen = [this](EKNTimeTeam Team)
+    {
+        return Team != EKNTimeTeam::None && Layers.ContainsByPredicate([Team](const FLayer& Layer)
+        {
+            return Layer.Scope == EKNTimeLayerScope::Freeze && Layer.Team == Team;
+        });
+    };
+
+    // 정지 대상에서 빠진 액터(레이어 제거, 등록 해제, 파괴)는 기록된 틱만 되돌립니다.
+    for (auto It = FrozenActors.CreateIterator(); It; ++It)
+    {
+        const FTrackedActor* Tracked = TrackedActors.Find(It.Key());
+        if (!It.Key().IsValid() || !Tracked || !IsTeamFrozen(Tracked->Team))
+        {
+            ResumeTicks(It.Value());
+            It.RemoveCurrent();
+        }
+    }
+
+    // 정지 중 스폰·등록된 액터도 다음 재계산에서 합류합니다.
+    for (const TPair<TWeakObjectPtr<AActor>, FTrackedActor>& Pair : TrackedActors)
+    {
+        AActor* Actor = Pair.Key.Get();
+        if (!Actor || !IsTeamFrozen(Pair.Value.Team) || FrozenActors.Contains(Pair.Key)) continue;
+
+        FSuspendedTicks& Record = FrozenActors.Add(Pair.Key);
+        SuspendTicks(Actor, Record);
+
+        // AI 컨트롤러의 비헤이비어 트리·경로 추적도 폰과 함께 멈춥니다.
+        if (const APawn* Pawn = Cast<APawn>(Actor))
+        {
+            if (AController* Controller = Pawn->GetController())
+            {
+                SuspendTicks(Controller, Record);
+            }
+        }
+        ++Stats.ActorsFrozen;
+    }
+}
+
+void UKNTimeDilationSubsystem::SuspendTicks(AActor* Actor, FSuspendedTicks& OutRecord)
+{
+    if (Actor->IsActorTickEnabled())
+    {
+        Actor->SetActorTickEnabled(false);
+        OutRecord.Actors.Add(Actor);
+        ++Stats.TicksSuspended;
+    }
+
+    Actor->ForEachComponent(false, [this, &OutRecord](UActorComponent* Component)
+    {
+        // Niagara는 컴포넌트 틱이 아닌 월드 매니저가 시뮬레이션하므로 일시정지로 멈춥니다.
+        if (UNiagaraComponent* Niagara = Cast<UNiagaraComponent>(Component))
+        {
+            if (Niagara->IsActive() && !Niagara->IsPaused())
+            {
+                Niagara->SetPaused(true);
+                OutRecord.PausedNiagara.Add(Niagara);
+            }
+            return;
+        }
+
+        if (Component->IsComponentTickEnabled())
+        {
+            Component->SetComponentTickEnabled(false);
+            OutRecord.Components.Add(Component);
+            ++Stats.TicksSuspended;
+        }
+    });
+}
+
+/*static*/ void UKNTimeDilationSubsystem::ResumeTicks(const FSuspendedTicks& Record)
+{
+    for (const TWeakObjectPtr<AActor>& WeakActor : Record.Actors)
+    {
+        if (AActor* Actor = WeakActor.Get())
+        {
+            Actor->SetActorTickEnabled(true);
+        }
+    }
+    for (const TWeakObjectPtr<UActorComponent>& WeakComponent : Record.Components)
+    {
+        if (UActorComponent* Component = WeakComponent.Get())
+        {
+            Component->SetComponentTickEnabled(true);
+        }
+    }
+    for (const TWeakObjectPtr<UNiagaraComponent>& WeakNiagara : Record.PausedNiagara)
+    {
+        if (UNiagaraComponent* Niagara = WeakNiagara.Get())
+        {
+            Niagara->SetPaused(false);
+        }
+    }
+}
+
+void UKNTimeDilationSubsystem::RefreshSpatialHash()
+{
+    // 빈 셀이 누적되어 버킷 수가 커지면 비우고, 이번 갱신에서 모든 대상 후보를 다시 넣습니다.
+    if (SpatialHash.Num() > 4 * FMath::Max(FieldCandidates.Num(), 16))
+    {
+        SpatialHash.Reset();
+        for (FFieldCandidate& Candidate : FieldCandidates)
+        {
+            Candidate.bHashed = false;
+        }
+    }
+
+    // 어떤 필드도 노리지 않는 진영은 위치를 읽지 않습니다.
+    uint8 TargetTeamMask = 0;
+    for (const FLayer& Layer : Layers)
+    {
+        if (Layer.bField)
+        {
+            TargetTeamMask |= 1 << static_cast<uint8>(Layer.Team);
+        }
+    }
+
+    // 역순으로 돌아, 파괴된 후보 제거 시 빈 자리로 옮겨 오는 마지막 후보는 이미 갱신된 상태가 되게 합니다.
+    for (int32 Index = FieldCandidates.Num() - 1; Index >= 0; --Index)
+    {
+        FFieldCandidate& Candidate = FieldCandidates[Index];
+        const AActor* Actor = Candidate.Actor.Get();
+        if (!Actor)
+        {
+            RemoveFieldCandidate(Index);
+            continue;
+        }
+
+        // 대상이 아닌 진영의 후보는 이전 셀에 남아 있어도 질의가 진영으로 거르므로 그대로 둡니다.
+        if (!(TargetTeamMask & (1 << static_cast<uint8>(Candidate.Team)))) continue;
+
+        Candidate.Location = Actor->GetActorLocation();
+        const FIntPoint Cell = GetFieldCell(Candidate.Location);
+        if (Candidate.bHashed && Candidate.Cell == Cell) continue;
+
+        if (Candidate.bHashed)
+        {
+            RemoveFromFieldCell(Candidate.Cell, Index);
+        }
+        SpatialHash.FindOrAdd(Cell).Add(Index);
+        Candidate.Cell = Cell;
+        Candidate.bHashed = true;
+        ++Stats.FieldCellMoves;
+    }
+}
+
+void UKNTimeDilationSubsystem::AddFieldCandidate(AActor* Actor, FTrackedActor& Tracked)
+{
+    if (Tracked.FieldCandidateIndex == INDEX_NONE)
+    {
+        Tracked.FieldCandidateIndex = FieldCandidates.Num();
+        FieldCandidates.AddDefaulted_GetRef().Actor = Actor;
+    }
+
+    // 셀 배치는 다음 갱신에서 위치를 읽을 때 정해집니다.
+    FFieldCandidate& Candidate = FieldCandidates[Tracked.FieldCandidateIndex];
+    Candidate.Team = Tracked.Team;
+    Candidate.Body = Tracked.Body;
+}
+
+void UKNTimeDilationSubsystem::RemoveFieldCandidate(int32 Index)
+{
+    const FFieldCandidate& Removed = FieldCandidates[Index];
+    if (Removed.bHashed)
+    {
+        RemoveFromFieldCell(Removed.Cell, Index);
+    }
+    if (FTrackedActor* Tracked = TrackedActors.Find(Removed.Actor))
+    {
+        Tracked->FieldCandidateIndex = INDEX_NONE;
+    }
+
+    // 마지막 후보를 빈 자리로 옮기므로, 그 후보를 가리키던 버킷과 추적 정보의 인덱스를 고칩니다.
+    const int32 LastIndex = FieldCandidates.Num() - 1;
+    if (Index != LastIndex)
+    {
+        const FFieldCandidate& Moved = FieldCandidates[LastIndex];
+        if (TArray<int32>* Bucket = Moved.bHashed ? SpatialHash.Find(Moved.Cell) : nullptr)
+        {
+            const int32 Slot = Bucket->Find(LastIndex);
+            if (Slot != INDEX_NONE)
+            {
+                (*Bucket)[Slot] = Index;
+            }
+        }
+        if (FTrackedActor* Tracked = TrackedActors.Find(Moved.Actor))
+        {
+            Tracked->FieldCandidateIndex = Index;
+        }
+    }
+
+    FieldCandidates.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void UKNTimeDilationSubsystem::RemoveFromFieldCell(const FIntPoint& Cell, int32 Index)
+{
+    if (TArray<int32>* Bucket = SpatialHash.Find(Cell))
+    {
+        Bucket->RemoveSingleSwap(Index, EAllowShrinking::No);
+    }
+}
+
+void UKNTimeDilationSubsystem::UpdateFields()
+{
+    ++Stats.FieldUpdates;
+    RefreshSpatialHash();
+
+    for (FLayer& Layer : Layers)
+    {
+        if (!Layer.bField) continue;
+
+        FieldScratchMembers.Reset();
+
+        if (const USceneComponent* Center = Layer.FieldCenter.Get())
+        {
+            const FVector Origin = Center->GetComponentLocation();
+            const float RadiusSq = FMath::Square(Layer.FieldRadius);
+            const FIntPoint MinCell = GetFieldCell(Origin - FVector(Layer.FieldRadius));
+            const FIntPoint MaxCell = GetFieldCell(Origin + FVector(Layer.FieldRadius));
+            const AActor* FieldOwner = Center->GetOwner();
+
+            for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+            {
+                for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+                {
+                    const TArray<int32>* Bucket = SpatialHash.Find(FIntPoint(X, Y));
+                    if (!Bucket) continue;
+
+                    for (const int32 Index : *Bucket)
+                    {
+                        const FFieldCandidate& Candidate = FieldCandidates[Index];
+                        if (Candidate.Team != Layer.Team) continue;
+
+                        ++Stats.FieldCandidatesTested;
+                        if (FVector::DistSquared(Origin, Candidate.Location) > RadiusSq) continue;
+                        if (Candidate.Actor.Get() == FieldOwner) continue;
+
+                        FieldScratchMembers.Add(Candidate.Actor,
+                            Candidate.Body == EKNTimeBody::Projectile ? Layer.FieldProjectileScale : Layer.Scale);
+                    }
+                }
+            }
+        }
+
+        // 이전 멤버 집합과 비교해 바뀐 필드만 반영합니다. (변경 없으면 재계산도 일어나지 않음)
+        int32 Changes = 0;
+        for (const TPair<TWeakObjectPtr<AActor>, float>& Pair : FieldScratchMembers)
+        {
+            const float* OldScale = Layer.Members.Find(Pair.Key);
+            if (!OldScale || *OldScale != Pair.Value) ++Changes;
+        }
+        for (const TPair<TWeakObjectPtr<AActor>, float>& Pair : Layer.Members)
+        {
+            if (!FieldScratchMembers.Contains(Pair.Key)) ++Changes;
+        }
+
+        if (Changes > 0)
+        {
+            // 교환하면 이전 멤버 맵이 다음 필드의 작업 맵이 되어 두 맵의 할당이 계속 재사용됩니다.
+            Exchange(Layer.Members, FieldScratchMembers);
+            Stats.FieldMemberChanges += Changes;
+            bDirty = true;
+        }
+    }
+}
+
+FIntPoint UKNTimeDilationSubsystem::GetFieldCell(const FVector& Location) const
+{
+    const double InvCellSize = 1.0 / FMath::Max(FieldCellSize, 1.0f);
+    return FIntPoint(
+        FMath::FloorToInt32(Location.X * InvCellSize),
+        FMath::FloorToInt32(Location.Y * InvCellSize));
+}
+
+void UKNTimeDilationSubsystem::FireExpiredRealTimers()
+{
+    if (RealTimers.IsEmpty()) return;
+
+    // 델리게이트 안에서 타이머를 다시 설정할 수 있으므로 만료분을 먼저 분리한 뒤 실행합니다.
+    TArray<FTimerDelegate, TInlineAllocator<4>> Expired;
+    for (int32 Index = RealTimers.Num() - 1; Index >= 0; --Index)
+    {
+        if (RealTimers[Index].ExpireTime <= RealTimeSeconds)
+        {
+            Expired.Add(MoveTemp(RealTimers[Index].Delegate));
+            RealTimers.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+        }
+    }
+
+    for (FTimerDelegate& Delegate : Expired)
+    {
+        Delegate.ExecuteIfBound();
+    }
+}
+#pragma endregion 내부 헬퍼 함수 구현
+
+#pragma region 시간 레이어 통계
+#if !UE_BUILD_SHIPPING
+namespace
+{
+    /** @brief 현재 월드의 시간 레이어와 쓰기 통계를 출력합니다. ("reset" 인자 시 출력 후 초기화) */
+    FAutoConsoleCommandWithWorldAndArgs GKNTimeDilationStatsCommand(
+        TEXT("KN.Time.Stats"),
+        TEXT("활성 시간 배율 레이어와 재계산/쓰기 횟수를 출력합니다. 인자 reset 시 통계를 초기화합니다."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            UKNTimeDilationSubsystem* Time = World ? World->GetSubsystem<UKNTimeDilationSubsystem>() : nullptr;
+            if (!Time)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[KNTimeDilationSubsystem] 이 월드에는 시간 서비스가 없습니다."));
+                return;
+            }
+
+            const FKNTimeDilationStats& Stats = Time->GetStats();
+            UE_LOG(LogTemp, Log,
+                TEXT("[KNTimeDilationSubsystem] 글로벌 x%.4f — 재계산 %d, 액터 쓰기 %d / 생략 %d, 글로벌 쓰기 %d, 레이어 추가 %d — 틱 정지 %d (누적 액터 %d, 틱 %d) — 필드 갱신 %d, 셀 이동 %d, 후보 검사 %d, 멤버 변경 %d — 실시간 %.2fs / 게임 %.2fs"),
+                Time->GetGlobalScale(), Stats.Recomputes, Stats.ActorWrites, Stats.ActorWritesSkipped,
+                Stats.GlobalWrites, Stats.LayersPushed,
+                Time->GetNumFrozenActors(), Stats.ActorsFrozen, Stats.TicksSuspended,
+                Stats.FieldUpdates, Stats.FieldCellMoves, Stats.FieldCandidatesTested, Stats.FieldMemberChanges,
+                Time->GetRealTimeSeconds(), Time->GetDilatedTimeSeconds());
+            Time->DumpLayers();
+
+            if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+            {
+                Time->ResetStats();
+            }
+        }));
+}
+#endif
+#pragma endregion 시간 레이어 통계
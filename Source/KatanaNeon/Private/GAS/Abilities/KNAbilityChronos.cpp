@@ -3,10 +3,13 @@
 
 #include "GAS/Abilities/KNAbilityChronos.h"
 #include "AbilitySystemComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "Characters/Base/KNCharacterBase.h" // ACharacter 교체
+#include "Characters/Player/KNPlayerCharacter.h"
 #include "Engine/DataTable.h"
 #include "Components/KNChronosSphereComponent.h"
 #include "GAS/Attributes/KNAttributeSet.h"
+#include "GAS/Components/KNStatsComponent.h"
 #include "GAS/Tags/KNStatsTags.h"
 
 #pragma region 기본 생성자 및 초기화 구현
@@ -24,6 +27,15 @@ UKNAbilityChronos::UKNAbilityChronos()
 #pragma endregion 기본 생성자 및 초기화 구현
 
 #pragma region GAS 핵심 오버라이드 구현
+void UKNAbilityChronos::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+    Super::OnGiveAbility(ActorInfo, Spec);
+
+    // 에디터 행 핸들을 캐시 정수 핸들로 1회 해석합니다. (실패 시 원본 핸들 조회로 폴백)
+    const AActor* Avatar = ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr;
+    ChronosSettingRowBinding.Bind(Avatar, &UKNDataManagerSubsystem::GetChronosSettingCache, ChronosSettingRowHandle);
+}
+
 bool UKNAbilityChronos::CanActivateAbility(
     const FGameplayAbilitySpecHandle Handle,
     const FGameplayAbilityActorInfo* ActorInfo,
@@ -72,10 +84,20 @@ void UKNAbilityChronos::ActivateAbility(
         return;
     }
 
+    const FKNCombatContext* CombatContext = AKNPlayerCharacter::GetCombatContext(GetAvatarActorFromActorInfo());
+    UKNStatsComponent* Stats = CombatContext ? CombatContext->Stats : nullptr;
+    if (!Stats)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[KNAbilityChronos] KNStatsComponent를 플레이어 캐릭터에서 찾을 수 없습니다!"));
+        EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+        return;
+    }
+    WeakStatsComp = Stats;
+
     // 상태 태그 부여
     if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
     {
-        ASC->AddLooseGameplayTag(KatanaNeon::State::Combat::ChronosActive);
+        UKNAbilitySystemComponent::AddState(ASC, EKNStateTag::ChronosActive);
     }
 
     // 구체 콜리전 활성화 (범위 감속 시작)
@@ -87,15 +109,17 @@ void UKNAbilityChronos::ActivateAbility(
             CachedSetting.SphereRadius);
     }
 
-    // 게이지 소모 반복 타이머 시작
-    GetWorld()->GetTimerManager().SetTimer(
-        DrainTimerHandle,
-        this,
-        &UKNAbilityChronos::OnDrainTick,
-        CachedSetting.DrainTickInterval,
-        true);
-
+    // 해석적 소모 시작: 이후 활성 구간 동안 GE 적용 없이 고갈 시각 타이머 1개만 유지합니다.
+    Stats->BeginChronosDrain(CachedSetting.DrainRatePerSecond);
     bIsChronosActive = true;
+
+    if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
+    {
+        ChronosChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(UKNAttributeSet::GetChronosAttribute())
+            .AddUObject(this, &UKNAbilityChronos::OnChronosAttributeChanged);
+    }
+
+    ScheduleDepletion();
 }
 
 void UKNAbilityChronos::EndAbility(
@@ -105,12 +129,21 @@ void UKNAbilityChronos::EndAbility(
     bool bReplicateEndAbility,
     bool bWasCancelled)
 {
-    // 소모 타이머 해제
+    // 고갈 타이머 해제
     if (UWorld* World = GetWorld())
     {
-        World->GetTimerManager().ClearTimer(DrainTimerHandle);
+        World->GetTimerManager().ClearTimer(DepletionTimerHandle);
     }
 
+    // 외부 증감 감지 해제 후 누적 소모량을 1회 확정합니다. (토글 OFF/취소/고갈 공통)
+    if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
+    {
+        ASC->GetGameplayAttributeValueChangeDelegate(UKNAttributeSet::GetChronosAttribute())
+            .Remove(ChronosChangedHandle);
+    }
+    ChronosChangedHandle.Reset();
+    SettleChronosDrain();
+
     // 구체 비활성화 (내부에서 모든 감속 복구 수행)
     if (UKNChronosSphereComponent* Sphere = WeakSphereComp.Get())
     {
@@ -120,10 +153,7 @@ void UKNAbilityChronos::EndAbility(
     // 상태 태그 안전 제거
     if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
     {
-        if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::ChronosActive))
-        {
-            ASC->RemoveLooseGameplayTag(KatanaNeon::State::Combat::ChronosActive);
-        }
+        UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::ChronosActive);
     }
 
     bIsChronosActive = false;
@@ -142,7 +172,7 @@ bool UKNAbilityChronos::LoadChronosSetting()
         return false;
     }
 
-    const FKNChronosSettingRow* Row = ChronosSettingRowHandle.GetRow<FKNChronosSettingRow>(TEXT("LoadChronosSetting"));
+    const FKNChronosSettingRow* Row = ChronosSettingRowBinding.Get(ChronosSettingRowHandle, TEXT("LoadChronosSetting"));
 
     if (!ensureAlwaysMsgf(Row, TEXT("[KNAbilityChronos] 지정된 ChronosSetting 행을 찾을 수 없습니다.")))
     {
@@ -167,36 +197,70 @@ bool UKNAbilityChronos::ResolveSphereComponent()
     return true;
 }
 
-void UKNAbilityChronos::OnDrainTick()
+void UKNAbilityChronos::ScheduleDepletion()
 {
-    UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
-    if (!ASC || !ChronosDrainGEClass) return;
+    UWorld* World = GetWorld();
+    const UKNStatsComponent* Stats = WeakStatsComp.Get();
+    if (!World || !Stats) return;
+
+    World->GetTimerManager().ClearTimer(DepletionTimerHandle);
+
+    // 소모율이 0이면 고갈되지 않으므로 토글 OFF까지 유지됩니다.
+    const float TimeToDepletion = Stats->GetChronosTimeToDepletion();
+    if (TimeToDepletion < 0.0f) return;
 
-    // 잔량 확인 → 0 이하면 어빌리티 자동 종료
-    if (const UKNAttributeSet* AttrSet = ASC->GetSet<UKNAttributeSet>())
+    if (TimeToDepletion <= 0.0f)
     {
-        if (AttrSet->GetChronos() <= 0.0f)
-        {
-            EndAbility(
-                GetCurrentAbilitySpecHandle(),
-                GetCurrentActorInfo(),
-                GetCurrentActivationInfo(),
-                true, false);
-            return;
-        }
+        // 이미 고갈된 상태는 다음 틱에 종료하여 호출 중인 델리게이트 안에서 EndAbility가 실행되지 않게 합니다.
+        DepletionTimerHandle = World->GetTimerManager().SetTimerForNextTick(this, &UKNAbilityChronos::OnChronosDepleted);
+        return;
     }
 
-    // DrainTickInterval 동안의 소모량 계산
-    const float DrainAmount = CachedSetting.DrainRatePerSecond * CachedSetting.DrainTickInterval;
+    World->GetTimerManager().SetTimer(
+        DepletionTimerHandle,
+        this,
+        &UKNAbilityChronos::OnChronosDepleted,
+        TimeToDepletion,
+        false);
+}
+
+void UKNAbilityChronos::SettleChronosDrain()
+{
+    UKNStatsComponent* Stats = WeakStatsComp.Get();
+    if (!Stats) return;
+
+    const float DrainAmount = Stats->EndChronosDrain();
 
-    FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
-    FGameplayEffectSpecHandle    SpecHandle = ASC->MakeOutgoingSpec(ChronosDrainGEClass, 1.0f, Context);
+    UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
+    if (!ASC || !ChronosDrainGEClass || DrainAmount <= 0.0f) return;
+
+    FGameplayEffectSpecHandle    SpecHandle = UKNAbilitySystemComponent::MakePooledSpec(ASC, ChronosDrainGEClass, 1.0f);
 
     if (FGameplayEffectSpec* Spec = SpecHandle.Data.Get())
     {
-        // 엑셀에서 기획자가 지정한 수치만큼 마이너스 처리
+        // 활성 구간 전체의 소모량을 한 번에 마이너스 처리
         Spec->SetSetByCallerMagnitude(KatanaNeon::Data::Stats::Chronos, -DrainAmount);
         ASC->ApplyGameplayEffectSpecToSelf(*Spec);
     }
 }
+
+void UKNAbilityChronos::OnChronosDepleted()
+{
+    if (!bIsChronosActive) return;
+
+    EndAbility(
+        GetCurrentAbilitySpecHandle(),
+        GetCurrentActorInfo(),
+        GetCurrentActivationInfo(),
+        true, false);
+}
+
+void UKNAbilityChronos::OnChronosAttributeChanged(const FOnAttributeChangeData& Data)
+{
+    // 회복/피격 등으로 잔량이 바뀌면 고갈 시각도 달라집니다.
+    if (bIsChronosActive)
+    {
+        ScheduleDepletion();
+    }
+}
 #pragma endregion 내부 헬퍼 함수 구현
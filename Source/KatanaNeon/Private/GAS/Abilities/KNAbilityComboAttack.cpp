@@ -3,13 +3,23 @@
 
 #include "GAS/Abilities/KNAbilityComboAttack.h"
 #include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "Abilities/Tasks/AbilityTask_PlayMontageAndWait.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
 #include "GameFramework/Character.h"
 #include "Engine/DataTable.h"
 #include "GAS/Attributes/KNAttributeSet.h"
 #include "GAS/Components/KNStatsComponent.h"
+#include "GAS/Effects/KNDamageEffect.h"
+#include "Framework/System/KNHitQueueSubsystem.h"
+#include "Framework/System/KNCollisionChannels.h"
 #include "GAS/Tags/KNStatsTags.h"
-#include "NiagaraFunctionLibrary.h"
+#include "GAS/Tasks/KNAbilityTask_BladeSweep.h"
+#include "Characters/Player/KNPlayerCharacter.h"
+#include "Components/StaticMeshComponent.h"
+#include "Framework/System/KNCombatVFXSubsystem.h"
 
 #pragma region 기본 생성자 및 초기화 구현
 UKNAbilityComboAttack::UKNAbilityComboAttack()
@@ -26,6 +36,8 @@ UKNAbilityComboAttack::UKNAbilityComboAttack()
     // 콤보 상태(Step)는 인스턴스 멤버로 관리하므로 InstancedPerActor 필수
     InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
     NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::LocalPredicted;
+
+    DamageGEClass = UKNDamageEffect::StaticClass();
 }
 #pragma endregion 기본 생성자 및 초기화 구현
 
@@ -42,32 +54,63 @@ bool UKNAbilityComboAttack::CanActivateAbility(
         return false;
     }
 
-    // 현재 스탠스에 맞는 DataTable 존재 여부 확인
+    // 현재 스탠스의 1단계 노드 존재 여부 확인 (누락 행은 컴파일 시점에 이미 보고됨)
     const bool bDrawn = IsWeaponDrawn(ActorInfo);
-    if (!GetComboDataTable(bDrawn))
-    {
-        UE_LOG(LogTemp, Warning, TEXT("[ComboAttack] %s 스탠스 DataTable이 할당되지 않았습니다."),
-            bDrawn ? TEXT("발도") : TEXT("납도"));
-        return false;
-    }
+    const FKNComboGraph& Graph = GetComboGraph();
+    const int32 EntryNode = Graph.GetEntryNode(bDrawn, false);
+    if (EntryNode == INDEX_NONE) return false;
 
     // 콤보 윈도우 진행 중이면 다음 입력으로 바로 허용
     if (bComboWindowOpen) return true;
 
     // 1단계 시작 전 스태미나 사전 검사
-    const FName FirstRow = MakeComboRowName(1, EKNComboAttackType::Light);
-    const FKNComboAttackRow* TestRow =
-        GetComboDataTable(bDrawn)->FindRow<FKNComboAttackRow>(FirstRow, TEXT("CanActivate"));
-    if (TestRow == nullptr) return false;
+    const FKNComboAttackRow* TestRow = Graph.GetRow(EntryNode);
 
+    // 아직 어트리뷰트에 확정되지 않은 자연 회복분까지 포함하여 검사합니다.
     if (const UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.Get())
     {
-        if (const UKNAttributeSet* AttrSet = ASC->GetSet<UKNAttributeSet>())
+        return UKNStatsComponent::GetEffectiveStamina(ASC) >= TestRow->StaminaCost;
+    }
+    return false;
+}
+
+void UKNAbilityComboAttack::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+    Super::OnGiveAbility(ActorInfo, Spec);
+
+    // 데미지 GE가 UKNDamageExecution을 실행하지 않으면 Damage SetByCaller가 무시되어 피해가 0이 되므로 기본 데미지 GE로 되돌립니다.
+    if (DamageGEClass && !UKNDamageEffect::IsDamageEffectClass(DamageGEClass))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[KNAbilityComboAttack] DamageGEClass(%s)가 UKNDamageEffect 기반이 아닙니다. UKNDamageEffect로 대체합니다."),
+            *GetNameSafe(DamageGEClass.Get()));
+        DamageGEClass = UKNDamageEffect::StaticClass();
+    }
+
+    // 부여 시점에 테이블을 컴파일하여 누락 행을 플레이 전에 드러냅니다.
+    ComboGraph.Compile(DrawnComboDataTable, SheathComboDataTable, GetName());
+
+    // 오버클럭 데미지 배율도 부여 시점에 한 번만 조회합니다. (피격마다 행 해시 조회 방지)
+    if (const FKNOverclockLv1Row* Lv1Row = OverclockLv1RowHandle.GetRow<FKNOverclockLv1Row>(TEXT("CacheTacticalMultiplier")))
+    {
+        TacticalDamageMultiplier = Lv1Row->DamageMultiplier;
+    }
+    if (const FKNOverclockLv3Row* Lv3Row = OverclockLv3RowHandle.GetRow<FKNOverclockLv3Row>(TEXT("CacheFrozenMultiplier")))
+    {
+        FrozenDamageMultiplier = Lv3Row->FrozenDamageMultiplier;
+    }
+
+    // 콤보 행의 휘두르기/적중 이펙트를 레벨 로드 시점에 풀에 미리 채워 첫 타격 스파이크를 없앱니다.
+    if (UKNCombatVFXSubsystem* VFX = UKNCombatVFXSubsystem::Get(ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr))
+    {
+        for (int32 NodeIndex = 0; NodeIndex < FKNComboGraph::NumNodes; ++NodeIndex)
         {
-            return AttrSet->GetStamina() >= TestRow->StaminaCost;
+            if (const FKNComboAttackRow* Row = ComboGraph.GetRow(NodeIndex))
+            {
+                VFX->Prewarm(Row->SlashVFX);
+                VFX->Prewarm(Row->HitVFX);
+            }
         }
     }
-    return false;
 }
 
 void UKNAbilityComboAttack::ActivateAbility(
@@ -97,12 +140,10 @@ void UKNAbilityComboAttack::ActivateAbility(
 
     // ── 1단계 시작: 이 시점의 스탠스를 콤보 끝까지 고정 ──
     bIsDrawnCombo = IsWeaponDrawn(ActorInfo);
-    CurrentComboStep = 1;
-    CurrentAttackType = bNextIsHeavy ? EKNComboAttackType::Heavy : EKNComboAttackType::Light;
+    const int32 EntryNode = GetComboGraph().GetEntryNode(bIsDrawnCombo, bNextIsHeavy);
     bNextIsHeavy = false;
 
-    const FName RowName = MakeComboRowName(CurrentComboStep, CurrentAttackType);
-    if (!LoadComboRow(RowName))
+    if (!EnterComboNode(EntryNode))
     {
         EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
         return;
@@ -128,6 +169,8 @@ void UKNAbilityComboAttack::EndAbility(
     bool bWasCancelled)
 {
     CurrentComboStep = 0;
+    CurrentComboNode = INDEX_NONE;
+    CurrentComboRow = nullptr;
     bComboWindowOpen = false;
     bNextIsHeavy = false;
     bIsDrawnCombo = false;
@@ -139,6 +182,8 @@ void UKNAbilityComboAttack::EndAbility(
         World->GetTimerManager().ClearTimer(ComboWindowTimerHandle);
     }
 
+    StopBladeSweep();
+
     // [핵심 해결책] 어빌리티 종료 시 남아있는 태스크를 안전하게 정리합니다.
     if (CurrentMontageTask != nullptr)
     {
@@ -176,45 +221,77 @@ void UKNAbilityComboAttack::BufferNextInput(bool bIsHeavy)
 }
 void UKNAbilityComboAttack::ActivateHitbox()
 {
-    UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
-    if (!ASC || !DamageGEClass) return;
+    // 연속 스윕 태스크가 판정 구간을 전담 중이면 노티파이 시점 단발 판정은 생략합니다.
+    if (CurrentSweepTask && !CurrentSweepTask->IsFinished()) return;
 
     ACharacter* Owner = Cast<ACharacter>(GetAvatarActorFromActorInfo());
     if (!Owner) return;
 
-    // 카타나 메시에서 두 소켓 위치를 가져옵니다
-    UStaticMeshComponent* KatanaMesh =
-        Owner->FindComponentByClass<UStaticMeshComponent>();
-
     FVector HitStart = Owner->GetActorLocation() + Owner->GetActorForwardVector() * 10.0f;
     FVector HitEnd = Owner->GetActorLocation() + Owner->GetActorForwardVector() * 100.0f;
 
-    if (KatanaMesh)
+    // 플레이어는 캐시된 소켓 좌표로 칼날 선분을 구합니다. (컴포넌트 탐색·소켓 이름 조회 없음)
+    const FKNCombatContext* CombatContext = AKNPlayerCharacter::GetCombatContext(Owner);
+    if (!CombatContext
+        || !CombatContext->MatchesBladeSockets(BladeRootSocketName, BladeTipSocketName)
+        || !CombatContext->GetBladeSegment(HitStart, HitEnd))
     {
-        if (KatanaMesh->DoesSocketExist(TEXT("Socket_Blade_Root")))
+        // 캐시가 없는 아바타이거나 어빌리티가 다른 소켓을 지정한 경우에만 이름으로 조회합니다.
+        if (UStaticMeshComponent* KatanaMesh = GetWeaponMesh())
         {
-            HitStart = KatanaMesh->GetSocketLocation(TEXT("Socket_Blade_Root"));
-        }
-        if (KatanaMesh->DoesSocketExist(TEXT("Socket_Blade_Tip")))
-        {
-            HitEnd = KatanaMesh->GetSocketLocation(TEXT("Socket_Blade_Tip"));
+            if (KatanaMesh->DoesSocketExist(BladeRootSocketName))
+            {
+                HitStart = KatanaMesh->GetSocketLocation(BladeRootSocketName);
+            }
+            if (KatanaMesh->DoesSocketExist(BladeTipSocketName))
+            {
+                HitEnd = KatanaMesh->GetSocketLocation(BladeTipSocketName);
+            }
         }
     }
 
-    // 구체 스윕으로 칼날 전체 범위를 판정합니다
-    TArray<FHitResult> HitResults;
+    // 구체 스윕으로 칼날 전체 범위를 판정합니다. PlayerAttack 채널은 적 허트박스만 응답합니다.
     FCollisionQueryParams Params;
     Params.AddIgnoredActor(Owner);
 
-    GetWorld()->SweepMultiByChannel(
-        HitResults,
-        HitStart,
-        HitEnd,
-        FQuat::Identity,
-        ECC_Pawn,
-        FCollisionShape::MakeSphere(8.0f),  // 칼 두께
-        Params);
+    if (bUseAsyncBladeQueries)
+    {
+        // 예약만 하고 반환합니다. 결과는 다음 프레임 OnAsyncHitboxSweepCompleted로 들어옵니다.
+        const FTraceDelegate SweepDelegate =
+            FTraceDelegate::CreateUObject(this, &UKNAbilityComboAttack::OnAsyncHitboxSweepCompleted);
+
+        GetWorld()->AsyncSweepByChannel(
+            EAsyncTraceType::Multi,
+            HitStart,
+            HitEnd,
+            FQuat::Identity,
+            KatanaNeon::Collision::PlayerAttack,
+            FCollisionShape::MakeSphere(BladeSweepRadius),
+            Params,
+            FCollisionResponseParams::DefaultResponseParam,
+            &SweepDelegate);
+    }
+    else
+    {
+        TArray<FHitResult> HitResults;
+        GetWorld()->SweepMultiByChannel(
+            HitResults,
+            HitStart,
+            HitEnd,
+            FQuat::Identity,
+            KatanaNeon::Collision::PlayerAttack,
+            FCollisionShape::MakeSphere(BladeSweepRadius),  // 칼 두께
+            Params);
+
+        ResolveHitboxResults(HitResults);
+    }
 
+    // ★ 미적중 포함 항상 나오는 VFX
+    OnBladeWindowOpened(HitStart, HitEnd);
+}
+
+void UKNAbilityComboAttack::ResolveHitboxResults(TConstArrayView<FHitResult> HitResults)
+{
     TSet<AActor*> HitActors; // 동일 액터 중복 히트 방지
 
     for (const FHitResult& Hit : HitResults)
@@ -223,76 +300,16 @@ void UKNAbilityComboAttack::ActivateHitbox()
         if (!HitActor || HitActors.Contains(HitActor)) continue;
         HitActors.Add(HitActor);
 
-        UAbilitySystemComponent* TargetASC =
-            HitActor->FindComponentByClass<UAbilitySystemComponent>();
-        if (!TargetASC) continue;
-
-        // 데미지 GE 적용
-        FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
-        Context.AddInstigator(Owner, Owner);
-        FGameplayEffectSpecHandle DmgSpec =
-            ASC->MakeOutgoingSpec(DamageGEClass, 1.0f, Context);
-
-        if (FGameplayEffectSpec* Spec = DmgSpec.Data.Get())
-        {
-            float TacticalMultiplier = 1.0f;
-            if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::OverclockTactical))
-            {
-                if (const FKNOverclockLv1Row* Lv1Row =
-                    OverclockLv1RowHandle.GetRow<FKNOverclockLv1Row>(TEXT("GetTacticalMultiplier")))
-                {
-                    TacticalMultiplier = Lv1Row->DamageMultiplier;
-                }
-            }
-
-            float FrozenMultiplier = 1.0f;
-            if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::WorldTimeFrozen))
-            {
-                if (const FKNOverclockLv3Row* Lv3Row =
-                    OverclockLv3RowHandle.GetRow<FKNOverclockLv3Row>(TEXT("GetFrozenMultiplier")))
-                {
-                    FrozenMultiplier = Lv3Row->FrozenDamageMultiplier;
-                }
-            }
-
-            const float FinalDamage = BaseAttackDamage
-                * CachedComboRow.DamageMultiplier
-                * TacticalMultiplier
-                * FrozenMultiplier;
-
-            Spec->SetSetByCallerMagnitude(KatanaNeon::Data::Stats::Health, -FinalDamage);
-            TargetASC->ApplyGameplayEffectSpecToSelf(*Spec);
-        }
-
-        if (UKNStatsComponent* Stats = Owner->FindComponentByClass<UKNStatsComponent>())
-        {
-            Stats->GainOverclockPoint(CachedComboRow.OverclockGain);
-        }
-
-        // ★ 적중 VFX — 히트 위치에 스폰
-        if (CachedComboRow.HitVFX)
-        {
-            UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-                GetWorld(), CachedComboRow.HitVFX,
-                Hit.ImpactPoint, Hit.ImpactNormal.Rotation());
-        }
+        OnBladeHit(Hit);
     }
+}
 
-    // ★ 미적중 포함 항상 나오는 VFX — 칼날 중간 위치에 스폰
-    if (CachedComboRow.SlashVFX)
-    {
-        const FVector BladeCenter = (HitStart + HitEnd) * 0.5f;
-
-        // 캐릭터 전방 방향 + DT에서 설정한 오프셋 회전을 합산
-        const FRotator FinalRotation = (Owner->GetActorForwardVector().Rotation()
-            + CachedComboRow.SlashVFXRotationOffset).GetNormalized();
+void UKNAbilityComboAttack::OnAsyncHitboxSweepCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+    // 요청 이후 콤보가 끝났다면 결과를 버립니다.
+    if (!IsActive()) return;
 
-        UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-            GetWorld(),
-            CachedComboRow.SlashVFX,
-            BladeCenter,
-            FinalRotation);
-    }
+    ResolveHitboxResults(TraceDatum.OutHits);
 }
 
 void UKNAbilityComboAttack::OpenComboWindow()
@@ -305,7 +322,7 @@ void UKNAbilityComboAttack::OpenComboWindow()
     }
 
     // ComboWindowTime == 0.0f : Light 피니셔(5단계) → 즉시 종료
-    if (FMath::IsNearlyZero(CachedComboRow.ComboWindowTime))
+    if (!CurrentComboRow || FMath::IsNearlyZero(CurrentComboRow->ComboWindowTime))
     {
         OnComboWindowExpired();
         return;
@@ -329,7 +346,7 @@ void UKNAbilityComboAttack::OpenComboWindow()
         ComboWindowTimerHandle,
         this,
         &UKNAbilityComboAttack::OnComboWindowExpired,
-        CachedComboRow.ComboWindowTime,
+        CurrentComboRow->ComboWindowTime,
         false);
 }
 
@@ -357,9 +374,14 @@ void UKNAbilityComboAttack::PrepareHeavyStart()
 #pragma endregion 블루프린트 / AnimNotify 연동 인터페이스 구현
 
 #pragma region 내부 헬퍼 함수 구현
-UDataTable* UKNAbilityComboAttack::GetComboDataTable(bool bDrawn) const
+const FKNComboGraph& UKNAbilityComboAttack::GetComboGraph() const
 {
-    return bDrawn ? DrawnComboDataTable.Get() : SheathComboDataTable.Get();
+    // CDO 경로 등 OnGiveAbility를 거치지 않은 경우에만 지연 컴파일됩니다.
+    if (!ComboGraph.IsCompiled())
+    {
+        ComboGraph.Compile(DrawnComboDataTable, SheathComboDataTable, GetName());
+    }
+    return ComboGraph;
 }
 
 bool UKNAbilityComboAttack::IsWeaponDrawn(const FGameplayAbilityActorInfo* ActorInfo) const
@@ -369,71 +391,40 @@ bool UKNAbilityComboAttack::IsWeaponDrawn(const FGameplayAbilityActorInfo* Actor
     const UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.Get();
     if (!ASC) return false;
 
-    return ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::WeaponDrawn);
-}
-
-FName UKNAbilityComboAttack::MakeComboRowName(int32 Step, EKNComboAttackType AttackType) const
-{
-    // 최적화: FString 힙 할당 없이 static 배열로 즉시 반환
-    static const FName LightNames[] = {
-        TEXT("LightAttack_1"), TEXT("LightAttack_2"), TEXT("LightAttack_3"),
-        TEXT("LightAttack_4"), TEXT("LightAttack_5")
-    };
-    static const FName HeavyNames[] = {
-        TEXT("HeavyAttack_1"), TEXT("HeavyAttack_2"), TEXT("HeavyAttack_3"),
-        TEXT("HeavyAttack_4"), TEXT("HeavyAttack_5")
-    };
-
-    const int32 SafeIdx = FMath::Clamp(Step - 1, 0, 4);
-    return (AttackType == EKNComboAttackType::Light) ? LightNames[SafeIdx] : HeavyNames[SafeIdx];
+    return UKNAbilitySystemComponent::HasState(ASC, EKNStateTag::WeaponDrawn);
 }
 
-bool UKNAbilityComboAttack::LoadComboRow(const FName& RowName)
+bool UKNAbilityComboAttack::EnterComboNode(int32 NodeIndex)
 {
-    UDataTable* Table = GetComboDataTable(bIsDrawnCombo);
-    if (!Table)
-    {
-        UE_LOG(LogTemp, Error, TEXT("[ComboAttack] %s 스탠스 DataTable이 없습니다."),
-            bIsDrawnCombo ? TEXT("발도") : TEXT("납도"));
-        return false;
-    }
-
-    const FKNComboAttackRow* Row =
-        Table->FindRow<FKNComboAttackRow>(RowName, TEXT("LoadComboRow"));
+    const FKNComboAttackRow* Row = ComboGraph.GetRow(NodeIndex);
+    if (!Row) return false;
 
-    if (!ensureAlwaysMsgf(Row,
-        TEXT("[ComboAttack] 행을 찾을 수 없음: %s (스탠스: %s)"),
-        *RowName.ToString(), bIsDrawnCombo ? TEXT("발도") : TEXT("납도")))
-    {
-        return false;
-    }
-
-    CachedComboRow = *Row;
+    CurrentComboNode = NodeIndex;
+    CurrentComboRow = Row;
+    CurrentComboStep = FKNComboGraph::GetNodeStep(NodeIndex);
+    CurrentAttackType = FKNComboGraph::IsHeavyNode(NodeIndex) ? EKNComboAttackType::Heavy : EKNComboAttackType::Light;
     return true;
 }
 
 bool UKNAbilityComboAttack::ConsumeStamina()
 {
     UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
-    if (!ASC || !StaminaCostGEClass) return false;
+    if (!ASC || !StaminaCostGEClass || !CurrentComboRow) return false;
 
     // 사전 잔액 검사
-    if (const UKNAttributeSet* AttrSet = ASC->GetSet<UKNAttributeSet>())
+    const float CurrentStamina = UKNStatsComponent::GetEffectiveStamina(ASC);
+    if (CurrentStamina < CurrentComboRow->StaminaCost)
     {
-        if (AttrSet->GetStamina() < CachedComboRow.StaminaCost)
-        {
-            UE_LOG(LogTemp, Warning, TEXT("[KNAbility_ComboAttack] 스태미나 부족: 필요=%.1f, 현재=%.1f"),
-                CachedComboRow.StaminaCost, AttrSet->GetStamina());
-            return false;
-        }
+        UE_LOG(LogTemp, Warning, TEXT("[KNAbility_ComboAttack] 스태미나 부족: 필요=%.1f, 현재=%.1f"),
+            CurrentComboRow->StaminaCost, CurrentStamina);
+        return false;
     }
 
-    FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
-    FGameplayEffectSpecHandle SpecHandle = ASC->MakeOutgoingSpec(StaminaCostGEClass, 1.0f, Context);
+    FGameplayEffectSpecHandle SpecHandle = UKNAbilitySystemComponent::MakePooledSpec(ASC, StaminaCostGEClass, 1.0f);
 
     if (FGameplayEffectSpec* Spec = SpecHandle.Data.Get())
     {
-        Spec->SetSetByCallerMagnitude(KatanaNeon::Data::Stats::Stamina, -CachedComboRow.StaminaCost);
+        Spec->SetSetByCallerMagnitude(KatanaNeon::Data::Stats::Stamina, -CurrentComboRow->StaminaCost);
         // 음수 Delta → 스태미나 소모
         ASC->ApplyGameplayEffectSpecToSelf(*Spec);
         return true;
@@ -441,19 +432,25 @@ bool UKNAbilityComboAttack::ConsumeStamina()
     return false;
 }
 
-bool UKNAbilityComboAttack::PlayComboMontage()
+float UKNAbilityComboAttack::GetAttackerDamageMultiplier(const UAbilitySystemComponent* ASC) const
 {
-    // 미해제 시 L1 몽타주 종료가 EndAbility를 잘못 호출합니다.
-    if (CurrentMontageTask != nullptr)
+    // 상태 비트 조회 두 번뿐이므로, 콤보 도중 전술 오버클럭·시간 정지가 켜지거나 꺼져도 피격마다 즉시 반영합니다.
+    float Multiplier = 1.0f;
+    if (UKNAbilitySystemComponent::HasState(ASC, EKNStateTag::OverclockTactical))
     {
-        CurrentMontageTask->OnCompleted.RemoveAll(this);
-        CurrentMontageTask->OnInterrupted.RemoveAll(this);
-        CurrentMontageTask->OnCancelled.RemoveAll(this);
-        CurrentMontageTask = nullptr;
+        Multiplier *= TacticalDamageMultiplier;
     }
+    if (UKNAbilitySystemComponent::HasState(ASC, EKNStateTag::WorldTimeFrozen))
+    {
+        Multiplier *= FrozenDamageMultiplier;
+    }
+    return Multiplier;
+}
 
+bool UKNAbilityComboAttack::PlayComboMontage()
+{
     // ★ 몽타주는 DataTable 행의 ComboMontage 필드에서 직접 읽음
-    UAnimMontage* MontageToPlay = CachedComboRow.ComboMontage;
+    UAnimMontage* MontageToPlay = CurrentComboRow ? CurrentComboRow->ComboMontage.Get() : nullptr;
     if (!MontageToPlay)
     {
         UE_LOG(LogTemp, Error,
@@ -463,7 +460,7 @@ bool UKNAbilityComboAttack::PlayComboMontage()
     }
 
     // PlayRate = DT 행의 PlayRate × AttributeSet.AttackSpeed (오버클럭 배속 연동)
-    float FinalPlayRate = CachedComboRow.PlayRate;
+    float FinalPlayRate = CurrentComboRow->PlayRate;
     if (const UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
     {
         if (const UKNAttributeSet* Attrs = ASC->GetSet<UKNAttributeSet>())
@@ -472,20 +469,58 @@ bool UKNAbilityComboAttack::PlayComboMontage()
         }
     }
 
-    UAbilityTask_PlayMontageAndWait* Task =
-        UAbilityTask_PlayMontageAndWait::CreatePlayMontageAndWaitProxy(
-            this, NAME_None, MontageToPlay, FinalPlayRate, NAME_None, false);
+    // 섹션 재생 모드: 몽타주에 실제로 존재하는 섹션일 때만 사용합니다.
+    FName Section = NAME_None;
+    if (bUseSectionComboPlayback && MontageToPlay->IsValidSectionName(CurrentComboRow->MontageSectionName))
+    {
+        Section = CurrentComboRow->MontageSectionName;
+    }
 
-    Task->OnCompleted.AddDynamic(this, &UKNAbilityComboAttack::OnMontageEnded);
-    Task->OnInterrupted.AddDynamic(this, &UKNAbilityComboAttack::OnMontageEnded);
-    Task->OnCancelled.AddDynamic(this, &UKNAbilityComboAttack::OnMontageEnded);
-    Task->ReadyForActivation();
-    CurrentMontageTask = Task;
-    // ★ 안전망: 몽타주 길이 + 여유시간 후 강제 종료
+    // 같은 몽타주가 재생 중이면 태스크를 유지한 채 섹션만 점프합니다. (블렌드 아웃/인 없음)
+    if (!TryJumpToComboSection(MontageToPlay, Section, FinalPlayRate))
+    {
+        // 미해제 시 L1 몽타주 종료가 EndAbility를 잘못 호출합니다.
+        if (CurrentMontageTask != nullptr)
+        {
+            CurrentMontageTask->OnCompleted.RemoveAll(this);
+            CurrentMontageTask->OnInterrupted.RemoveAll(this);
+            CurrentMontageTask->OnCancelled.RemoveAll(this);
+            CurrentMontageTask = nullptr;
+        }
+
+        UAbilityTask_PlayMontageAndWait* Task =
+            UAbilityTask_PlayMontageAndWait::CreatePlayMontageAndWaitProxy(
+                this, NAME_None, MontageToPlay, FinalPlayRate, Section, false);
+
+        Task->OnCompleted.AddDynamic(this, &UKNAbilityComboAttack::OnMontageEnded);
+        Task->OnInterrupted.AddDynamic(this, &UKNAbilityComboAttack::OnMontageEnded);
+        Task->OnCancelled.AddDynamic(this, &UKNAbilityComboAttack::OnMontageEnded);
+        Task->ReadyForActivation();
+        CurrentMontageTask = Task;
+    }
+
+    // 재생 중인 섹션의 다음 링크를 끊어, 입력이 없으면 이 섹션 끝에서 몽타주가 끝나도록 합니다.
+    float PlayLength = MontageToPlay->GetPlayLength();
+    if (!Section.IsNone())
+    {
+        if (const FGameplayAbilityActorInfo* ActorInfo = GetCurrentActorInfo())
+        {
+            if (UAnimInstance* AnimInstance = ActorInfo->GetAnimInstance())
+            {
+                AnimInstance->Montage_SetNextSection(Section, NAME_None, MontageToPlay);
+            }
+        }
+        PlayLength = MontageToPlay->GetSectionLength(MontageToPlay->GetSectionIndex(Section));
+    }
+
+    // 몽타주 재생과 동시에 이번 스윙의 연속 히트박스를 가동합니다.
+    StartBladeSweep(MontageToPlay, Section);
+
+    // ★ 안전망: 몽타주(섹션) 길이 + 여유시간 후 강제 종료
        // 정상 흐름에서는 OnMontageEnded가 먼저 호출되어 이 타이머가 실행되지 않습니다
     if (UWorld* World = GetWorld())
     {
-        const float MontageLength = MontageToPlay->GetPlayLength() / FinalPlayRate;
+        const float MontageLength = PlayLength / FMath::Max(FinalPlayRate, KINDA_SMALL_NUMBER);
         World->GetTimerManager().SetTimer(
             SafetyTimerHandle,
             FTimerDelegate::CreateWeakLambda(this, [this]()
@@ -507,26 +542,141 @@ bool UKNAbilityComboAttack::PlayComboMontage()
     return true;
 }
 
-void UKNAbilityComboAttack::AdvanceCombo()
+bool UKNAbilityComboAttack::TryJumpToComboSection(UAnimMontage* Montage, FName Section, float PlayRate)
+{
+    if (Section.IsNone() || !CurrentMontageTask || !CurrentMontageTask->IsActive()) return false;
+
+    const FGameplayAbilityActorInfo* ActorInfo = GetCurrentActorInfo();
+    UAnimInstance* AnimInstance = ActorInfo ? ActorInfo->GetAnimInstance() : nullptr;
+    if (!AnimInstance || AnimInstance->GetCurrentActiveMontage() != Montage) return false;
+
+    AnimInstance->Montage_SetPlayRate(Montage, PlayRate);
+    AnimInstance->Montage_JumpToSection(Section, Montage);
+    return true;
+}
+
+UStaticMeshComponent* UKNAbilityComboAttack::GetWeaponMesh() const
+{
+    // 최적화: FindComponentByClass는 칼집 메시를 먼저 반환할 수 있으므로 전투 컨텍스트 캐시를 우선합니다.
+    if (const FKNCombatContext* CombatContext = AKNPlayerCharacter::GetCombatContext(GetAvatarActorFromActorInfo()))
+    {
+        return CombatContext->WeaponMesh;
+    }
+
+    const AActor* Avatar = GetAvatarActorFromActorInfo();
+    return Avatar ? Avatar->FindComponentByClass<UStaticMeshComponent>() : nullptr;
+}
+
+void UKNAbilityComboAttack::StartBladeSweep(UAnimMontage* Montage, FName Section)
 {
-    constexpr int32 MaxComboStep = 5;
-    ++CurrentComboStep;
+    // 이전 스윙의 태스크를 먼저 닫아야 단계 간 중복 제거 집합이 섞이지 않습니다.
+    StopBladeSweep();
+
+    UStaticMeshComponent* WeaponMesh = GetWeaponMesh();
+    if (!Montage || !WeaponMesh || !CurrentComboRow) return;
 
-    // 다음 단계가 Heavy로 예약되었는지 확인
-    if (bNextIsHeavy)
+    UKNAbilityTask_BladeSweep* Task = UKNAbilityTask_BladeSweep::CreateBladeSweepTask(
+        this,
+        Montage,
+        WeaponMesh,
+        BladeRootSocketName,
+        BladeTipSocketName,
+        CurrentComboRow->HitboxStartNormTime,
+        CurrentComboRow->HitboxEndNormTime,
+        BladeSweepRadius,
+        BladeSubStepDistance,
+        MaxBladeSubStepsPerFrame,
+        Section,
+        bUseAsyncBladeQueries);
+
+    Task->OnBladeHit.AddDynamic(this, &UKNAbilityComboAttack::OnBladeHit);
+    Task->OnWindowOpened.AddDynamic(this, &UKNAbilityComboAttack::OnBladeWindowOpened);
+    Task->ReadyForActivation();
+
+    // 소켓이 없으면 Activate 안에서 즉시 종료되며, 이 경우 HitboxOpen 노티파이 단발 판정이 대신합니다.
+    CurrentSweepTask = Task->IsFinished() ? nullptr : Task;
+}
+
+void UKNAbilityComboAttack::StopBladeSweep()
+{
+    if (CurrentSweepTask != nullptr)
     {
-        CurrentAttackType = EKNComboAttackType::Heavy;
-        bNextIsHeavy = false;
+        CurrentSweepTask->OnBladeHit.RemoveAll(this);
+        CurrentSweepTask->OnWindowOpened.RemoveAll(this);
+        CurrentSweepTask->EndTask();
+        CurrentSweepTask = nullptr;
     }
+}
 
-    if (CurrentComboStep > MaxComboStep)
+void UKNAbilityComboAttack::OnBladeHit(const FHitResult& Hit)
+{
+    UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
+    if (!ASC || !DamageGEClass || !CurrentComboRow) return;
+
+    ACharacter* Owner = Cast<ACharacter>(GetAvatarActorFromActorInfo());
+    AActor* HitActor = Hit.GetActor();
+    if (!Owner || !HitActor) return;
+
+    // 브로드페이즈에서 적 허트박스만 걸러졌으므로 컴포넌트 탐색 없이 인터페이스로 ASC를 얻습니다.
+    UAbilitySystemComponent* TargetASC =
+        UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(HitActor);
+    if (!TargetASC) return;
+
+    UKNHitQueueSubsystem* HitQueue = UKNHitQueueSubsystem::Get(Owner);
+    if (!HitQueue) return;
+
+    // 데미지 · 오버클럭 획득 · 적중 VFX는 프레임 말에 다른 피격과 합산되어 일괄 적용됩니다.
+    FKNHitRecord Record;
+    Record.SourceASC = ASC;
+    Record.TargetASC = TargetASC;
+    Record.DamageGEClass = DamageGEClass;
+    Record.BaseDamage = BaseAttackDamage;
+    Record.DamageMultiplier = CurrentComboRow->DamageMultiplier * GetAttackerDamageMultiplier(ASC);
+    Record.Instigator = Owner;
+    Record.EffectCauser = Owner;
+    Record.Hit = Hit;
+    Record.bHasHitResult = true;
+
+    const FKNCombatContext* CombatContext = AKNPlayerCharacter::GetCombatContext(Owner);
+    Record.OverclockReceiver = CombatContext ? CombatContext->Stats : nullptr;
+    Record.OverclockGain = CurrentComboRow->OverclockGain;
+
+    // ★ 적중 VFX — 히트 위치에 스폰
+    Record.HitVFX = CurrentComboRow->HitVFX;
+    Record.VFXLocation = Hit.ImpactPoint;
+    Record.VFXRotation = Hit.ImpactNormal.Rotation();
+
+    HitQueue->Enqueue(MoveTemp(Record));
+}
+
+void UKNAbilityComboAttack::OnBladeWindowOpened(FVector BladeRoot, FVector BladeTip)
+{
+    if (!CurrentComboRow || !CurrentComboRow->SlashVFX) return;
+
+    const AActor* Owner = GetAvatarActorFromActorInfo();
+    if (!Owner) return;
+
+    // ★ 미적중 포함 항상 나오는 VFX — 칼날 중간 위치에 스폰
+    const FVector BladeCenter = (BladeRoot + BladeTip) * 0.5f;
+
+    // 캐릭터 전방 방향 + DT에서 설정한 오프셋 회전을 합산
+    const FRotator FinalRotation = (Owner->GetActorForwardVector().Rotation()
+        + CurrentComboRow->SlashVFXRotationOffset).GetNormalized();
+
+    // 휘두르기 피드백이므로 예산·거리와 무관하게 스폰합니다.
+    if (UKNCombatVFXSubsystem* VFX = UKNCombatVFXSubsystem::Get(Owner))
     {
-        OnComboWindowExpired();
-        return;
+        VFX->SpawnAtLocation(CurrentComboRow->SlashVFX, BladeCenter, FinalRotation, EKNVFXPriority::Essential);
     }
+}
+
+void UKNAbilityComboAttack::AdvanceCombo()
+{
+    // 미리 계산된 전이: 약공 N → 약공/강공 N+1, 피니셔는 INDEX_NONE
+    const int32 NextNode = ComboGraph.GetNextNode(CurrentComboNode, bNextIsHeavy);
+    bNextIsHeavy = false;
 
-    const FName RowName = MakeComboRowName(CurrentComboStep, CurrentAttackType);
-    if (!LoadComboRow(RowName))
+    if (!EnterComboNode(NextNode))
     {
         OnComboWindowExpired();
         return;
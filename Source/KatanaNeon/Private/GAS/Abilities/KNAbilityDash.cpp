@@ -3,6 +3,7 @@
 
 #include "GAS/Abilities/KNAbilityDash.h"
 #include "AbilitySystemComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "GameplayEffect.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -10,6 +11,7 @@
 #include "Engine/DataTable.h"
 #include "Characters/Base/KNCharacterBase.h"
 #include "GAS/Attributes/KNAttributeSet.h"
+#include "GAS/Components/KNStatsComponent.h"
 #include "GAS/Tags/KNStatsTags.h"
 
 #pragma region 방향 판정 임계값 상수
@@ -40,6 +42,15 @@ UKNAbilityDash::UKNAbilityDash()
 #pragma endregion 기본 생성자 및 초기화 구현
 
 #pragma region GAS 핵심 오버라이드 구현
+void UKNAbilityDash::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+    Super::OnGiveAbility(ActorInfo, Spec);
+
+    // 에디터 행 핸들을 캐시 정수 핸들로 1회 해석합니다. (실패 시 원본 핸들 조회로 폴백)
+    const AActor* Avatar = ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr;
+    ActionCostRowBinding.Bind(Avatar, &UKNDataManagerSubsystem::GetActionCostCache, ActionCostRowHandle);
+}
+
 bool UKNAbilityDash::CanActivateAbility(
     const FGameplayAbilitySpecHandle Handle,
     const FGameplayAbilityActorInfo* ActorInfo,
@@ -56,15 +67,13 @@ bool UKNAbilityDash::CanActivateAbility(
     if (!ActionCostRowHandle.DataTable) return false;
 
     // 하드코딩된 TEXT("Default") 대신 에디터에 세팅된 행 번호를 가져옴
-    const FKNActionCostRow* CostRow = ActionCostRowHandle.GetRow<FKNActionCostRow>(TEXT("CanActivateDash"));
+    const FKNActionCostRow* CostRow = ActionCostRowBinding.Get(ActionCostRowHandle, TEXT("CanActivateDash"));
     if (!CostRow) return false;
 
+    // 아직 어트리뷰트에 확정되지 않은 자연 회복분까지 포함하여 검사합니다.
     if (const UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.Get())
     {
-        if (const UKNAttributeSet* AttrSet = ASC->GetSet<UKNAttributeSet>())
-        {
-            return AttrSet->GetStamina() >= CostRow->DashStaminaCost;
-        }
+        return UKNStatsComponent::GetEffectiveStamina(ASC) >= CostRow->DashStaminaCost;
     }
     return false;
 }
@@ -132,7 +141,7 @@ void UKNAbilityDash::ActivateAbility(
                 // 몽타주 재생 중 재시전 차단 태그 부여
                 if (UAbilitySystemComponent* DashASC = GetAbilitySystemComponentFromActorInfo())
                 {
-                    DashASC->AddLooseGameplayTag(KatanaNeon::State::Combat::Dashing);
+                    UKNAbilitySystemComponent::AddState(DashASC, EKNStateTag::Dashing);
                 }
             }
         }
@@ -164,15 +173,9 @@ void UKNAbilityDash::EndAbility(
     // 태그가 남아있는 경우를 대비한 안전 제거
     if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
     {
-        if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::Invincible))
-        {
-            ASC->RemoveLooseGameplayTag(KatanaNeon::State::Combat::Invincible);
-        }
+        UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::Invincible);
         // 강제 종료 시에도 차단 태그 안전 제거
-        if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::Dashing))
-        {
-            ASC->RemoveLooseGameplayTag(KatanaNeon::State::Combat::Dashing);
-        }
+        UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::Dashing);
     }
 
     Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
@@ -190,7 +193,7 @@ bool UKNAbilityDash::LoadActionCostRow()
     }
 
     // 하드코딩 제거
-    const FKNActionCostRow* Row = ActionCostRowHandle.GetRow<FKNActionCostRow>(TEXT("LoadDashCost"));
+    const FKNActionCostRow* Row = ActionCostRowBinding.Get(ActionCostRowHandle, TEXT("LoadDashCost"));
 
     if (!ensureAlwaysMsgf(Row, TEXT("[KNAbility_Dash] 지정된 ActionCost 행을 찾을 수 없습니다!")))
     {
@@ -206,8 +209,7 @@ bool UKNAbilityDash::ConsumeStamina()
     UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
     if (!ASC || !StaminaCostGEClass) return false;
 
-    FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
-    FGameplayEffectSpecHandle    SpecHandle = ASC->MakeOutgoingSpec(StaminaCostGEClass, 1.0f, Context);
+    FGameplayEffectSpecHandle    SpecHandle = UKNAbilitySystemComponent::MakePooledSpec(ASC, StaminaCostGEClass, 1.0f);
 
     if (FGameplayEffectSpec* Spec = SpecHandle.Data.Get())
     {
@@ -223,7 +225,7 @@ void UKNAbilityDash::GrantInvincible(UAbilitySystemComponent* ASC)
 {
     if (!ASC) return;
     // Loose 태그 방식: 타이머로 직접 제거하여 I-Frame 타이밍을 정밀하게 제어합니다.
-    ASC->AddLooseGameplayTag(KatanaNeon::State::Combat::Invincible);
+    UKNAbilitySystemComponent::AddState(ASC, EKNStateTag::Invincible);
 }
 
 // 에러 해결 2: 헤더와 동일하게 파라미터를 AKNCharacterBase로 변경
@@ -282,8 +284,8 @@ UAnimMontage* UKNAbilityDash::SelectDashMontage(const FKNDashMontageRow* InRow)
 
     // 상태 판별 — 우선순위: 공중 > 달리기 > 지상
     const bool bIsInAir = Character->GetCharacterMovement()->IsFalling();
-    const bool bIsSprinting = OwnerASC->HasMatchingGameplayTag(KatanaNeon::State::Movement::Sprinting);
-    const bool bIsDrawn = OwnerASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::WeaponDrawn);
+    const bool bIsSprinting = UKNAbilitySystemComponent::HasState(OwnerASC, EKNStateTag::Sprinting);
+    const bool bIsDrawn = UKNAbilitySystemComponent::HasState(OwnerASC, EKNStateTag::WeaponDrawn);
 
     UE_LOG(LogTemp, Warning,
         TEXT("[DashMontage] InAir:%d / Sprint:%d / Drawn:%d / AirDrawn:%d / SprintDrawn:%d"),
@@ -312,10 +314,7 @@ void UKNAbilityDash::OnInvincibleExpired()
 {
     if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
     {
-        if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::Invincible))
-        {
-            ASC->RemoveLooseGameplayTag(KatanaNeon::State::Combat::Invincible);
-        }
+        UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::Invincible);
     }
 
     if (!bIsDashMontageActive)
@@ -335,10 +334,7 @@ void UKNAbilityDash::OnDashMontageFinished()
     // 몽타주 완료 시 재시전 차단 태그 제거
     if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
     {
-        if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::Dashing))
-        {
-            ASC->RemoveLooseGameplayTag(KatanaNeon::State::Combat::Dashing);
-        }
+        UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::Dashing);
     }
 
     EndAbility(
@@ -3,10 +3,12 @@
 
 #include "GAS/Abilities/KNAbilityJump.h"
 #include "AbilitySystemComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "Characters/Base/KNCharacterBase.h" // ACharacter 대신 고유 베이스 캐릭터
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/DataTable.h"
 #include "GAS/Attributes/KNAttributeSet.h"
+#include "GAS/Components/KNStatsComponent.h"
 #include "GAS/Tags/KNStatsTags.h"
 
 #pragma region 기본 생성자 및 초기화 구현
@@ -26,6 +28,15 @@ UKNAbilityJump::UKNAbilityJump()
 #pragma endregion 기본 생성자 및 초기화 구현
 
 #pragma region GAS 핵심 오버라이드 구현
+void UKNAbilityJump::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+    Super::OnGiveAbility(ActorInfo, Spec);
+
+    // 에디터 행 핸들을 캐시 정수 핸들로 1회 해석합니다. (실패 시 원본 핸들 조회로 폴백)
+    const AActor* Avatar = ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr;
+    JumpSettingRowBinding.Bind(Avatar, &UKNDataManagerSubsystem::GetJumpSettingCache, JumpSettingRowHandle);
+}
+
 bool UKNAbilityJump::CanActivateAbility(
     const FGameplayAbilitySpecHandle Handle,
     const FGameplayAbilityActorInfo* ActorInfo,
@@ -41,7 +52,7 @@ bool UKNAbilityJump::CanActivateAbility(
     if (!JumpSettingRowHandle.DataTable) return false;
 
     // 기획자가 에디터에 할당한 점프 수치 로드
-    const FKNJumpSettingRow* CostRow = JumpSettingRowHandle.GetRow<FKNJumpSettingRow>(TEXT("CanActivateJump"));
+    const FKNJumpSettingRow* CostRow = JumpSettingRowBinding.Get(JumpSettingRowHandle, TEXT("CanActivateJump"));
     if (!CostRow) return false;
 
     AKNCharacterBase* Character = Cast<AKNCharacterBase>(ActorInfo->AvatarActor.Get());
@@ -56,11 +67,8 @@ bool UKNAbilityJump::CanActivateAbility(
 
     if (const UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.Get())
     {
-        if (const UKNAttributeSet* AttrSet = ASC->GetSet<UKNAttributeSet>())
-        {
-            UE_LOG(LogTemp, Error, TEXT("[Jump CanActivate] IsFalling: %d / 현재스태미나: %.1f / 필요스태미나: %.1f"),
-                bIsFalling, AttrSet->GetStamina(), RequiredStamina);
-        }
+        UE_LOG(LogTemp, Error, TEXT("[Jump CanActivate] IsFalling: %d / 현재스태미나: %.1f / 필요스태미나: %.1f"),
+            bIsFalling, UKNStatsComponent::GetEffectiveStamina(ASC), RequiredStamina);
     }
 
     // 공중일 경우: 더블 점프가 활성화되어 있는지, 그리고 이미 더블 점프를 소모했는지 검사
@@ -69,19 +77,17 @@ bool UKNAbilityJump::CanActivateAbility(
         if (!CostRow->bDoubleJumpEnabled) return false;
 
         UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.Get();
-        if (ASC && ASC->HasMatchingGameplayTag(KatanaNeon::State::Movement::DoubleJumped))
+        if (ASC && UKNAbilitySystemComponent::HasState(ASC, EKNStateTag::DoubleJumped))
         {
             return false; // 이미 공중에서 점프를 소모함
         }
     }
 
     // 스태미나 잔량 검사
+    // 아직 어트리뷰트에 확정되지 않은 자연 회복분까지 포함하여 검사합니다.
     if (const UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.Get())
     {
-        if (const UKNAttributeSet* AttrSet = ASC->GetSet<UKNAttributeSet>())
-        {
-            return AttrSet->GetStamina() >= RequiredStamina;
-        }
+        return UKNStatsComponent::GetEffectiveStamina(ASC) >= RequiredStamina;
     }
 
     return false;
@@ -170,7 +176,7 @@ bool UKNAbilityJump::LoadJumpSetting()
         return false;
     }
 
-    const FKNJumpSettingRow* Row = JumpSettingRowHandle.GetRow<FKNJumpSettingRow>(TEXT("LoadJumpSetting"));
+    const FKNJumpSettingRow* Row = JumpSettingRowBinding.Get(JumpSettingRowHandle, TEXT("LoadJumpSetting"));
     if (!ensureAlwaysMsgf(Row, TEXT("[KNAbility_Jump] 지정된 JumpSetting 행을 찾을 수 없습니다!")))
     {
         return false;
@@ -190,8 +196,7 @@ bool UKNAbilityJump::ConsumeStamina(float CostAmount)
 
     if (!ASC || !StaminaCostGEClass) return false;
 
-    FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
-    FGameplayEffectSpecHandle    SpecHandle = ASC->MakeOutgoingSpec(StaminaCostGEClass, 1.0f, Context);
+    FGameplayEffectSpecHandle    SpecHandle = UKNAbilitySystemComponent::MakePooledSpec(ASC, StaminaCostGEClass, 1.0f);
 
     UE_LOG(LogTemp, Error, TEXT("[Jump ConsumeStamina] SpecHandle 유효: %d"), SpecHandle.Data.IsValid());
 
@@ -218,7 +223,7 @@ void UKNAbilityJump::PerformGroundJump(AKNCharacterBase* Character, UCharacterMo
 void UKNAbilityJump::PerformDoubleJump(AKNCharacterBase* Character, UCharacterMovementComponent* Movement, UAbilitySystemComponent* ASC)
 {
     /// 더블 점프 소모 태그 부여 (착지 시 베이스 캐릭터에서 제거해야 함)
-    ASC->AddLooseGameplayTag(KatanaNeon::State::Movement::DoubleJumped);
+    UKNAbilitySystemComponent::AddState(ASC, EKNStateTag::DoubleJumped);
 
     // 에러 회피: FKNJumpSettingRow에 DoubleJumpVelocityMultiplier가 누락되어 일단 기본 점프력을 그대로 사용합니다.
     const float LaunchVelocity = CachedJumpSetting.JumpZVelocity;
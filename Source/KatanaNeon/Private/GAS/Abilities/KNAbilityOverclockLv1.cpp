@@ -3,7 +3,9 @@
 
 #include "GAS/Abilities/KNAbilityOverclockLv1.h"
 #include "AbilitySystemComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "Characters/Base/KNCharacterBase.h"
+#include "Characters/Player/KNPlayerCharacter.h"
 #include "Engine/DataTable.h"
 #include "GAS/Components/KNStatsComponent.h"
 #include "GAS/Tags/KNStatsTags.h" 
@@ -28,6 +30,15 @@ UKNAbilityOverclockLv1::UKNAbilityOverclockLv1()
 #pragma endregion 기본 생성자 및 초기화 구현
 
 #pragma region GAS 핵심 오버라이드 구현
+void UKNAbilityOverclockLv1::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+    Super::OnGiveAbility(ActorInfo, Spec);
+
+    // 에디터 행 핸들을 캐시 정수 핸들로 1회 해석합니다. (실패 시 원본 핸들 조회로 폴백)
+    const AActor* Avatar = ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr;
+    Lv1SettingRowBinding.Bind(Avatar, &UKNDataManagerSubsystem::GetOverclockLv1Cache, Lv1SettingRowHandle);
+}
+
 void UKNAbilityOverclockLv1::ActivateAbility(
     const FGameplayAbilitySpecHandle Handle,
     const FGameplayAbilityActorInfo* ActorInfo,
@@ -101,15 +112,11 @@ void UKNAbilityOverclockLv1::EndAbility(
     // Loose 태그 안전 제거
     if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
     {
-        if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::OverclockTactical))
-        {
-            ASC->RemoveLooseGameplayTag(KatanaNeon::State::Combat::OverclockTactical);
-        }
+        UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::OverclockTactical);
 
-        if (CachedSetting.bStaminaImmune &&
-            ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::StaminaImmune))
+        if (CachedSetting.bStaminaImmune)
         {
-            ASC->RemoveLooseGameplayTag(KatanaNeon::State::Combat::StaminaImmune);
+            UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::StaminaImmune);
         }
     }
 
@@ -126,7 +133,7 @@ bool UKNAbilityOverclockLv1::LoadLv1Setting()
         return false;
     }
 
-    const FKNOverclockLv1Row* Row = Lv1SettingRowHandle.GetRow<FKNOverclockLv1Row>(TEXT("LoadLv1Setting"));
+    const FKNOverclockLv1Row* Row = Lv1SettingRowBinding.Get(Lv1SettingRowHandle, TEXT("LoadLv1Setting"));
 
     if (!ensureAlwaysMsgf(Row, TEXT("[KNAbilityOverclockLv1] 지정된 오버클럭 Lv1 설정 행을 찾을 수 없습니다.")))
     {
@@ -139,12 +146,9 @@ bool UKNAbilityOverclockLv1::LoadLv1Setting()
 
 bool UKNAbilityOverclockLv1::ConsumeOverclockLevel()
 {
-    // 최적화: 범용 ACharacter가 아닌 우리 고유의 베이스 캐릭터로 캐스팅
-    AKNCharacterBase* Owner = Cast<AKNCharacterBase>(GetAvatarActorFromActorInfo());
-    if (!Owner) return false;
-
-    // 활성화 시 1회만 호출되므로 FindComponentByClass 사용이 허용됩니다.
-    UKNStatsComponent* Stats = Owner->FindComponentByClass<UKNStatsComponent>();
+    // 최적화: 플레이어 전투 컨텍스트에 캐시된 스탯 컴포넌트를 사용합니다. (컴포넌트 탐색 없음)
+    const FKNCombatContext* CombatContext = AKNPlayerCharacter::GetCombatContext(GetAvatarActorFromActorInfo());
+    UKNStatsComponent* Stats = CombatContext ? CombatContext->Stats : nullptr;
     if (!Stats)
     {
         UE_LOG(LogTemp, Warning, TEXT("[KNAbilityOverclockLv1] KNStatsComponent를 찾을 수 없습니다!"));
@@ -189,11 +193,11 @@ void UKNAbilityOverclockLv1::GrantStateTags(UAbilitySystemComponent* ASC)
 {
     if (!ASC) return;
 
-    ASC->AddLooseGameplayTag(KatanaNeon::State::Combat::OverclockTactical);
+    UKNAbilitySystemComponent::AddState(ASC, EKNStateTag::OverclockTactical);
 
     if (CachedSetting.bStaminaImmune)
     {
-        ASC->AddLooseGameplayTag(KatanaNeon::State::Combat::StaminaImmune);
+        UKNAbilitySystemComponent::AddState(ASC, EKNStateTag::StaminaImmune);
     }
 }
 
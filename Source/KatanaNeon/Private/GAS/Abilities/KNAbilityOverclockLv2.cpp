@@ -3,12 +3,17 @@
 
 #include "GAS/Abilities/KNAbilityOverclockLv2.h"
 #include "AbilitySystemComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "Abilities/Tasks/AbilityTask_PlayMontageAndWait.h"
-#include "NiagaraFunctionLibrary.h"
+#include "Framework/System/KNCombatVFXSubsystem.h"
+#include "Framework/System/KNProjectileSubsystem.h"
+#include "Framework/System/KNActorPoolSubsystem.h"
 #include "Characters/Base/KNCharacterBase.h" // ACharacter 교체
+#include "Characters/Player/KNPlayerCharacter.h"
 #include "Engine/DataTable.h"
 #include "Objects/Projectiles/KNSlashProjectile.h"
 #include "GAS/Components/KNStatsComponent.h"
+#include "GAS/Effects/KNDamageEffect.h"
 // 존재하지 않는 KNAbilityTags.h 대신 올바른 태그 사전 인클루드
 #include "GAS/Tags/KNStatsTags.h" 
 
@@ -25,10 +30,39 @@ UKNAbilityOverclockLv2::UKNAbilityOverclockLv2()
 
     InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
     NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::LocalPredicted;
+
+    SlashDamageGEClass = UKNDamageEffect::StaticClass();
 }
 #pragma endregion 기본 생성자 및 초기화 구현
 
 #pragma region GAS 핵심 오버라이드 구현
+void UKNAbilityOverclockLv2::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+    Super::OnGiveAbility(ActorInfo, Spec);
+
+    // 에디터 행 핸들을 캐시 정수 핸들로 1회 해석합니다. (실패 시 원본 핸들 조회로 폴백)
+    const AActor* Avatar = ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr;
+    Lv2SettingRowBinding.Bind(Avatar, &UKNDataManagerSubsystem::GetOverclockLv2Cache, Lv2SettingRowHandle);
+
+    // 데미지 GE가 UKNDamageExecution을 실행하지 않으면 Damage SetByCaller가 무시되어 피해가 0이 되므로 기본 데미지 GE로 되돌립니다.
+    if (SlashDamageGEClass && !UKNDamageEffect::IsDamageEffectClass(SlashDamageGEClass))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[KNAbilityOverclockLv2] SlashDamageGEClass(%s)가 UKNDamageEffect 기반이 아닙니다. UKNDamageEffect로 대체합니다."),
+            *GetNameSafe(SlashDamageGEClass.Get()));
+        SlashDamageGEClass = UKNDamageEffect::StaticClass();
+    }
+
+    // 액터 경로일 때만 참격파를 레벨 로드 시점에 풀에 미리 스폰하여 첫 발사 히치를 없앱니다.
+    if (bUseProjectileManager || !SlashProjectileClass) return;
+
+    const FKNOverclockLv2Row* Row = Lv2SettingRowBinding.Get(Lv2SettingRowHandle, TEXT("PrewarmSlashPool"));
+    UKNActorPoolSubsystem* Pool = UKNActorPoolSubsystem::Get(Avatar);
+    if (Row && Pool)
+    {
+        Pool->Prewarm(SlashProjectileClass, Row->SlashPoolSize);
+    }
+}
+
 void UKNAbilityOverclockLv2::ActivateAbility(
     const FGameplayAbilitySpecHandle Handle,
     const FGameplayAbilityActorInfo* ActorInfo,
@@ -115,7 +149,7 @@ bool UKNAbilityOverclockLv2::LoadLv2Setting()
         return false;
     }
 
-    const FKNOverclockLv2Row* Row = Lv2SettingRowHandle.GetRow<FKNOverclockLv2Row>(TEXT("LoadLv2Setting"));
+    const FKNOverclockLv2Row* Row = Lv2SettingRowBinding.Get(Lv2SettingRowHandle, TEXT("LoadLv2Setting"));
 
     if (!ensureAlwaysMsgf(Row, TEXT("[KNAbilityOverclockLv2] 지정된 오버클럭 Lv2 설정 행을 찾을 수 없습니다.")))
     {
@@ -128,12 +162,9 @@ bool UKNAbilityOverclockLv2::LoadLv2Setting()
 
 bool UKNAbilityOverclockLv2::ConsumeOverclockLevel()
 {
-    // 최적화: 범용 ACharacter가 아닌 우리 고유의 베이스 캐릭터로 캐스팅
-    AKNCharacterBase* Owner = Cast<AKNCharacterBase>(GetAvatarActorFromActorInfo());
-    if (!Owner) return false;
-
-    // 활성화 시 1회만 호출되므로 FindComponentByClass 사용이 허용됩니다.
-    UKNStatsComponent* Stats = Owner->FindComponentByClass<UKNStatsComponent>();
+    // 최적화: 플레이어 전투 컨텍스트에 캐시된 스탯 컴포넌트를 사용합니다. (컴포넌트 탐색 없음)
+    const FKNCombatContext* CombatContext = AKNPlayerCharacter::GetCombatContext(GetAvatarActorFromActorInfo());
+    UKNStatsComponent* Stats = CombatContext ? CombatContext->Stats : nullptr;
     if (!Stats)
     {
         UE_LOG(LogTemp, Warning, TEXT("[KNAbilityOverclockLv2] KNStatsComponent를 찾을 수 없습니다!"));
@@ -145,7 +176,7 @@ bool UKNAbilityOverclockLv2::ConsumeOverclockLevel()
 
 void UKNAbilityOverclockLv2::SpawnSlashProjectile(AKNCharacterBase* Owner)
 {
-    if (!Owner || !SlashProjectileClass) return;
+    if (!Owner) return;
 
     // 투사체에 주입할 본체의 ASC
     UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
@@ -157,29 +188,45 @@ void UKNAbilityOverclockLv2::SpawnSlashProjectile(AKNCharacterBase* Owner)
     const FVector SpawnPos = Owner->GetActorLocation() + (Forward * 60.0f);
     const FRotator SpawnRot = Forward.Rotation();
 
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.Instigator = Owner;
-    SpawnParams.Owner = Owner;
-    // 액터 겹침이 발생해도 강제로 스폰시킵니다 (액션 게임 필수 설정)
-    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-    // 지연 스폰(Deferred Spawn) 최적화: 스폰 즉시 BeginPlay가 불리는 것을 막고 데이터 주입 후 수동 시작
-    AKNSlashProjectile* Projectile = GetWorld()->SpawnActorDeferred<AKNSlashProjectile>(
-        SlashProjectileClass, FTransform(SpawnRot, SpawnPos), Owner, Owner, SpawnParams.SpawnCollisionHandlingOverride);
-
-    if (Projectile)
+    UKNProjectileSubsystem* Projectiles = bUseProjectileManager ? UKNProjectileSubsystem::Get(Owner) : nullptr;
+    if (Projectiles && CachedSetting.SlashSpeed > 0.0f)
     {
-        // BeginPlay가 불리기 전에 완벽하게 데이터 주입 (우리가 만든 최적화된 InitProjectile 호출)
-        Projectile->InitProjectile(ASC, SlashDamageGEClass, GrogyGEClass, CachedSetting);
-
-        // 데이터 주입 완료 후 발사체 생명주기 시작
-        Projectile->FinishSpawning(FTransform(SpawnRot, SpawnPos));
+        // ── 관리형 발사체: 액터 스폰 없이 서브시스템 배열에 1발 추가 (수명 = 거리 / 속력) ──
+        FKNProjectileLaunchParams Params;
+        Params.Location = SpawnPos;
+        Params.Velocity = Forward * CachedSetting.SlashSpeed;
+        Params.LifeTime = CachedSetting.SlashMaxDistance / CachedSetting.SlashSpeed;
+        Params.Shape = FCollisionShape::MakeBox(CachedSetting.SlashBoxHalfExtent);
+        Params.Team = Owner->GetTimeTeam();
+        Params.Owner = Owner;
+        Params.SourceASC = ASC;
+        Params.DamageGEClass = SlashDamageGEClass;
+        Params.BaseDamage = CachedSetting.SlashDamage;
+        Params.GrogyGEClass = GrogyGEClass;
+        Params.GrogyDuration = CachedSetting.GrogyDuration;
+        Params.ProxySystem = SlashWaveFX;
+        Projectiles->Launch(Params);
+    }
+    else if (UKNActorPoolSubsystem* Pool = SlashProjectileClass ? UKNActorPoolSubsystem::Get(Owner) : nullptr)
+    {
+        // 풀 재사용: 지연 스폰과 같이 꺼낸 뒤 데이터를 주입하고, FinishAcquire에서 활성화합니다.
+        AKNSlashProjectile* Projectile = Pool->AcquireDeferred(
+            SlashProjectileClass, FTransform(SpawnRot, SpawnPos), Owner, Owner);
+
+        if (Projectile)
+        {
+            Projectile->SetPayload(ASC, SlashDamageGEClass, GrogyGEClass, CachedSetting);
+            Pool->FinishAcquire(Projectile);
+        }
     }
 
     // ── 부가 이펙트 스폰 ──
     if (SlashNiagara)
     {
-        UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), SlashNiagara, SpawnPos, SpawnRot);
+        if (UKNCombatVFXSubsystem* VFX = UKNCombatVFXSubsystem::Get(Owner))
+        {
+            VFX->SpawnAtLocation(SlashNiagara, SpawnPos, SpawnRot, EKNVFXPriority::Essential);
+        }
     }
 }
 bool UKNAbilityOverclockLv2::IsWeaponDrawn() const
@@ -187,6 +234,6 @@ bool UKNAbilityOverclockLv2::IsWeaponDrawn() const
     const UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
     if (!ASC) return false;
 
-    return ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::WeaponDrawn);
+    return UKNAbilitySystemComponent::HasState(ASC, EKNStateTag::WeaponDrawn);
 }
 #pragma endregion 내부 헬퍼 함수 구현
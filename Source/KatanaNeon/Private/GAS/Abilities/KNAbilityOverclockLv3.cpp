@@ -3,9 +3,11 @@
 
 #include "GAS/Abilities/KNAbilityOverclockLv3.h"
 #include "AbilitySystemComponent.h"
-#include "NiagaraFunctionLibrary.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
+#include "Framework/System/KNCombatVFXSubsystem.h"
 #include "Characters/Base/KNCharacterBase.h" // ACharacter 교체
-#include "GameFramework/WorldSettings.h"
+#include "Characters/Player/KNPlayerCharacter.h"
+#include "Framework/System/KNTimeDilationSubsystem.h"
 #include "Engine/DataTable.h"
 #include "GAS/Components/KNStatsComponent.h"
 #include "GAS/Tags/KNStatsTags.h" 
@@ -30,6 +32,15 @@ UKNAbilityOverclockLv3::UKNAbilityOverclockLv3()
 #pragma endregion 기본 생성자 및 초기화 구현
 
 #pragma region GAS 핵심 오버라이드 구현
+void UKNAbilityOverclockLv3::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+    Super::OnGiveAbility(ActorInfo, Spec);
+
+    // 에디터 행 핸들을 캐시 정수 핸들로 1회 해석합니다. (실패 시 원본 핸들 조회로 폴백)
+    const AActor* Avatar = ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr;
+    Lv3SettingRowBinding.Bind(Avatar, &UKNDataManagerSubsystem::GetOverclockLv3Cache, Lv3SettingRowHandle);
+}
+
 void UKNAbilityOverclockLv3::ActivateAbility(
     const FGameplayAbilitySpecHandle Handle,
     const FGameplayAbilityActorInfo* ActorInfo,
@@ -63,8 +74,10 @@ void UKNAbilityOverclockLv3::ActivateAbility(
     // ── 4. Niagara 이펙트 스폰 ──
     if (Owner && TimeStopNiagara)
     {
-        UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-            GetWorld(), TimeStopNiagara, Owner->GetActorLocation());
+        if (UKNCombatVFXSubsystem* VFX = UKNCombatVFXSubsystem::Get(Owner))
+        {
+            VFX->SpawnAtLocation(TimeStopNiagara, Owner->GetActorLocation(), FRotator::ZeroRotator, EKNVFXPriority::Essential);
+        }
     }
 
     // ── 5. 시간 정지 활성화 ──
@@ -78,26 +91,22 @@ void UKNAbilityOverclockLv3::EndAbility(
     bool bReplicateEndAbility,
     bool bWasCancelled)
 {
-    // 타이머 해제
-    if (UWorld* World = GetWorld())
+    // 타이머 해제 및 시간 정지 레이어 제거 (하위 레이어가 있으면 그 배율로 복귀)
+    if (UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this))
     {
-        World->GetTimerManager().ClearTimer(TimeStopTimerHandle);
+        TimeDilation->ClearRealTimeTimer(TimeStopTimerHandle);
     }
 
-    // 시간 정지 중이면 강제로 1.0(정상) 복구
     if (bIsTimeStopped)
     {
-        ApplyTimeDilation(1.0f);
+        ReleaseTimeStopLayers();
         bIsTimeStopped = false;
     }
 
     // 상태 태그 안전 제거
     if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
     {
-        if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::WorldTimeFrozen))
-        {
-            ASC->RemoveLooseGameplayTag(KatanaNeon::State::Combat::WorldTimeFrozen);
-        }
+        UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::WorldTimeFrozen);
     }
 
     Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
@@ -121,7 +130,7 @@ bool UKNAbilityOverclockLv3::LoadLv3Setting()
         return false;
     }
 
-    const FKNOverclockLv3Row* Row = Lv3SettingRowHandle.GetRow<FKNOverclockLv3Row>(TEXT("LoadLv3Setting"));
+    const FKNOverclockLv3Row* Row = Lv3SettingRowBinding.Get(Lv3SettingRowHandle, TEXT("LoadLv3Setting"));
 
     if (!ensureAlwaysMsgf(Row, TEXT("[KNAbilityOverclockLv3] 지정된 오버클럭 Lv3 설정 행을 찾을 수 없습니다.")))
     {
@@ -134,12 +143,9 @@ bool UKNAbilityOverclockLv3::LoadLv3Setting()
 
 bool UKNAbilityOverclockLv3::ConsumeOverclockLevel()
 {
-    // 최적화: 범용 ACharacter가 아닌 우리 고유의 베이스 캐릭터로 캐스팅
-    AKNCharacterBase* Owner = Cast<AKNCharacterBase>(GetAvatarActorFromActorInfo());
-    if (!Owner) return false;
-
-    // 활성화 시 1회만 호출되므로 FindComponentByClass 허용
-    UKNStatsComponent* Stats = Owner->FindComponentByClass<UKNStatsComponent>();
+    // 최적화: 플레이어 전투 컨텍스트에 캐시된 스탯 컴포넌트를 사용합니다. (컴포넌트 탐색 없음)
+    const FKNCombatContext* CombatContext = AKNPlayerCharacter::GetCombatContext(GetAvatarActorFromActorInfo());
+    UKNStatsComponent* Stats = CombatContext ? CombatContext->Stats : nullptr;
     if (!Stats)
     {
         UE_LOG(LogTemp, Warning, TEXT("[KNAbilityOverclockLv3] KNStatsComponent를 찾을 수 없습니다!"));
@@ -149,56 +155,47 @@ bool UKNAbilityOverclockLv3::ConsumeOverclockLevel()
     return Stats->ConsumeOverclockLevel(CachedSetting.OverclockCost);
 }
 
-void UKNAbilityOverclockLv3::ApplyTimeDilation(float WorldScale)
+void UKNAbilityOverclockLv3::ReleaseTimeStopLayers()
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
-
-    // ── GlobalTimeDilation 설정 ──
-    if (AWorldSettings* WS = World->GetWorldSettings())
+    if (UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this))
     {
-        WS->SetTimeDilation(WorldScale);
-    }
-
-    // ── 플레이어 CustomTimeDilation 보정 ──
-    // CustomTimeDilation = 1.0 / GlobalTimeDilation → 플레이어의 체감 속도는 1.0 (정상 유지)
-    if (AKNCharacterBase* Owner = Cast<AKNCharacterBase>(GetAvatarActorFromActorInfo()))
-    {
-        // 0으로 나누는(Divide by Zero) 크래시 방지를 위한 안전장치
-        Owner->CustomTimeDilation = (WorldScale > KINDA_SMALL_NUMBER) ? (1.0f / WorldScale) : 1.0f;
+        TimeDilation->PopLayer(TimeStopFreezeLayer);
+        TimeDilation->PopLayer(TimeStopGlobalLayer);
+        TimeDilation->PopLayer(TimeStopPlayerLayer);
     }
 }
 
 void UKNAbilityOverclockLv3::ActivateTimeStop()
 {
-    // ── 시간 배율 적용 ──
-    ApplyTimeDilation(CachedSetting.WorldTimeDilationScale);
+    UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this);
+    if (!TimeDilation) return;
+
+    // ── 시간 배율 레이어 ──
+    // 월드는 WorldTimeDilationScale로 거의 정지하고, 플레이어는 실시간 레이어로 정상 속도를 유지합니다.
+    // 최상위 우선순위이므로 FlurryRush 슬로우 모션이 겹쳐도 시간 정지가 이깁니다.
+    ReleaseTimeStopLayers();
+    TimeStopGlobalLayer = TimeDilation->PushGlobalLayer(
+        CachedSetting.WorldTimeDilationScale, UKNTimeDilationSubsystem::PriorityTimeStop);
+    TimeStopPlayerLayer = TimeDilation->PushActorLayer(
+        GetAvatarActorFromActorInfo(), 1.0f, UKNTimeDilationSubsystem::PriorityTimeStop, /*bRealTime=*/true);
+
+    // 적 진영(캐릭터·AI 컨트롤러·발사체)은 작은 델타로 계속 틱하는 대신 틱 자체를 정지합니다.
+    // 정지 중 적중은 피격 큐가 GE로 즉시 처리하며, 배율은 콤보가 피격마다 WorldTimeFrozen 상태로 계산합니다.
+    TimeStopFreezeLayer = TimeDilation->PushFreezeLayer(EKNTimeTeam::Enemy);
     bIsTimeStopped = true;
 
     // ── 상태 태그 부여 ──
     if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
     {
-        ASC->AddLooseGameplayTag(KatanaNeon::State::Combat::WorldTimeFrozen);
+        UKNAbilitySystemComponent::AddState(ASC, EKNStateTag::WorldTimeFrozen);
     }
 
     // ── 자동 해제 타이머 설정 ──
-    // 💡 베테랑의 팁: 엔진의 TimeDilation이 극단적으로 낮아지면(예: 0.0001) 일반 타이머도 
-    // 그에 맞춰 느리게 흐릅니다. (5초 타이머가 실제 현실 시간으로 수만 초가 걸릴 수 있음)
-    // 따라서 타이머 세팅 시, 지속 시간에 WorldTimeDilationScale을 곱해주어 
-    // 엔진 틱 기준에 맞추는 방식으로 세팅하는 것이 실무에서 안전한 TimeStop 테크닉입니다.
-
-    float ActualTimerDelay = CachedSetting.TimeStopDuration * CachedSetting.WorldTimeDilationScale;
-    if (ActualTimerDelay < KINDA_SMALL_NUMBER)
-    {
-        ActualTimerDelay = CachedSetting.TimeStopDuration; // 예외 처리 방어
-    }
-
-    GetWorld()->GetTimerManager().SetTimer(
+    // 월드 타이머는 TimeDilation을 따라 느려지므로, 지속 시간은 배율과 무관한 실시간 시계로 잽니다.
+    TimeDilation->SetRealTimeTimer(
         TimeStopTimerHandle,
-        this,
-        &UKNAbilityOverclockLv3::OnTimeStopExpired,
-        ActualTimerDelay,
-        false);
+        FTimerDelegate::CreateUObject(this, &UKNAbilityOverclockLv3::OnTimeStopExpired),
+        CachedSetting.TimeStopDuration);
 
     UE_LOG(LogTemp, Log,
         TEXT("[KNAbilityOverclockLv3] 시간 정지 활성화. GlobalTimeDilation=%.4f, PlayerCustom=%.1f, Duration=%.1f초"),
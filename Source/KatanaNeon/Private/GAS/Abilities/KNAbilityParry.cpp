@@ -3,8 +3,10 @@
 
 #include "GAS/Abilities/KNAbilityParry.h"
 #include "AbilitySystemComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "Characters/Base/KNCharacterBase.h" // ACharacter 교체
-#include "GameFramework/WorldSettings.h"
+#include "Characters/Player/KNPlayerCharacter.h"
+#include "Framework/System/KNTimeDilationSubsystem.h"
 #include "Engine/DataTable.h"
 #include "GAS/Attributes/KNAttributeSet.h"
 #include "GAS/Components/KNStatsComponent.h"
@@ -26,6 +28,16 @@ UKNAbilityParry::UKNAbilityParry()
 #pragma endregion 기본 생성자 및 초기화 구현
 
 #pragma region GAS 핵심 오버라이드 구현
+void UKNAbilityParry::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+    Super::OnGiveAbility(ActorInfo, Spec);
+
+    // 에디터 행 핸들을 캐시 정수 핸들로 1회 해석합니다. (실패 시 원본 핸들 조회로 폴백)
+    const AActor* Avatar = ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr;
+    ActionCostRowBinding.Bind(Avatar, &UKNDataManagerSubsystem::GetActionCostCache, ActionCostRowHandle);
+    OverclockSettingRowBinding.Bind(Avatar, &UKNDataManagerSubsystem::GetOverclockSettingCache, OverclockSettingRowHandle);
+}
+
 bool UKNAbilityParry::CanActivateAbility(
     const FGameplayAbilitySpecHandle Handle,
     const FGameplayAbilityActorInfo* ActorInfo,
@@ -41,15 +53,13 @@ bool UKNAbilityParry::CanActivateAbility(
     // 하드코딩 제거: RowHandle 검사
     if (!ActionCostRowHandle.DataTable) return false;
 
-    const FKNActionCostRow* CostRow = ActionCostRowHandle.GetRow<FKNActionCostRow>(TEXT("CanActivateParry"));
+    const FKNActionCostRow* CostRow = ActionCostRowBinding.Get(ActionCostRowHandle, TEXT("CanActivateParry"));
     if (!CostRow) return false;
 
+    // 아직 어트리뷰트에 확정되지 않은 자연 회복분까지 포함하여 검사합니다.
     if (const UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.Get())
     {
-        if (const UKNAttributeSet* AttrSet = ASC->GetSet<UKNAttributeSet>())
-        {
-            return AttrSet->GetStamina() >= CostRow->ParryStaminaCost;
-        }
+        return UKNStatsComponent::GetEffectiveStamina(ASC) >= CostRow->ParryStaminaCost;
     }
     return false;
 }
@@ -71,7 +81,7 @@ void UKNAbilityParry::ActivateAbility(
     if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
     {
         // O(1) 네이티브 태그 사용
-        ASC->AddLooseGameplayTag(KatanaNeon::State::Combat::Parrying);
+        UKNAbilitySystemComponent::AddState(ASC, EKNStateTag::Parrying);
     }
 
     AKNCharacterBase* Owner = Cast<AKNCharacterBase>(GetAvatarActorFromActorInfo());
@@ -104,33 +114,16 @@ void UKNAbilityParry::EndAbility(
     if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
     {
         // O(1) 네이티브 태그 사용
-        if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::Parrying))
-        {
-            ASC->RemoveLooseGameplayTag(KatanaNeon::State::Combat::Parrying);
-        }
+        UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::Parrying);
     }
 
     if (bIsFlurryRush)
     {
-        if (UWorld* World = GetWorld())
-        {
-            if (AWorldSettings* WS = World->GetWorldSettings())
-            {
-                WS->SetTimeDilation(1.0f);
-            }
-        }
-
-        if (AKNCharacterBase* Owner = Cast<AKNCharacterBase>(GetAvatarActorFromActorInfo()))
-        {
-            Owner->CustomTimeDilation = 1.0f;
-        }
+        ReleaseFlurryRushSlowMotion();
 
         if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
         {
-            if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::FlurryRush))
-            {
-                ASC->RemoveLooseGameplayTag(KatanaNeon::State::Combat::FlurryRush);
-            }
+            UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::FlurryRush);
         }
         bIsFlurryRush = false;
     }
@@ -145,7 +138,7 @@ void UKNAbilityParry::OnEnemyAttackWarningReceived()
     UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
 
     // O(1) 네이티브 태그 사용
-    if (!ASC || !ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::Parrying)) return;
+    if (!ASC || !UKNAbilitySystemComponent::HasState(ASC, EKNStateTag::Parrying)) return;
 
     GetWorld()->GetTimerManager().ClearTimer(ParryWindowTimerHandle);
     OnPerfectParry();
@@ -158,11 +151,10 @@ bool UKNAbilityParry::ConsumeStamina()
     UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
     if (!ASC || !StaminaCostGEClass || !ActionCostRowHandle.DataTable) return false;
 
-    const FKNActionCostRow* CostRow = ActionCostRowHandle.GetRow<FKNActionCostRow>(TEXT("ParryConsumeStamina"));
+    const FKNActionCostRow* CostRow = ActionCostRowBinding.Get(ActionCostRowHandle, TEXT("ParryConsumeStamina"));
     if (!CostRow) return false;
 
-    FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
-    FGameplayEffectSpecHandle    SpecHandle = ASC->MakeOutgoingSpec(StaminaCostGEClass, 1.0f, Context);
+    FGameplayEffectSpecHandle    SpecHandle = UKNAbilitySystemComponent::MakePooledSpec(ASC, StaminaCostGEClass, 1.0f);
 
     if (FGameplayEffectSpec* Spec = SpecHandle.Data.Get())
     {
@@ -177,7 +169,7 @@ void UKNAbilityParry::OnPerfectParry()
     float ParryGain = 50.0f;
     if (OverclockSettingRowHandle.DataTable)
     {
-        if (const FKNOverclockSettingRow* OCRow = OverclockSettingRowHandle.GetRow<FKNOverclockSettingRow>(TEXT("PerfectParryGain")))
+        if (const FKNOverclockSettingRow* OCRow = OverclockSettingRowBinding.Get(OverclockSettingRowHandle, TEXT("PerfectParryGain")))
         {
             ParryGain = OCRow->GainPerfectParry;
         }
@@ -186,7 +178,8 @@ void UKNAbilityParry::OnPerfectParry()
     AKNCharacterBase* Owner = Cast<AKNCharacterBase>(GetAvatarActorFromActorInfo());
     if (Owner)
     {
-        if (UKNStatsComponent* Stats = Owner->FindComponentByClass<UKNStatsComponent>())
+        const FKNCombatContext* CombatContext = AKNPlayerCharacter::GetCombatContext(Owner);
+        if (UKNStatsComponent* Stats = CombatContext ? CombatContext->Stats : nullptr)
         {
             Stats->GainOverclockPoint(ParryGain);
         }
@@ -200,12 +193,9 @@ void UKNAbilityParry::OnPerfectParry()
     if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
     {
         // O(1) 네이티브 태그 사용
-        if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::Parrying))
-        {
-            ASC->RemoveLooseGameplayTag(KatanaNeon::State::Combat::Parrying);
-        }
+        UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::Parrying);
 
-        ASC->AddLooseGameplayTag(KatanaNeon::State::Combat::FlurryRush);
+        UKNAbilitySystemComponent::AddState(ASC, EKNStateTag::FlurryRush);
     }
 
     bIsFlurryRush = true;
@@ -221,41 +211,35 @@ void UKNAbilityParry::OnPerfectParry()
 
 void UKNAbilityParry::ActivateFlurryRushSlowMotion()
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
+    UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this);
+    if (!TimeDilation) return;
 
-    if (AWorldSettings* WS = World->GetWorldSettings())
-    {
-        WS->SetTimeDilation(FlurrySlowMotionScale);
-    }
+    // 재발동 시 이전 레이어가 남지 않도록 먼저 해제합니다.
+    ReleaseFlurryRushSlowMotion();
 
-    if (AKNCharacterBase* Owner = Cast<AKNCharacterBase>(GetAvatarActorFromActorInfo()))
-    {
-        Owner->CustomTimeDilation = 1.0f / FlurrySlowMotionScale;
-    }
+    // 월드를 감속하고, 플레이어는 실시간 레이어로 정상 속도를 유지합니다.
+    // 더 높은 우선순위(Lv3 시간 정지)가 겹치면 그쪽이 이기고, 해제 시 이 레이어가 다시 드러납니다.
+    FlurryGlobalLayer = TimeDilation->PushGlobalLayer(FlurrySlowMotionScale, UKNTimeDilationSubsystem::PriorityFlurryRush);
+    FlurryPlayerLayer = TimeDilation->PushActorLayer(
+        GetAvatarActorFromActorInfo(), 1.0f, UKNTimeDilationSubsystem::PriorityFlurryRush, /*bRealTime=*/true);
 }
 
-void UKNAbilityParry::DeactivateFlurryRush()
+void UKNAbilityParry::ReleaseFlurryRushSlowMotion()
 {
-    if (UWorld* World = GetWorld())
+    if (UKNTimeDilationSubsystem* TimeDilation = UKNTimeDilationSubsystem::Get(this))
     {
-        if (AWorldSettings* WS = World->GetWorldSettings())
-        {
-            WS->SetTimeDilation(1.0f);
-        }
+        TimeDilation->PopLayer(FlurryGlobalLayer);
+        TimeDilation->PopLayer(FlurryPlayerLayer);
     }
+}
 
-    if (AKNCharacterBase* Owner = Cast<AKNCharacterBase>(GetAvatarActorFromActorInfo()))
-    {
-        Owner->CustomTimeDilation = 1.0f;
-    }
+void UKNAbilityParry::DeactivateFlurryRush()
+{
+    ReleaseFlurryRushSlowMotion();
 
     if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
     {
-        if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::FlurryRush))
-        {
-            ASC->RemoveLooseGameplayTag(KatanaNeon::State::Combat::FlurryRush);
-        }
+        UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::FlurryRush);
     }
 
     bIsFlurryRush = false;
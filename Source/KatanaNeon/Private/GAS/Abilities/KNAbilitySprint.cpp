@@ -3,6 +3,7 @@
 
 #include "GAS/Abilities/KNAbilitySprint.h"
 #include "AbilitySystemComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "Framework/System/KNDataManagerSubsystem.h"
 #include "Data/Structs/KNPlayerStatTable.h"
 #include "GAS/Tags/KNStatsTags.h"
@@ -57,8 +58,8 @@ void UKNAbilitySprint::ActivateAbility(
         return;
     }
 
-    // ── 베테랑의 최적화: 서브시스템을 통한 O(1) 데이터 조회 및 동적 차이값(Delta) 계산 ──
-    if (const FKNBaseStatRow* BaseStat = DataManager->GetPlayerBaseStat(TEXT("Default")))
+    // ── 베테랑의 최적화: 평탄화 캐시의 미리 해석된 "Default" 핸들로 해시 조회 없이 행 참조 ──
+    if (const FKNBaseStatRow* BaseStat = DataManager->GetPlayerBaseStatCache().GetDefault())
     {
         // 목표 속도(1000) - 기본 속도(700) = 증가시킬 속도(+300)
         // 이렇게 해야 추후 오버클럭의 배율 연산 등과 완벽하게 호환됩니다.
@@ -79,11 +80,11 @@ void UKNAbilitySprint::ActivateAbility(
         }
     }
     // 달리기 상태 태그 부여 — 대시 등 외부에서 감지할 수 있도록 합니다.
-    ASC->AddLooseGameplayTag(KatanaNeon::State::Movement::Sprinting);
+    UKNAbilitySystemComponent::AddState(ASC, EKNStateTag::Sprinting);
 
     UE_LOG(LogTemp, Warning,
         TEXT("[Sprint] Sprinting 태그 부여됨: %d"),
-        ASC->HasMatchingGameplayTag(KatanaNeon::State::Movement::Sprinting));
+        UKNAbilitySystemComponent::HasState(ASC, EKNStateTag::Sprinting));
 
 }
 
@@ -104,10 +105,7 @@ void UKNAbilitySprint::EndAbility(
         }
 
         // 달리기 상태 태그 제거
-        if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Movement::Sprinting))
-        {
-            ASC->RemoveLooseGameplayTag(KatanaNeon::State::Movement::Sprinting);
-        }
+        UKNAbilitySystemComponent::RemoveState(ASC, EKNStateTag::Sprinting);
     }
 
     Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
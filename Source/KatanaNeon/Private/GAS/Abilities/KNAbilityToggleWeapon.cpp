@@ -3,6 +3,7 @@
 
 #include "GAS/Abilities/KNAbilityToggleWeapon.h"
 #include "AbilitySystemComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "Abilities/Tasks/AbilityTask_PlayMontageAndWait.h"
 #include "GAS/Tags/KNStatsTags.h"
 
@@ -35,7 +36,7 @@ void UKNAbilityToggleWeapon::ActivateAbility(
     }
 
     // 1. 현재 무기를 들고 있는지(WeaponDrawn 태그 존재 여부) 검사
-    bool bIsDrawn = ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::WeaponDrawn);
+    bool bIsDrawn = UKNAbilitySystemComponent::HasState(ASC, EKNStateTag::WeaponDrawn);
 
     // 2. 상태에 맞춰 재생할 몽타주 동적 선택 (하드코딩 분기문 배제)
     UAnimMontage* MontageToPlay = bIsDrawn ? SheathMontage : DrawMontage;
@@ -5,6 +5,8 @@
 #include "GameplayEffectExtension.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "GAS/Components/KNStatsComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 
 #pragma region 기본 생성자 및 초기화 구현
 UKNAttributeSet::UKNAttributeSet()
@@ -48,6 +50,26 @@ void UKNAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, fl
     }
 }
 
+bool UKNAttributeSet::PreGameplayEffectExecute(FGameplayEffectModCallbackData& Data)
+{
+    if (!Super::PreGameplayEffectExecute(Data)) return false;
+
+    // 스태미나/오버클럭 Additive GE에는 해석적 회복·감소분을 수치에 합산합니다.
+    // BaseValue를 실행 도중 따로 쓰지 않으므로 GE 실행이 재진입하지 않습니다.
+    if (Data.EvaluatedData.ModifierOp != EGameplayModOp::Additive) return true;
+
+    const bool bStamina = Data.EvaluatedData.Attribute == GetStaminaAttribute();
+    const bool bOverclock = Data.EvaluatedData.Attribute == GetOverclockPointAttribute();
+    if (!bStamina && !bOverclock) return true;
+
+    if (UKNStatsComponent* Stats = UKNAbilitySystemComponent::GetStats(&Data.Target))
+    {
+        float& Magnitude = Data.EvaluatedData.Magnitude;
+        Magnitude = bStamina ? Stats->FoldPendingStaminaRegen(Magnitude) : Stats->FoldPendingOverclockDecay(Magnitude);
+    }
+    return true;
+}
+
 void UKNAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
 {
     Super::PostGameplayEffectExecute(Data);
@@ -0,0 +1,128 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GAS/Components/KNAbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "UObject/UObjectIterator.h"
+#include "HAL/IConsoleManager.h"
+
+#pragma region 상태 태그 조회 및 조작 구현
+void UKNAbilitySystemComponent::AddStateTag(EKNStateTag Tag)
+{
+    AddLooseGameplayTag(FKNStateTagBits::GetTag(Tag));
+}
+
+void UKNAbilitySystemComponent::RemoveStateTag(EKNStateTag Tag)
+{
+    if (!StateBits.Has(Tag)) return;
+
+    RemoveLooseGameplayTag(FKNStateTagBits::GetTag(Tag));
+}
+
+bool UKNAbilitySystemComponent::HasState(const UAbilitySystemComponent* InASC, EKNStateTag Tag)
+{
+    if (const UKNAbilitySystemComponent* KNASC = Cast<UKNAbilitySystemComponent>(InASC))
+    {
+        return KNASC->HasStateTag(Tag);
+    }
+    return InASC && InASC->HasMatchingGameplayTag(FKNStateTagBits::GetTag(Tag));
+}
+
+void UKNAbilitySystemComponent::AddState(UAbilitySystemComponent* InASC, EKNStateTag Tag)
+{
+    if (!InASC) return;
+
+    InASC->AddLooseGameplayTag(FKNStateTagBits::GetTag(Tag));
+}
+
+void UKNAbilitySystemComponent::RemoveState(UAbilitySystemComponent* InASC, EKNStateTag Tag)
+{
+    if (UKNAbilitySystemComponent* KNASC = Cast<UKNAbilitySystemComponent>(InASC))
+    {
+        KNASC->RemoveStateTag(Tag);
+    }
+    else if (InASC && InASC->HasMatchingGameplayTag(FKNStateTagBits::GetTag(Tag)))
+    {
+        InASC->RemoveLooseGameplayTag(FKNStateTagBits::GetTag(Tag));
+    }
+}
+#pragma endregion 상태 태그 조회 및 조작 구현
+
+#pragma region GE 스펙 캐시 구현
+FGameplayEffectSpecHandle UKNAbilitySystemComponent::MakePooledSpec(
+    UAbilitySystemComponent* InASC,
+    TSubclassOf<UGameplayEffect> EffectClass,
+    float Level,
+    AActor* Instigator,
+    AActor* EffectCauser)
+{
+    if (!InASC || !EffectClass) return FGameplayEffectSpecHandle();
+
+    if (UKNAbilitySystemComponent* KNASC = Cast<UKNAbilitySystemComponent>(InASC))
+    {
+        return KNASC->SpecCache.Acquire(*KNASC, EffectClass, Level, Instigator, EffectCauser);
+    }
+
+    FGameplayEffectContextHandle Context = InASC->MakeEffectContext();
+    if (Instigator || EffectCauser)
+    {
+        Context.AddInstigator(
+            Instigator ? Instigator : InASC->GetOwnerActor(),
+            EffectCauser ? EffectCauser : InASC->GetAvatarActor());
+    }
+    return InASC->MakeOutgoingSpec(EffectClass, Level, Context);
+}
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+    /** @brief 월드 내 UKNAbilitySystemComponent의 스펙 캐시 카운터를 출력합니다. ("reset" 인자 시 출력 후 초기화) */
+    FAutoConsoleCommandWithWorldAndArgs GKNSpecCacheStatsCommand(
+        TEXT("KN.GAS.SpecCacheStats"),
+        TEXT("ASC별 GE 스펙/컨텍스트 생성 대비 재사용 횟수를 출력합니다. 인자 reset 시 카운터를 초기화합니다."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            const bool bReset = Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase);
+
+            for (TObjectIterator<UKNAbilitySystemComponent> It; It; ++It)
+            {
+                UKNAbilitySystemComponent* KNASC = *It;
+                if (KNASC->GetWorld() != World) continue;
+
+                const FKNEffectSpecCacheStats& Stats = KNASC->GetSpecCacheStats();
+                UE_LOG(LogTemp, Log, TEXT("[KNAbilitySystemComponent] %s: Spec 생성 %d / 재사용 %d (사용 중 건너뜀 %d), Context 생성 %d / 재사용 %d, 우회 %d"),
+                    *GetNameSafe(KNASC->GetAvatarActor()),
+                    Stats.SpecsCreated, Stats.SpecsReused, Stats.InUseSkipped,
+                    Stats.ContextsCreated, Stats.ContextsReused,
+                    Stats.Bypassed);
+
+                if (bReset)
+                {
+                    KNASC->ResetSpecCacheStats();
+                }
+            }
+        }));
+}
+#endif
+#pragma endregion GE 스펙 캐시 구현
+
+#pragma region 스탯 컴포넌트 캐시 구현
+UKNStatsComponent* UKNAbilitySystemComponent::GetStats(const UAbilitySystemComponent* InASC)
+{
+    const UKNAbilitySystemComponent* KNASC = Cast<UKNAbilitySystemComponent>(InASC);
+    return KNASC ? KNASC->GetStatsComponent() : nullptr;
+}
+#pragma endregion 스탯 컴포넌트 캐시 구현
+
+#pragma region GAS 핵심 오버라이드 구현
+void UKNAbilitySystemComponent::OnTagUpdated(const FGameplayTag& Tag, bool TagExists)
+{
+    Super::OnTagUpdated(Tag, TagExists);
+
+    const EKNStateTag Index = FKNStateTagBits::ToIndex(Tag);
+    if (Index != EKNStateTag::Count)
+    {
+        StateBits.Set(Index, TagExists);
+    }
+}
+#pragma endregion GAS 핵심 오버라이드 구현
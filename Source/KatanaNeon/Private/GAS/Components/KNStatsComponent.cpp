@@ -3,6 +3,7 @@
 
 #include "GAS/Components/KNStatsComponent.h"
 #include "AbilitySystemComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "GameplayEffect.h"
 #include "GameplayEffectExtension.h"
 
@@ -35,6 +36,11 @@ void UKNStatsComponent::InitializeStatComponent(UAbilitySystemComponent* InASC)
     if (!ensure(InASC)) return;
 
     ASC = InASC;
+    // 어트리뷰트 셋과 어빌리티 비용 검사가 컴포넌트 탐색 없이 이 컴포넌트를 찾도록 ASC에 등록합니다.
+    if (UKNAbilitySystemComponent* KNASC = Cast<UKNAbilitySystemComponent>(ASC))
+    {
+        KNASC->SetStatsComponent(this);
+    }
     // ── 베테랑의 정석 반영: const_cast 삭제, 순수 const 포인터로 안전하게 캐싱 ──
     AttributeSet = ASC->GetSet<UKNAttributeSet>();
 
@@ -51,6 +57,7 @@ void UKNStatsComponent::InitializeStatComponent(UAbilitySystemComponent* InASC)
 
     if (CostRow) ActionCost = *CostRow;
     if (OCRow) OverclockSetting = *OCRow;
+    OverclockMeter.Configure(OverclockSetting);
 
     // MaxOverclockPoint 초기화를 위해 OCRow도 함께 넘깁니다.
     if (BaseRow && OCRow)
@@ -73,12 +80,24 @@ void UKNStatsComponent::InitializeStatComponent(UAbilitySystemComponent* InASC)
         if (Data.NewValue < Data.OldValue)
         {
             RestartRegenDelay();
+        }
+        // 회복 중 외부 증가(확정 포함)가 있으면 새 값으로 기준점을 다시 잡습니다.
+        else if (IsStaminaRegenerating())
+        {
+            StartStaminaRegen();
         }
             });
 
+    // 회복률/최대치 변경 시 기존 회복분을 확정하고 새 파라미터로 재기준화합니다.
+    ASC->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetStaminaRegenRateAttribute())
+        .AddUObject(this, &UKNStatsComponent::OnStaminaRegenParamsChanged);
+    ASC->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetMaxStaminaAttribute())
+        .AddUObject(this, &UKNStatsComponent::OnStaminaRegenParamsChanged);
+
     ASC->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetChronosAttribute())
         .AddWeakLambda(this, [this](const FOnAttributeChangeData& Data) {
-        OnChronosChanged.Broadcast(Data.NewValue, AttributeSet->GetMaxChronos());
+        // 소모 중에는 외부 증감을 반영한 해석적 잔량을 전달합니다.
+        OnChronosChanged.Broadcast(GetCurrentChronos(), AttributeSet->GetMaxChronos());
             });
 
     // 무기 상태 태그 변경 감지
@@ -107,9 +126,11 @@ void UKNStatsComponent::InitializeStatComponent(UAbilitySystemComponent* InASC)
     ASC->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetOverclockPointAttribute())
         .AddUObject(this, &UKNStatsComponent::OnOverclockPointChangedInternal);
 
-    SyncOverclockLevelTags(AttributeSet->GetOverclockPoint());
+    OverclockMeter.ResetAnchor(AttributeSet->GetOverclockPoint(), GetWorld()->GetTimeSeconds());
+    ApplyOverclockLevel(AttributeSet->GetOverclockPoint());
+    ScheduleOverclockDecay();
 
-    // ── 스태미나 자연 회복 타이머 시작 (ApplyBaseStats 완료 후 시점 보장) ──
+    // ── 스태미나 자연 회복 시작 (ApplyBaseStats 완료 후 시점 보장) ──
     StartStaminaRegen();
 
     OnHealthChanged.Broadcast(AttributeSet->GetHealth(), AttributeSet->GetMaxHealth());
@@ -131,7 +152,7 @@ bool UKNStatsComponent::ConsumeOverclockLevel(float Cost)
 {
     if (!ASC || !AttributeSet) return false;
     if (Cost <= 0.0f) return false;
-    if (AttributeSet->GetOverclockPoint() < Cost) return false;
+    if (GetCurrentOverclockPoint() < Cost) return false;
 
     ApplyInstantGEInternal(KatanaNeon::Data::Stats::OverclockPoint, -Cost);
     return true;
@@ -141,22 +162,162 @@ bool UKNStatsComponent::ConsumeOverclockLevel(float Cost)
 #pragma region 데이터 조회 구현
 int32 UKNStatsComponent::GetCurrentOverclockLevel() const
 {
-    if (!ASC) return 0;
+    return OverclockMeter.GetLevel();
+}
+
+float UKNStatsComponent::GetCurrentOverclockPoint() const
+{
+    const UWorld* World = GetWorld();
+    if (!AttributeSet || !World) return 0.0f;
+
+    return OverclockMeter.GetPoint(World->GetTimeSeconds());
+}
+
+bool UKNStatsComponent::IsOverclockDecaying() const
+{
+    const UWorld* World = GetWorld();
+    return AttributeSet && World && OverclockMeter.IsDecaying(World->GetTimeSeconds());
+}
+
+void UKNStatsComponent::CommitOverclockDecay()
+{
+    if (!ASC || !AttributeSet) return;
+
+    const float Decayed = GetCurrentOverclockPoint();
+    if (Decayed >= AttributeSet->GetOverclockPoint()) return;
+
+    // 변경 델리게이트가 감소 확정임을 알 수 있도록 표시합니다. (유예 재시작 방지)
+    TGuardValue<bool> CommitGuard(bCommittingOverclockDecay, true);
+    ASC->SetNumericAttributeBase(AttributeSet->GetOverclockPointAttribute(), Decayed);
+}
+
+float UKNStatsComponent::FoldPendingOverclockDecay(float Magnitude) const
+{
+    if (!AttributeSet) return Magnitude;
+
+    // 감소분은 0 이하이며, 이어지는 변경 델리게이트가 새 값으로 감소 기준점을 다시 잡습니다.
+    const float PendingDecay = FMath::Min(0.0f, GetCurrentOverclockPoint() - AttributeSet->GetOverclockPoint());
+    return Magnitude + PendingDecay;
+}
+
+float UKNStatsComponent::GetCurrentStamina() const
+{
+    if (!AttributeSet) return 0.0f;
+
+    const float AttributeStamina = AttributeSet->GetStamina();
+    const UWorld* World = GetWorld();
+    if (!IsStaminaRegenerating() || !World) return AttributeStamina;
+
+    const float Elapsed = FMath::Max(0.0f, World->GetTimeSeconds() - RegenAnchorTime);
+    const float Regenerated = FMath::Min(RegenAnchorStamina + RegenAnchorRate * Elapsed, AttributeSet->GetMaxStamina());
+    return FMath::Max(AttributeStamina, Regenerated);
+}
+
+void UKNStatsComponent::CommitStaminaRegen()
+{
+    if (!ASC || !AttributeSet || !IsStaminaRegenerating()) return;
+
+    const float Current = GetCurrentStamina();
+    if (Current <= AttributeSet->GetStamina()) return;
+
+    // 기준점을 먼저 옮겨 두어야 변경 델리게이트 재진입 시 회복분이 이중 반영되지 않습니다.
+    RegenAnchorStamina = Current;
+    RegenAnchorTime = GetWorld()->GetTimeSeconds();
+
+    // GE 스펙 없이 BaseValue만 갱신합니다. (변경 델리게이트 → HUD 1회 갱신)
+    ASC->SetNumericAttributeBase(AttributeSet->GetStaminaAttribute(), Current);
+}
+
+float UKNStatsComponent::FoldPendingStaminaRegen(float Magnitude)
+{
+    if (!AttributeSet || !IsStaminaRegenerating()) return Magnitude;
+
+    const float Current = GetCurrentStamina();
+    const float PendingRegen = FMath::Max(0.0f, Current - AttributeSet->GetStamina());
+
+    // 회복분은 이 GE가 BaseValue에 함께 써 넣으므로, 기준점을 먼저 옮겨 변경 델리게이트에서 이중 반영되지 않게 합니다.
+    RegenAnchorStamina = Current;
+    RegenAnchorTime = GetWorld()->GetTimeSeconds();
+
+    // 소모는 회복분과 합쳐 순증가가 되더라도 딜레이를 다시 시작해야 합니다.
+    if (Magnitude < 0.0f)
+    {
+        RestartRegenDelay();
+    }
+    return Magnitude + PendingRegen;
+}
+
+float UKNStatsComponent::GetEffectiveStamina(const UAbilitySystemComponent* InASC)
+{
+    if (!InASC) return 0.0f;
+
+    if (const UKNStatsComponent* Stats = UKNAbilitySystemComponent::GetStats(InASC))
+    {
+        return Stats->GetCurrentStamina();
+    }
+
+    const UKNAttributeSet* Attrs = InASC->GetSet<UKNAttributeSet>();
+    return Attrs ? Attrs->GetStamina() : 0.0f;
+}
+
+float UKNStatsComponent::GetCurrentChronos() const
+{
+    if (!AttributeSet) return 0.0f;
 
-    // 동적 문자열 할당을 지우고 컴파일 타임 네이티브 상수로 완벽 교체
-    if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Overclock::Lv3)) return 3;
-    if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Overclock::Lv2)) return 2;
-    if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Overclock::Lv1)) return 1;
+    const float AttributeChronos = AttributeSet->GetChronos();
+    const UWorld* World = GetWorld();
+    if (!IsChronosDraining() || !World) return AttributeChronos;
 
-    return 0;
+    const float Elapsed = FMath::Max(0.0f, World->GetTimeSeconds() - ChronosDrainStartTime);
+    return FMath::Max(0.0f, AttributeChronos - ChronosDrainRate * Elapsed);
 }
 #pragma endregion 데이터 조회 구현
 
+#pragma region 크로노스 소모 API 구현
+void UKNStatsComponent::BeginChronosDrain(float DrainRatePerSecond)
+{
+    const UWorld* World = GetWorld();
+    if (!World) return;
+
+    ChronosDrainStartTime = World->GetTimeSeconds();
+    ChronosDrainRate = FMath::Max(0.0f, DrainRatePerSecond);
+}
+
+float UKNStatsComponent::EndChronosDrain()
+{
+    if (!IsChronosDraining() || !AttributeSet) return 0.0f;
+
+    // 상태를 먼저 해제하여, 호출자의 확정 GE가 발생시키는 델리게이트가 어트리뷰트 값을 그대로 전달하게 합니다.
+    const float Drained = AttributeSet->GetChronos() - GetCurrentChronos();
+    ChronosDrainStartTime = -1.0f;
+    ChronosDrainRate = 0.0f;
+    return FMath::Max(0.0f, Drained);
+}
+
+float UKNStatsComponent::GetChronosTimeToDepletion() const
+{
+    if (!IsChronosDraining() || ChronosDrainRate <= 0.0f) return -1.0f;
+    return GetCurrentChronos() / ChronosDrainRate;
+}
+#pragma endregion 크로노스 소모 API 구현
+
 #pragma region 내부 콜백 및 헬퍼 구현
 void UKNStatsComponent::OnOverclockPointChangedInternal(const FOnAttributeChangeData& Data)
 {
     // Clamp 로직은 KNAttributeSet이 담당하므로, 여기서는 순수하게 동기화만 처리합니다.
-    SyncOverclockLevelTags(Data.NewValue);
+    const float Now = GetWorld()->GetTimeSeconds();
+    if (bCommittingOverclockDecay)
+    {
+        OverclockMeter.CommitAnchor(Data.NewValue, Now);
+    }
+    else
+    {
+        // 획득/소모는 전투 중임을 의미하므로 감소 유예를 다시 시작합니다.
+        OverclockMeter.ResetAnchor(Data.NewValue, Now);
+    }
+
+    ApplyOverclockLevel(Data.NewValue);
+    ScheduleOverclockDecay();
     // 하드코딩된 300.0f 맥스값을 런타임 캐시 변수로 대체
     OnOverclockPointChanged.Broadcast(Data.NewValue, OverclockSetting.MaxOverclockPoint);
 }
@@ -187,42 +348,62 @@ void UKNStatsComponent::ApplyBaseStats(const FKNBaseStatRow* BaseStatRow, const
     }
 }
 
-void UKNStatsComponent::SyncOverclockLevelTags(float CurrentPoint)
+void UKNStatsComponent::ApplyOverclockLevel(float CurrentPoint)
 {
-    // 데이터 드라이븐 연동 완료
-    const bool bLv1 = CurrentPoint >= OverclockSetting.Lv1Threshold;
-    const bool bLv2 = CurrentPoint >= OverclockSetting.Lv2Threshold;
-    const bool bLv3 = CurrentPoint >= OverclockSetting.Lv3Threshold;
+    // 임계값을 넘지 않은 변화는 태그/이벤트 비용이 0입니다.
+    int32 OldLevel = 0;
+    if (!ASC || !OverclockMeter.UpdateLevel(CurrentPoint, OldLevel)) return;
 
-    SetGameplayTagActive(KatanaNeon::State::Overclock::Lv1, bLv1);
-    SetGameplayTagActive(KatanaNeon::State::Overclock::Lv2, bLv2);
-    SetGameplayTagActive(KatanaNeon::State::Overclock::Lv3, bLv3);
+    const EKNStateTag LevelTags[FKNOverclockMeter::MaxLevel] =
+    {
+        EKNStateTag::OverclockLv1,
+        EKNStateTag::OverclockLv2,
+        EKNStateTag::OverclockLv3,
+    };
+
+    // 레벨 태그는 이 컴포넌트만 관리하므로 돌파한 구간만 증감합니다.
+    const int32 NewLevel = OverclockMeter.GetLevel();
+    for (int32 Level = OldLevel; Level < NewLevel; ++Level)
+    {
+        UKNAbilitySystemComponent::AddState(ASC, LevelTags[Level]);
+    }
+    for (int32 Level = OldLevel; Level > NewLevel; --Level)
+    {
+        UKNAbilitySystemComponent::RemoveState(ASC, LevelTags[Level - 1]);
+    }
 
-    const int32 NewLevel = bLv3 ? 3 : bLv2 ? 2 : bLv1 ? 1 : 0;
     OnOverclockLevelChanged.Broadcast(NewLevel);
 }
 
-void UKNStatsComponent::SetGameplayTagActive(const FGameplayTag& Tag, bool bGrant)
+void UKNStatsComponent::ScheduleOverclockDecay()
 {
-    if (!ASC || !Tag.IsValid()) return;
+    UWorld* World = GetWorld();
+    if (!World) return;
 
-    const bool bHas = ASC->HasMatchingGameplayTag(Tag);
-    if (bGrant && !bHas)
-    {
-        ASC->AddLooseGameplayTag(Tag);
-    }
-    else if (!bGrant && bHas)
-    {
-        ASC->RemoveLooseGameplayTag(Tag);
-    }
+    World->GetTimerManager().ClearTimer(OverclockDecayTimerHandle);
+
+    const float EventTime = OverclockMeter.GetNextDecayEventTime();
+    if (EventTime < 0.0f) return;
+
+    // 프레임 타이머 대신 다음 임계값 돌파 시각에만 깨어납니다.
+    World->GetTimerManager().SetTimer(
+        OverclockDecayTimerHandle,
+        this,
+        &UKNStatsComponent::OnOverclockDecayEvent,
+        FMath::Max(EventTime - World->GetTimeSeconds(), UE_KINDA_SMALL_NUMBER),
+        /*bLoop=*/false);
+}
+
+void UKNStatsComponent::OnOverclockDecayEvent()
+{
+    CommitOverclockDecay();
 }
 
 bool UKNStatsComponent::ApplyInstantGEInternal(const FGameplayTag& StatTag, float Delta)
 {
     if (!ASC || !InstantGEClass || !StatTag.IsValid()) return false;
 
-    FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
-    FGameplayEffectSpecHandle SpecHandle = ASC->MakeOutgoingSpec(InstantGEClass, 1.0f, Context);
+    FGameplayEffectSpecHandle SpecHandle = UKNAbilitySystemComponent::MakePooledSpec(ASC, InstantGEClass, 1.0f);
     if (FGameplayEffectSpec* Spec = SpecHandle.Data.Get())
     {
         Spec->SetSetByCallerMagnitude(StatTag, Delta);
@@ -235,31 +416,53 @@ bool UKNStatsComponent::ApplyInstantGEInternal(const FGameplayTag& StatTag, floa
 void UKNStatsComponent::StartStaminaRegen()
 {
     UWorld* World = GetWorld();
-    if (!World) return;
+    if (!World || !AttributeSet) return;
+
+    World->GetTimerManager().ClearTimer(StaminaRegenTimerHandle);
+    RegenAnchorTime = -1.0f;
+
+    const float Stamina = AttributeSet->GetStamina();
+    const float MaxStamina = AttributeSet->GetMaxStamina();
+    const float RegenRate = AttributeSet->GetStaminaRegenRate();
+
+    // 이미 최대치이거나 회복률이 없으면 회복 구간에 들어가지 않습니다.
+    if (RegenRate <= 0.0f || Stamina >= MaxStamina) return;
 
-    // 중복 실행 방지
-    if (World->GetTimerManager().IsTimerActive(StaminaRegenTimerHandle)) return;
+    RegenAnchorTime = World->GetTimeSeconds();
+    RegenAnchorStamina = Stamina;
+    RegenAnchorRate = RegenRate;
 
+    // 주기 틱 대신 최대치 도달 시점에 단 한 번만 깨어납니다.
     World->GetTimerManager().SetTimer(
         StaminaRegenTimerHandle,
         this,
-        &UKNStatsComponent::OnStaminaRegenTick,
-        StaminaRegenTickInterval,
-        /*bLoop=*/true);
+        &UKNStatsComponent::OnStaminaRegenCapReached,
+        (MaxStamina - Stamina) / RegenRate,
+        /*bLoop=*/false);
 }
 
-void UKNStatsComponent::OnStaminaRegenTick()
+void UKNStatsComponent::OnStaminaRegenCapReached()
 {
     if (!ASC || !AttributeSet) return;
 
-    // 이미 최대치면 GE 호출 비용 자체를 차단합니다.
-    if (AttributeSet->GetStamina() >= AttributeSet->GetMaxStamina()) return;
+    // 부동소수 오차로 최대치 직전에 멈추지 않도록 최대치로 확정하고 회복 구간을 종료합니다.
+    RegenAnchorTime = -1.0f;
+    if (AttributeSet->GetStamina() < AttributeSet->GetMaxStamina())
+    {
+        ASC->SetNumericAttributeBase(AttributeSet->GetStaminaAttribute(), AttributeSet->GetMaxStamina());
+    }
+}
 
-    // 초당 회복량 × 틱 간격 = 이번 틱 회복량 (매직넘버 없이 어트리뷰트에서 직접 조회)
-    const float RegenThisTick = AttributeSet->GetStaminaRegenRate() * StaminaRegenTickInterval;
-    if (RegenThisTick <= 0.0f) return;
+void UKNStatsComponent::OnStaminaRegenParamsChanged(const FOnAttributeChangeData& Data)
+{
+    // 소모 딜레이 중이면 딜레이 종료 시점에 새 파라미터로 시작되므로 할 일이 없습니다.
+    const UWorld* World = GetWorld();
+    if (!World || World->GetTimerManager().IsTimerActive(StaminaRegenDelayHandle)) return;
 
-    ApplyInstantGEInternal(KatanaNeon::Data::Stats::Stamina, RegenThisTick);
+    // 기존 회복률로 쌓인 양을 확정한 뒤 새 회복률/최대치로 기준점을 다시 잡습니다.
+    // (최대치 상태에서 MaxStamina가 늘어난 경우에도 여기서 회복이 재개됩니다.)
+    CommitStaminaRegen();
+    StartStaminaRegen();
 }
 
 void UKNStatsComponent::RestartRegenDelay()
@@ -267,7 +470,9 @@ void UKNStatsComponent::RestartRegenDelay()
     UWorld* World = GetWorld();
     if (!World) return;
 
-    // 진행 중인 리젠 틱을 중단하고 딜레이를 처음부터 다시 셉니다.
+    // 회복 구간을 중단하고 딜레이를 처음부터 다시 셉니다.
+    // 소모 직전의 회복분은 KNAttributeSet::PreGameplayEffectExecute 에서 소모 GE 수치에 이미 합산되었습니다.
+    RegenAnchorTime = -1.0f;
     World->GetTimerManager().ClearTimer(StaminaRegenTimerHandle);
     World->GetTimerManager().SetTimer(
         StaminaRegenDelayHandle,
@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GAS/Effects/KNDamageEffect.h"
+#include "GAS/Attributes/KNAttributeSet.h"
+#include "GAS/Tags/KNStatsTags.h"
+
+#pragma region Damage Gameplay Effect 구현
+UKNDamageEffect::UKNDamageEffect()
+{
+    DurationPolicy = EGameplayEffectDurationType::Instant;
+    Modifiers.Empty();
+
+    Executions.Add(FGameplayEffectExecutionDefinition(
+        UKNDamageExecution::StaticClass()));
+}
+
+bool UKNDamageEffect::IsDamageEffectClass(TSubclassOf<UGameplayEffect> EffectClass)
+{
+    if (!EffectClass) return false;
+    if (EffectClass->IsChildOf(UKNDamageEffect::StaticClass())) return true;
+
+    // UKNDamageEffect를 상속하지 않은 블루프린트 GE라도 데미지 실행 계산을 직접 등록했다면 허용합니다.
+    const UGameplayEffect* EffectCDO = EffectClass->GetDefaultObject<UGameplayEffect>();
+    return EffectCDO->Executions.ContainsByPredicate([](const FGameplayEffectExecutionDefinition& Execution)
+    {
+        return Execution.CalculationClass && Execution.CalculationClass->IsChildOf(UKNDamageExecution::StaticClass());
+    });
+}
+#pragma endregion Damage Gameplay Effect 구현
+
+// ────────────────────────────────────────────────────────────
+
+#pragma region Execution Calculation 구현
+UKNDamageExecution::UKNDamageExecution()
+{
+    // 캡처 없음: 공격자 측 배율은 피격마다 계산되어 SetByCaller로 전달됩니다.
+}
+
+void UKNDamageExecution::Execute_Implementation(
+    const FGameplayEffectCustomExecutionParameters& ExecutionParams,
+    FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
+{
+    // 스펙의 SetByCaller는 보통 2개뿐이므로 해시 조회 대신 한 번 순회하며 값을 꺼냅니다.
+    float BaseDamage = 0.0f;
+    float Multiplier = 1.0f;
+
+    for (const TPair<FGameplayTag, float>& Pair : ExecutionParams.GetOwningSpec().SetByCallerTagMagnitudes)
+    {
+        if (Pair.Key == KatanaNeon::Data::Damage::Base)
+        {
+            BaseDamage = Pair.Value;
+        }
+        else if (Pair.Key == KatanaNeon::Data::Damage::Multiplier)
+        {
+            Multiplier = Pair.Value;
+        }
+    }
+
+    const float FinalDamage = BaseDamage * Multiplier;
+    if (FinalDamage <= 0.0f) return;
+
+    OutExecutionOutput.AddOutputModifier(FGameplayModifierEvaluatedData(
+        UKNAttributeSet::GetHealthAttribute(), EGameplayModOp::Additive, -FinalDamage));
+}
+
+void UKNDamageExecution::SetDamage(FGameplayEffectSpec& Spec, float BaseDamage, float Multiplier)
+{
+    Spec.SetSetByCallerMagnitude(KatanaNeon::Data::Damage::Base, BaseDamage);
+    Spec.SetSetByCallerMagnitude(KatanaNeon::Data::Damage::Multiplier, Multiplier);
+}
+#pragma endregion Execution Calculation 구현
@@ -27,20 +27,14 @@ UKNDurationModifier::UKNDurationModifier()
 UKNDurationModifierExecution::UKNDurationModifierExecution()
 {
     // Snapshot = false : 버프 적용 시점의 과거 값이 아닌, 실시간 현재 값을 기준으로 캡처합니다.
-    for (TFieldIterator<FProperty> It(UKNAttributeSet::StaticClass()); It; ++It)
+    // KN_ATTRIBUTE_LIST 인덱스 표를 순회하므로 리플렉션 프로퍼티 스캔이 필요 없습니다.
+    RelevantAttributesToCapture.Reserve(FKNGASAttributeCache::Num);
+    for (int32 Index = 0; Index < FKNGASAttributeCache::Num; ++Index)
     {
-        // 컴파일 에러 원인이었던 const 키워드 제거
-        if (FStructProperty* StructProp = CastField<FStructProperty>(*It))
-        {
-            if (StructProp->Struct->GetFName() == TEXT("GameplayAttributeData"))
-            {
-                FGameplayEffectAttributeCaptureDefinition Def(
-                    FGameplayAttribute(StructProp),
-                    EGameplayEffectAttributeCaptureSource::Target,
-                    /*bSnapshot=*/false);
-                RelevantAttributesToCapture.Add(Def);
-            }
-        }
+        RelevantAttributesToCapture.Add(FGameplayEffectAttributeCaptureDefinition(
+            FKNGASAttributeCache::GetAttribute(static_cast<EKNAttribute>(Index)),
+            EGameplayEffectAttributeCaptureSource::Target,
+            /*bSnapshot=*/false));
     }
 }
 
@@ -49,7 +43,6 @@ void UKNDurationModifierExecution::Execute_Implementation(
     FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
 {
     const FGameplayEffectSpec& Spec = ExecutionParams.GetOwningSpec();
-    const TMap<FGameplayTag, FGameplayAttribute>& AttributeMap = FKNGASAttributeCache::Get();
 
     // SetByCallerTagMagnitudes 순회하여 데이터 주도적 수치 적용
     for (const auto& [Tag, Magnitude] : Spec.SetByCallerTagMagnitudes)
@@ -60,13 +53,13 @@ void UKNDurationModifierExecution::Execute_Implementation(
             continue;
         }
 
-        // 최적화: 리플렉션 대신 O(1) 해시 맵 검색을 수행합니다.
-        const FGameplayAttribute* TargetAttrPtr = AttributeMap.Find(Tag);
+        // 최적화: 해시 맵 대신 컴파일 타임 인덱스 표로 어트리뷰트를 찾습니다.
+        const FGameplayAttribute* TargetAttrPtr = FKNGASAttributeCache::Find(Tag);
 
         if (!TargetAttrPtr || !TargetAttrPtr->IsValid())
         {
             UE_LOG(LogTemp, Warning,
-                TEXT("[KNDurationModifierExec] 캐시 맵에 매핑되지 않은 태그: %s"), *Tag.ToString());
+                TEXT("[KNDurationModifierExec] 어트리뷰트 인덱스 표에 없는 태그: %s"), *Tag.ToString());
             continue;
         }
 
@@ -24,20 +24,14 @@ UKNInfiniteModifier::UKNInfiniteModifier()
 UKNInfiniteModifierExecution::UKNInfiniteModifierExecution()
 {
     // Snapshot = false : 장착 시점의 값이 아닌, 실시간 기반 어트리뷰트 증감을 위해 false를 유지합니다.
-    for (TFieldIterator<FProperty> It(UKNAttributeSet::StaticClass()); It; ++It)
+    // KN_ATTRIBUTE_LIST 인덱스 표를 순회하므로 리플렉션 프로퍼티 스캔이 필요 없습니다.
+    RelevantAttributesToCapture.Reserve(FKNGASAttributeCache::Num);
+    for (int32 Index = 0; Index < FKNGASAttributeCache::Num; ++Index)
     {
-        // 컴파일 에러를 방지하기 위해 const 키워드를 제외한 캐스팅을 수행합니다.
-        if (FStructProperty* StructProp = CastField<FStructProperty>(*It))
-        {
-            if (StructProp->Struct->GetFName() == TEXT("GameplayAttributeData"))
-            {
-                FGameplayEffectAttributeCaptureDefinition Def(
-                    FGameplayAttribute(StructProp),
-                    EGameplayEffectAttributeCaptureSource::Target,
-                    /*bSnapshot=*/false);
-                RelevantAttributesToCapture.Add(Def);
-            }
-        }
+        RelevantAttributesToCapture.Add(FGameplayEffectAttributeCaptureDefinition(
+            FKNGASAttributeCache::GetAttribute(static_cast<EKNAttribute>(Index)),
+            EGameplayEffectAttributeCaptureSource::Target,
+            /*bSnapshot=*/false));
     }
 }
 
@@ -46,7 +40,6 @@ void UKNInfiniteModifierExecution::Execute_Implementation(
     FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
 {
     const FGameplayEffectSpec& Spec = ExecutionParams.GetOwningSpec();
-    const TMap<FGameplayTag, FGameplayAttribute>& AttributeMap = FKNGASAttributeCache::Get();
 
     // SetByCaller로 유입된 기획 데이터를 순회 적용합니다.
     for (const auto& [Tag, Magnitude] : Spec.SetByCallerTagMagnitudes)
@@ -57,12 +50,12 @@ void UKNInfiniteModifierExecution::Execute_Implementation(
         }
 
         // 최적화된 O(1) 검색
-        const FGameplayAttribute* TargetAttrPtr = AttributeMap.Find(Tag);
+        const FGameplayAttribute* TargetAttrPtr = FKNGASAttributeCache::Find(Tag);
 
         if (!TargetAttrPtr || !TargetAttrPtr->IsValid())
         {
             UE_LOG(LogTemp, Warning,
-                TEXT("[KNInfiniteModifierExec] 캐시 맵에 매핑되지 않은 태그: %s"), *Tag.ToString());
+                TEXT("[KNInfiniteModifierExec] 어트리뷰트 인덱스 표에 없는 태그: %s"), *Tag.ToString());
             continue;
         }
 
@@ -5,6 +5,12 @@
 #include "GAS/Attributes/KNAttributeSet.h"
 #include "GAS/Tags/KNStatsTags.h"
 #include "GAS/System/KNGASAttributeCache.h"
+#include "HAL/IConsoleManager.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "UObject/Package.h"
 
 #pragma region Instant Gameplay Effect 구현
 UKNInstantModifier::UKNInstantModifier()
@@ -25,35 +31,129 @@ UKNInstantModifier::UKNInstantModifier()
 // ────────────────────────────────────────────────────────────
 
 #pragma region Execution Calculation 최적화 구현
-UKNInstantModifierExecution::UKNInstantModifierExecution()
+namespace
 {
-    // Snapshot = false : 피격 시점의 실시간 현재 값을 참조하여 데미지/회복을 적용합니다.
-    for (TFieldIterator<FProperty> It(UKNAttributeSet::StaticClass()); It; ++It)
+    /**
+     * @brief 모디파이어 출력 순서 표 — Max 계열 어트리뷰트를 먼저, 이후 나머지를 인덱스 순으로 배치합니다.
+     * @details Max가 먼저 반영되어야 같은 스펙의 현재값 증가가 새 상한 기준으로 클램프됩니다.
+     */
+    struct FKNInstantEmitOrder
     {
-        // 컴파일 에러를 방지하기 위해 const 키워드를 제외한 캐스팅을 수행합니다.
-        if (FStructProperty* StructProp = CastField<FStructProperty>(*It))
+        EKNAttribute Order[FKNGASAttributeCache::Num] = {};
+
+        constexpr FKNInstantEmitOrder()
         {
-            if (StructProp->Struct->GetFName() == TEXT("GameplayAttributeData"))
+            int32 Cursor = 0;
+            for (int32 Pass = 0; Pass < 2; ++Pass)
             {
-                FGameplayEffectAttributeCaptureDefinition Def(
-                    FGameplayAttribute(StructProp),
-                    EGameplayEffectAttributeCaptureSource::Target,
-                    /*bSnapshot=*/false);
-                RelevantAttributesToCapture.Add(Def);
+                for (int32 Index = 0; Index < FKNGASAttributeCache::Num; ++Index)
+                {
+                    const EKNAttribute Attribute = static_cast<EKNAttribute>(Index);
+                    if (FKNGASAttributeCache::IsMaxAttribute(Attribute) == (Pass == 0))
+                    {
+                        Order[Cursor++] = Attribute;
+                    }
+                }
             }
         }
-    }
+    };
+
+    constexpr FKNInstantEmitOrder GKNInstantEmitOrder;
+}
+
+UKNInstantModifierExecution::UKNInstantModifierExecution()
+{
+    // 캡처 없음: 이 실행은 대상의 현재값을 읽지 않고 SetByCaller 수치만 Additive로 출력합니다.
+    // 캡처 정의가 비어 있으면 GE 적용 시 어트리뷰트 집계기(Aggregator) 조회·평가 비용이 사라집니다.
 }
 
 void UKNInstantModifierExecution::Execute_Implementation(
     const FGameplayEffectCustomExecutionParameters& ExecutionParams,
     FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
 {
+    BuildModifiers(ExecutionParams.GetOwningSpec().SetByCallerTagMagnitudes, OutExecutionOutput);
+}
+
+void UKNInstantModifierExecution::BuildModifiers(
+    const TMap<FGameplayTag, float>& SetByCallerTagMagnitudes,
+    FGameplayEffectCustomExecutionOutput& OutExecutionOutput)
+{
+    // ── 1단계: 스펙의 수치를 어트리뷰트 인덱스별 고정 배열로 모읍니다. ──
+    // 태그 → 인덱스는 네이티브 태그 표 선형 비교(FName 정수 비교)이므로 해시 조회/힙 할당이 없습니다.
+    float Magnitudes[FKNGASAttributeCache::Num] = {};
+    uint32 PresentMask = 0;
+    static_assert(FKNGASAttributeCache::Num <= 32, "PresentMask 비트 수를 늘려야 합니다.");
 
+    for (const TPair<FGameplayTag, float>& Pair : SetByCallerTagMagnitudes)
+    {
+        if (FMath::IsNearlyZero(Pair.Value)) continue;
+
+        const EKNAttribute Attribute = FKNGASAttributeCache::ToIndex(Pair.Key);
+        if (Attribute == EKNAttribute::Count) continue;
+
+        const int32 Index = static_cast<int32>(Attribute);
+        Magnitudes[Index] += Pair.Value;
+        PresentMask |= 1u << Index;
+    }
+
+    if (PresentMask == 0) return;
+
+    // ── 2단계: 컴파일 타임 순서 표대로 Max 계열 → 나머지 순으로 출력합니다. ──
+    for (const EKNAttribute Attribute : GKNInstantEmitOrder.Order)
+    {
+        const int32 Index = static_cast<int32>(Attribute);
+        if ((PresentMask & (1u << Index)) == 0) continue;
+
+        OutExecutionOutput.AddOutputModifier(FGameplayModifierEvaluatedData(
+            FKNGASAttributeCache::GetAttribute(Attribute), EGameplayModOp::Additive, Magnitudes[Index]));
+    }
+}
+#pragma endregion Execution Calculation 최적화 구현
+
+#pragma region 비교 기준 실행 계산 구현
+namespace
+{
+    /** @brief 최적화 이전 FKNGASAttributeCache::Get과 같이 리플렉션 순회 + 문자열 태그 요청으로 만든 매핑 */
+    const TMap<FGameplayTag, FGameplayAttribute>& GetReflectedAttributeMap()
+    {
+        static const TMap<FGameplayTag, FGameplayAttribute> Map = []()
+        {
+            TMap<FGameplayTag, FGameplayAttribute> Result;
+            for (TFieldIterator<FStructProperty> It(UKNAttributeSet::StaticClass()); It; ++It)
+            {
+                if (It->Struct->GetFName() != TEXT("GameplayAttributeData")) continue;
+
+                const FString TagName = FString::Printf(TEXT("KatanaNeon.Data.Stats.%s"), *It->GetName());
+                const FGameplayTag MappedTag = FGameplayTag::RequestGameplayTag(FName(*TagName), false);
+                if (MappedTag.IsValid())
+                {
+                    Result.Add(MappedTag, FGameplayAttribute(*It));
+                }
+            }
+            return Result;
+        }();
+        return Map;
+    }
+}
+
+UKNInstantModifierReferenceExecution::UKNInstantModifierReferenceExecution()
+{
+    for (TFieldIterator<FStructProperty> It(UKNAttributeSet::StaticClass()); It; ++It)
+    {
+        if (It->Struct->GetFName() != TEXT("GameplayAttributeData")) continue;
+
+        RelevantAttributesToCapture.Add(FGameplayEffectAttributeCaptureDefinition(
+            FGameplayAttribute(*It), EGameplayEffectAttributeCaptureSource::Target, /*bSnapshot=*/false));
+    }
+}
+
+void UKNInstantModifierReferenceExecution::Execute_Implementation(
+    const FGameplayEffectCustomExecutionParameters& ExecutionParams,
+    FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
+{
     const FGameplayEffectSpec& Spec = ExecutionParams.GetOwningSpec();
-    const TMap<FGameplayTag, FGameplayAttribute>& AttributeMap = FKNGASAttributeCache::Get();
+    const TMap<FGameplayTag, FGameplayAttribute>& AttributeMap = GetReflectedAttributeMap();
 
-    // ── 최적화: TArray 대신 TSet으로 O(1) Contains 보장 ──
     static const TSet<FGameplayTag> MaxFirstTags = {
         KatanaNeon::Data::Stats::MaxHealth,
         KatanaNeon::Data::Stats::MaxStamina,
@@ -61,7 +161,6 @@ void UKNInstantModifierExecution::Execute_Implementation(
         KatanaNeon::Data::Stats::MaxOverclockPoint
     };
 
-    // ── 1단계: Max 어트리뷰트 먼저 처리 ──
     for (const FGameplayTag& Tag : MaxFirstTags)
     {
         const float* MagnitudePtr = Spec.SetByCallerTagMagnitudes.Find(Tag);
@@ -74,17 +173,100 @@ void UKNInstantModifierExecution::Execute_Implementation(
             FGameplayModifierEvaluatedData(*AttrPtr, EGameplayModOp::Additive, *MagnitudePtr));
     }
 
-    // ── 2단계: 나머지 어트리뷰트 처리 ──
-    for (const auto& [Tag, Magnitude] : Spec.SetByCallerTagMagnitudes)
+    for (const TPair<FGameplayTag, float>& Pair : Spec.SetByCallerTagMagnitudes)
     {
-        if (MaxFirstTags.Contains(Tag)) continue; // O(1)
-        if (!Tag.IsValid() || FMath::IsNearlyZero(Magnitude)) continue;
+        if (MaxFirstTags.Contains(Pair.Key)) continue;
+        if (!Pair.Key.IsValid() || FMath::IsNearlyZero(Pair.Value)) continue;
 
-        const FGameplayAttribute* AttrPtr = AttributeMap.Find(Tag);
+        const FGameplayAttribute* AttrPtr = AttributeMap.Find(Pair.Key);
         if (!AttrPtr || !AttrPtr->IsValid()) continue;
 
         OutExecutionOutput.AddOutputModifier(
-            FGameplayModifierEvaluatedData(*AttrPtr, EGameplayModOp::Additive, Magnitude));
+            FGameplayModifierEvaluatedData(*AttrPtr, EGameplayModOp::Additive, Pair.Value));
     }
 }
-#pragma endregion Execution Calculation 최적화 구현
\ No newline at end of file
+#pragma endregion 비교 기준 실행 계산 구현
+
+#pragma region 실행 비용 벤치마크
+#if !UE_BUILD_SHIPPING
+/**
+ * @brief KN.GAS.BenchmarkInstantExec [반복 횟수]
+ * 플레이어 ASC에 스태미나 틱 / 스탯 초기화 형태의 Instant 스펙을 실제로 N회씩 적용하여,
+ * 최적화 이전 실행 계산(전체 캡처 + 리플렉션 맵)과 현재 실행 계산의 적용 1회당 평균 비용(ns)을 로그로 출력합니다.
+ * 반복 횟수를 생략하면 100000회 적용합니다.
+ * 두 경로 모두 스펙 생성·캡처·실행·어트리뷰트 반영까지 포함하며, 측정 후 어트리뷰트 기본값을 되돌립니다.
+ */
+static FAutoConsoleCommandWithWorldAndArgs GKNInstantExecBenchmarkCommand(
+    TEXT("KN.GAS.BenchmarkInstantExec"),
+    TEXT("Instant GE 적용 비용 비교: 이전 실행 계산 vs 현재 실행 계산. 사용법: KN.GAS.BenchmarkInstantExec [Iterations=100000]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        const APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+        UAbilitySystemComponent* ASC = PC
+            ? UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(PC->GetPawn())
+            : nullptr;
+        if (!ASC || !ASC->GetSet<UKNAttributeSet>())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[KNInstantModifierExec] 벤치마크 실패: 플레이어 ASC 또는 어트리뷰트 셋이 없습니다."));
+            return;
+        }
+
+        const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000;
+
+        // 실행 계산만 다른 일회용 Instant GE 두 개를 만듭니다.
+        auto MakeInstantGE = [](TSubclassOf<UGameplayEffectExecutionCalculation> ExecutionClass)
+        {
+            UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), NAME_None, RF_Transient);
+            Effect->DurationPolicy = EGameplayEffectDurationType::Instant;
+            Effect->Executions.Add(FGameplayEffectExecutionDefinition(ExecutionClass));
+            return Effect;
+        };
+        UGameplayEffect* ReferenceGE = MakeInstantGE(UKNInstantModifierReferenceExecution::StaticClass());
+        UGameplayEffect* FastGE = MakeInstantGE(UKNInstantModifierExecution::StaticClass());
+
+        // 측정이 게임 상태를 바꾸지 않도록 기본값을 저장해 두었다가 되돌립니다.
+        float SavedBase[FKNGASAttributeCache::Num];
+        for (int32 Index = 0; Index < FKNGASAttributeCache::Num; ++Index)
+        {
+            SavedBase[Index] = ASC->GetNumericAttributeBase(FKNGASAttributeCache::GetAttribute(static_cast<EKNAttribute>(Index)));
+        }
+
+        // 스태미나 틱(1개)과 스탯 초기화(Max + 현재값 쌍) 두 형태를 번갈아 적용합니다.
+        auto RunPath = [ASC, Iterations](const UGameplayEffect* Effect)
+        {
+            const FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
+            const double Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Iterations; ++i)
+            {
+                FGameplayEffectSpec Spec(Effect, Context, 1.0f);
+                if (i & 1)
+                {
+                    Spec.SetSetByCallerMagnitude(KatanaNeon::Data::Stats::MaxHealth, 0.5f);
+                    Spec.SetSetByCallerMagnitude(KatanaNeon::Data::Stats::Health, 0.5f);
+                    Spec.SetSetByCallerMagnitude(KatanaNeon::Data::Stats::MaxStamina, 0.5f);
+                    Spec.SetSetByCallerMagnitude(KatanaNeon::Data::Stats::Stamina, 0.5f);
+                }
+                else
+                {
+                    Spec.SetSetByCallerMagnitude(KatanaNeon::Data::Stats::Stamina, -0.5f);
+                }
+                ASC->ApplyGameplayEffectSpecToSelf(Spec);
+            }
+            return FPlatformTime::Seconds() - Start;
+        };
+
+        const double ReferenceSec = RunPath(ReferenceGE);
+        const double FastSec = RunPath(FastGE);
+
+        for (int32 Index = 0; Index < FKNGASAttributeCache::Num; ++Index)
+        {
+            ASC->SetNumericAttributeBase(FKNGASAttributeCache::GetAttribute(static_cast<EKNAttribute>(Index)), SavedBase[Index]);
+        }
+
+        const double ToNsPerApply = 1.0e9 / Iterations;
+        UE_LOG(LogTemp, Log,
+            TEXT("[KNInstantModifierExec] %d회 적용 — 이전 실행 계산: %.1f ns/apply / 현재 실행 계산: %.1f ns/apply (스펙 생성~어트리뷰트 반영)"),
+            Iterations, ReferenceSec * ToNsPerApply, FastSec * ToNsPerApply);
+    }));
+#endif
+#pragma endregion 실행 비용 벤치마크
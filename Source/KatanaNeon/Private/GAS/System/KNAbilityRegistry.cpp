@@ -0,0 +1,108 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GAS/System/KNAbilityRegistry.h"
+#include "AbilitySystemComponent.h"
+
+#pragma region 어빌리티 레지스트리 구현
+FKNAbilityRegistry::~FKNAbilityRegistry()
+{
+    Unbind();
+}
+
+void FKNAbilityRegistry::Bind(UAbilitySystemComponent* InASC)
+{
+    Unbind();
+    if (!InASC) return;
+
+    BoundASC = InASC;
+    ActivatedDelegateHandle = InASC->AbilityActivatedCallbacks.AddRaw(this, &FKNAbilityRegistry::HandleAbilityActivated);
+    EndedDelegateHandle = InASC->OnAbilityEnded.AddRaw(this, &FKNAbilityRegistry::HandleAbilityEnded);
+}
+
+void FKNAbilityRegistry::Unbind()
+{
+    if (UAbilitySystemComponent* ASC = BoundASC.Get())
+    {
+        ASC->AbilityActivatedCallbacks.Remove(ActivatedDelegateHandle);
+        ASC->OnAbilityEnded.Remove(EndedDelegateHandle);
+    }
+
+    ActivatedDelegateHandle.Reset();
+    EndedDelegateHandle.Reset();
+    BoundASC = nullptr;
+    Entries.Reset();
+}
+
+void FKNAbilityRegistry::RegisterSpec(const FGameplayAbilitySpecHandle& Handle)
+{
+    UAbilitySystemComponent* ASC = BoundASC.Get();
+    if (!ASC || !Handle.IsValid()) return;
+
+    const FGameplayAbilitySpec* Spec = ASC->FindAbilitySpecFromHandle(Handle);
+    if (!Spec || !Spec->Ability) return;
+
+    // InstancedPerActor는 부여 시점에 주 인스턴스가 생성되며, 그 외 정책은 CDO로 대체합니다.
+    UGameplayAbility* Instance = Spec->GetPrimaryInstance();
+    if (!Instance)
+    {
+        Instance = Spec->Ability;
+    }
+
+    for (const FGameplayTag& Tag : Spec->Ability->GetAssetTags())
+    {
+        if (Entries.Contains(Tag))
+        {
+            UE_LOG(LogTemp, Warning,
+                TEXT("[KNAbilityRegistry] 태그 %s 에 이미 어빌리티가 등록되어 있어 %s 로 덮어씁니다."),
+                *Tag.ToString(), *Spec->Ability->GetName());
+        }
+
+        FKNAbilityRegistryEntry& Entry = Entries.FindOrAdd(Tag);
+        Entry.Handle = Handle;
+        Entry.PrimaryInstance = Instance;
+        Entry.bActive = Spec->IsActive();
+    }
+}
+
+void FKNAbilityRegistry::HandleAbilityActivated(UGameplayAbility* Ability)
+{
+    if (!Ability) return;
+
+    SetActiveByHandle(Ability->GetCurrentAbilitySpecHandle(), Ability, true);
+}
+
+void FKNAbilityRegistry::HandleAbilityEnded(const FAbilityEndedData& EndedData)
+{
+    // 동일 스펙이 중첩 활성화된 경우를 위해 ASC의 실제 ActiveCount를 기준으로 판정합니다.
+    bool bStillActive = false;
+    if (const UAbilitySystemComponent* ASC = BoundASC.Get())
+    {
+        if (const FGameplayAbilitySpec* Spec = ASC->FindAbilitySpecFromHandle(EndedData.AbilitySpecHandle))
+        {
+            bStillActive = Spec->IsActive();
+        }
+    }
+
+    SetActiveByHandle(EndedData.AbilitySpecHandle, EndedData.AbilityThatEnded, bStillActive);
+}
+
+void FKNAbilityRegistry::SetActiveByHandle(
+    const FGameplayAbilitySpecHandle& Handle, const UGameplayAbility* Ability, bool bActive)
+{
+    if (!Ability) return;
+
+    // 어빌리티당 에셋 태그는 보통 1개이므로 해시 조회 1~2회로 끝납니다.
+    for (const FGameplayTag& Tag : Ability->GetAssetTags())
+    {
+        FKNAbilityRegistryEntry* Entry = Entries.Find(Tag);
+        if (!Entry || Entry->Handle != Handle) continue;
+
+        Entry->bActive = bActive;
+        if (bActive && Ability->IsInstantiated())
+        {
+            Entry->PrimaryInstance = const_cast<UGameplayAbility*>(Ability);
+        }
+    }
+}
+#pragma endregion 어빌리티 레지스트리 구현
@@ -0,0 +1,99 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GAS/System/KNComboGraph.h"
+#include "Engine/DataTable.h"
+
+#pragma region 콤보 그래프 구현
+bool FKNComboGraph::Compile(const UDataTable* DrawnTable, const UDataTable* SheathTable, const FString& OwnerName)
+{
+    for (FKNComboNode& Node : Nodes)
+    {
+        Node = FKNComboNode();
+    }
+
+    const bool bDrawnOk = CompileStance(DrawnTable, true, OwnerName);
+    const bool bSheathOk = CompileStance(SheathTable, false, OwnerName);
+
+    LinkTransitions();
+    bCompiled = true;
+
+    return bDrawnOk && bSheathOk;
+}
+
+bool FKNComboGraph::CompileStance(const UDataTable* Table, bool bDrawn, const FString& OwnerName)
+{
+    const TCHAR* StanceName = bDrawn ? TEXT("발도") : TEXT("납도");
+
+    if (!Table)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[KNComboGraph] %s: %s 스탠스 DataTable이 할당되지 않았습니다."),
+            *OwnerName, StanceName);
+        return false;
+    }
+
+    // 행 키 문자열은 컴파일 시점에만 생성합니다. (런타임 FName 해시 없음)
+    bool bComplete = true;
+    for (int32 TypeIdx = 0; TypeIdx < 2; ++TypeIdx)
+    {
+        const bool bHeavy = TypeIdx == 1;
+        for (int32 Step = 1; Step <= MaxStep; ++Step)
+        {
+            const FName RowName(*FString::Printf(TEXT("%s_%d"), bHeavy ? TEXT("HeavyAttack") : TEXT("LightAttack"), Step));
+            const FKNComboAttackRow* Row = Table->FindRow<FKNComboAttackRow>(RowName, TEXT("KNComboGraph"), false);
+            if (!Row)
+            {
+                UE_LOG(LogTemp, Error, TEXT("[KNComboGraph] %s: %s 테이블 %s 에 행 %s 이 없습니다."),
+                    *OwnerName, StanceName, *Table->GetName(), *RowName.ToString());
+                bComplete = false;
+                continue;
+            }
+
+            if (Row->ComboStep != Step || Row->AttackType != TypeIdx)
+            {
+                UE_LOG(LogTemp, Warning,
+                    TEXT("[KNComboGraph] %s: %s 행 %s 의 ComboStep/AttackType(%d/%d)이 행 키와 다릅니다. 행 키 기준으로 배치합니다."),
+                    *OwnerName, StanceName, *RowName.ToString(), Row->ComboStep, Row->AttackType);
+            }
+
+            if (!Row->ComboMontage)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[KNComboGraph] %s: %s 행 %s 에 ComboMontage가 할당되지 않았습니다."),
+                    *OwnerName, StanceName, *RowName.ToString());
+            }
+
+            if (Row->HitboxEndNormTime < Row->HitboxStartNormTime)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[KNComboGraph] %s: %s 행 %s 의 히트박스 구간이 역전되어 있습니다. (%.2f > %.2f)"),
+                    *OwnerName, StanceName, *RowName.ToString(), Row->HitboxStartNormTime, Row->HitboxEndNormTime);
+            }
+
+            FKNComboNode& Node = Nodes[MakeNodeIndex(bDrawn, bHeavy, Step)];
+            Node.Row = *Row;
+            Node.bValid = true;
+        }
+    }
+
+    return bComplete;
+}
+
+void FKNComboGraph::LinkTransitions()
+{
+    for (int32 StanceIdx = 0; StanceIdx < 2; ++StanceIdx)
+    {
+        const bool bDrawn = StanceIdx == 1;
+
+        // 강공격과 마지막 약공격은 피니셔이므로 약공 1~4만 전이를 가집니다.
+        for (int32 Step = 1; Step < MaxStep; ++Step)
+        {
+            const int32 Index = MakeNodeIndex(bDrawn, false, Step);
+            if (!Nodes[Index].bValid) continue;
+
+            const int32 LightNext = MakeNodeIndex(bDrawn, false, Step + 1);
+            const int32 HeavyNext = MakeNodeIndex(bDrawn, true, Step + 1);
+            Nodes[Index].NextLight = Nodes[LightNext].bValid ? LightNext : INDEX_NONE;
+            Nodes[Index].NextHeavy = Nodes[HeavyNext].bValid ? HeavyNext : INDEX_NONE;
+        }
+    }
+}
+#pragma endregion 콤보 그래프 구현
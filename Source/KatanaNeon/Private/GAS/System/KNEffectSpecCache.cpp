@@ -0,0 +1,172 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GAS/System/KNEffectSpecCache.h"
+#include "AbilitySystemComponent.h"
+
+#pragma region 컨텍스트 참조 수 조회
+namespace
+{
+    /** @brief FGameplayEffectContextHandle::Data 멤버 포인터 타입 */
+    using FKNContextDataMember = TSharedPtr<FGameplayEffectContext> FGameplayEffectContextHandle::*;
+
+    /** @brief 아래 명시적 인스턴스화가 정의하는 멤버 포인터 접근자 */
+    FKNContextDataMember GetContextDataMember();
+
+    /**
+     * @brief 핸들의 공유 포인터(private)에 접근하기 위한 접근자 템플릿입니다.
+     * @details 명시적 인스턴스화의 템플릿 인자는 접근 검사에서 제외되므로, 엔진 헤더를 수정하지 않고
+     * 컨텍스트 핸들의 공유 참조 수를 읽을 수 있습니다.
+     */
+    template <FKNContextDataMember Member>
+    struct TKNContextDataAccess
+    {
+        friend FKNContextDataMember GetContextDataMember() { return Member; }
+    };
+    template struct TKNContextDataAccess<&FGameplayEffectContextHandle::Data>;
+
+    /** @brief 컨텍스트 데이터를 공유하는 핸들 수를 반환합니다. */
+    int32 GetContextReferenceCount(const FGameplayEffectContextHandle& Handle)
+    {
+        return (Handle.*GetContextDataMember()).GetSharedReferenceCount();
+    }
+}
+#pragma endregion 컨텍스트 참조 수 조회
+
+#pragma region 스펙 캐시 구현
+FGameplayEffectSpecHandle FKNEffectSpecCache::Acquire(
+    UAbilitySystemComponent& Owner,
+    TSubclassOf<UGameplayEffect> EffectClass,
+    float Level,
+    AActor* Instigator,
+    AActor* EffectCauser)
+{
+    if (!EffectClass) return FGameplayEffectSpecHandle();
+
+    // Duration/Infinite는 활성 이펙트가 스펙·컨텍스트를 보관하므로 재사용하지 않습니다.
+    const UGameplayEffect* EffectCDO = EffectClass->GetDefaultObject<UGameplayEffect>();
+    if (EffectCDO->DurationPolicy != EGameplayEffectDurationType::Instant)
+    {
+        ++Stats.Bypassed;
+        FGameplayEffectContextHandle Context = Owner.MakeEffectContext();
+        if (Instigator || EffectCauser)
+        {
+            Context.AddInstigator(Instigator ? Instigator : Owner.GetOwnerActor(), EffectCauser ? EffectCauser : Owner.GetAvatarActor());
+        }
+        return Owner.MakeOutgoingSpec(EffectClass, Level, Context);
+    }
+
+    FGameplayEffectContextHandle Context = AcquireContext(Owner, Instigator, EffectCauser);
+
+    for (FEntry& Entry : Entries)
+    {
+        if (Entry.EffectClass.Get() != EffectClass.Get() || Entry.Level != Level) continue;
+
+        FGameplayEffectSpec* Spec = Entry.Spec.Data.Get();
+        const FGameplayEffectSpec* Template = Entry.Template.Data.Get();
+        if (!Spec || !Template) continue;
+
+        // 캐시 외의 참조가 남아 있으면 바깥 호출이 아직 채우거나 적용 중인 스펙입니다. (중첩 획득)
+        if (Entry.Spec.Data.GetSharedReferenceCount() > 1)
+        {
+            ++Stats.InUseSkipped;
+            continue;
+        }
+
+        // 생성 직후 상태로 되돌려 SetByCaller·동적 태그·캡처 값이 이전 호출에서 넘어오지 않게 합니다.
+        *Spec = *Template;
+
+        // 컨텍스트 교체 시 소스 어트리뷰트/태그 스냅샷도 다시 캡처됩니다.
+        Spec->SetContext(Context);
+
+        ++Stats.SpecsReused;
+        return Entry.Spec;
+    }
+
+    FGameplayEffectSpecHandle NewSpec = Owner.MakeOutgoingSpec(EffectClass, Level, Context);
+    if (NewSpec.IsValid())
+    {
+        ++Stats.SpecsCreated;
+
+        // 무효화된(GC) 클래스 항목이 있으면 그 자리를 재사용합니다.
+        FEntry* Slot = Entries.FindByPredicate([](const FEntry& Entry) { return !Entry.EffectClass.IsValid(); });
+        if (!Slot)
+        {
+            Slot = &Entries.AddDefaulted_GetRef();
+        }
+        Slot->EffectClass = EffectClass.Get();
+        Slot->Level = Level;
+        Slot->Spec = NewSpec;
+        Slot->Template = FGameplayEffectSpecHandle(new FGameplayEffectSpec(*NewSpec.Data));
+    }
+    return NewSpec;
+}
+
+void FKNEffectSpecCache::Reset()
+{
+    Entries.Reset();
+    ContextPool.Reset();
+    NextContext = 0;
+}
+
+FGameplayEffectContextHandle FKNEffectSpecCache::AcquireContext(UAbilitySystemComponent& Owner, AActor* Instigator, AActor* EffectCauser)
+{
+    FGameplayEffectContextHandle Context;
+
+    if (ContextPool.Num() < ContextPoolSize)
+    {
+        Context = Owner.MakeEffectContext();
+        ContextPool.Add(Context);
+        ++Stats.ContextsCreated;
+    }
+    else
+    {
+        const int32 Index = NextContext;
+        NextContext = (NextContext + 1) % ContextPoolSize;
+
+        // 기본 컨텍스트 타입이고 풀만 쥐고 있는 컨텍스트만 제자리 초기화합니다.
+        // GameplayCue 파라미터·대기 중인 큐 배치·사용 중인 스펙 등 바깥에 참조가 남아 있으면 새로 할당합니다.
+        FGameplayEffectContext* Data = ContextPool[Index].Get();
+        if (Data && Data->GetScriptStruct() == FGameplayEffectContext::StaticStruct() && IsContextSolelyPooled(ContextPool[Index]))
+        {
+            *Data = FGameplayEffectContext();
+            Context = ContextPool[Index];
+            ++Stats.ContextsReused;
+        }
+        else
+        {
+            Context = Owner.MakeEffectContext();
+            ContextPool[Index] = Context;
+            ++Stats.ContextsCreated;
+        }
+    }
+
+    // MakeEffectContext와 동일한 기본값(Owner/Avatar)을 사용하되, 호출자가 지정하면 덮어씁니다.
+    Context.AddInstigator(
+        Instigator ? Instigator : Owner.GetOwnerActor(),
+        EffectCauser ? EffectCauser : Owner.GetAvatarActor());
+    return Context;
+}
+
+bool FKNEffectSpecCache::IsContextSolelyPooled(const FGameplayEffectContextHandle& Context) const
+{
+    const FGameplayEffectContext* Data = Context.Get();
+
+    // 풀 자신의 참조 1개 + 이 캐시가 바깥에 내주지 않고 보관 중인 템플릿/유휴 스펙의 참조
+    int32 OwnedReferences = 1;
+    for (const FEntry& Entry : Entries)
+    {
+        if (const FGameplayEffectSpec* Template = Entry.Template.Data.Get())
+        {
+            OwnedReferences += Template->GetContext().Get() == Data ? 1 : 0;
+        }
+
+        const FGameplayEffectSpec* Spec = Entry.Spec.Data.Get();
+        if (Spec && Entry.Spec.Data.GetSharedReferenceCount() == 1 && Spec->GetContext().Get() == Data)
+        {
+            ++OwnedReferences;
+        }
+    }
+    return GetContextReferenceCount(Context) == OwnedReferences;
+}
+#pragma endregion 스펙 캐시 구현
@@ -2,37 +2,121 @@
 
 
 #include "GAS/System/KNGASAttributeCache.h"
-#include "GAS/Attributes/KNAttributeSet.h"
+#include "GAS/Tags/KNStatsTags.h"
+#include "Containers/StaticArray.h"
+
+#if WITH_EDITOR
+#include "Algo/AnyOf.h"
+#include "Misc/DelayedAutoRegister.h"
+#include "UObject/UnrealType.h"
+#endif
 
 #pragma region 어트리뷰트 캐시 매니저 구현
-const TMap<FGameplayTag, FGameplayAttribute>& FKNGASAttributeCache::Get()
+namespace
 {
-    // 정적(Static) 변수로 선언되어 프로그램 라이프사이클 동안 단 한 번만 초기화됩니다.
-    static TMap<FGameplayTag, FGameplayAttribute> CachedMap;
-    static bool bIsInitialized = false;
+    /** @brief 인덱스 순서의 네이티브 태그 주소 표 (상수 초기화, 런타임 비용 없음) */
+    const FNativeGameplayTag* const GKNAttributeTags[] =
+    {
+#define KN_ATTRIBUTE_TAG_ENTRY(Name) &KatanaNeon::Data::Stats::Name,
+        KN_ATTRIBUTE_LIST(KN_ATTRIBUTE_TAG_ENTRY)
+#undef KN_ATTRIBUTE_TAG_ENTRY
+    };
+
+    /** @brief 인덱스 순서의 ATTRIBUTE_ACCESSORS 프로퍼티 Getter 표 */
+    FGameplayAttribute (*const GKNAttributeGetters[])() =
+    {
+#define KN_ATTRIBUTE_GETTER_ENTRY(Name) &UKNAttributeSet::Get##Name##Attribute,
+        KN_ATTRIBUTE_LIST(KN_ATTRIBUTE_GETTER_ENTRY)
+#undef KN_ATTRIBUTE_GETTER_ENTRY
+    };
+
+    static_assert(UE_ARRAY_COUNT(GKNAttributeTags) == FKNGASAttributeCache::Num, "KN_ATTRIBUTE_LIST 태그 표 크기 불일치");
+    static_assert(UE_ARRAY_COUNT(GKNAttributeGetters) == FKNGASAttributeCache::Num, "KN_ATTRIBUTE_LIST Getter 표 크기 불일치");
+
+#if WITH_EDITOR
+    /** @brief 인덱스 순서의 어트리뷰트 이름 표 (무결성 검사용) */
+    const TCHAR* const GKNAttributeNames[] =
+    {
+#define KN_ATTRIBUTE_NAME_ENTRY(Name) TEXT(#Name),
+        KN_ATTRIBUTE_LIST(KN_ATTRIBUTE_NAME_ENTRY)
+#undef KN_ATTRIBUTE_NAME_ENTRY
+    };
+
+    static_assert(UE_ARRAY_COUNT(GKNAttributeNames) == FKNGASAttributeCache::Num, "KN_ATTRIBUTE_LIST 이름 표 크기 불일치");
 
-    if (!bIsInitialized)
+    /**
+     * @brief KN_ATTRIBUTE_LIST가 UKNAttributeSet의 실제 어트리뷰트와 1:1로 일치하는지 검사합니다. (에디터 전용)
+     * @details 항목마다 Getter가 같은 이름의 UKNAttributeSet 프로퍼티를 가리키고 태그가 유효한지,
+     * 그리고 UKNAttributeSet의 FGameplayAttributeData 프로퍼티가 모두 목록에 있는지 확인합니다.
+     * 엔진 초기화 직후 1회만 실행되며, 조회 경로에는 포함되지 않습니다.
+     */
+    void VerifyAttributeTable()
     {
-        for (TFieldIterator<FProperty> It(UKNAttributeSet::StaticClass()); It; ++It)
+        for (int32 Index = 0; Index < FKNGASAttributeCache::Num; ++Index)
         {
-            if (FStructProperty* StructProp = CastField<FStructProperty>(*It))
-            {
-                if (StructProp->Struct->GetFName() == TEXT("GameplayAttributeData"))
-                {
-                    // "KatanaNeon.Data.Stats.XXX" 형태의 태그 문자열 조합
-                    FString TagName = FString::Printf(TEXT("KatanaNeon.Data.Stats.%s"), *StructProp->GetName());
-                    FGameplayTag MappedTag = FGameplayTag::RequestGameplayTag(FName(*TagName), false);
-
-                    if (MappedTag.IsValid())
-                    {
-                        CachedMap.Add(MappedTag, FGameplayAttribute(StructProp));
-                    }
-                }
-            }
+            const FGameplayAttribute Attribute = GKNAttributeGetters[Index]();
+            checkf(Attribute.IsValid() && Attribute.GetAttributeSetClass() == UKNAttributeSet::StaticClass(),
+                TEXT("[KNGASAttributeCache] %s 항목이 UKNAttributeSet 어트리뷰트로 해석되지 않습니다."), GKNAttributeNames[Index]);
+            checkf(Attribute.GetName() == GKNAttributeNames[Index],
+                TEXT("[KNGASAttributeCache] %s 항목의 Getter가 %s를 가리킵니다."), GKNAttributeNames[Index], *Attribute.GetName());
+            checkf(GKNAttributeTags[Index]->GetTag().IsValid(),
+                TEXT("[KNGASAttributeCache] %s 항목의 스탯 태그가 등록되지 않았습니다."), GKNAttributeNames[Index]);
         }
-        bIsInitialized = true;
+
+        int32 NumAttributeProperties = 0;
+        for (TFieldIterator<FStructProperty> It(UKNAttributeSet::StaticClass()); It; ++It)
+        {
+            if (!It->Struct->IsChildOf(FGameplayAttributeData::StaticStruct())) continue;
+
+            ++NumAttributeProperties;
+            const FString PropertyName = It->GetName();
+            const bool bListed = Algo::AnyOf(GKNAttributeNames, [&PropertyName](const TCHAR* Name) { return PropertyName == Name; });
+            checkf(bListed,
+                TEXT("[KNGASAttributeCache] UKNAttributeSet::%s가 KN_ATTRIBUTE_LIST에 없습니다."), *It->GetName());
+        }
+        checkf(NumAttributeProperties == FKNGASAttributeCache::Num,
+            TEXT("[KNGASAttributeCache] UKNAttributeSet 어트리뷰트 %d개 / KN_ATTRIBUTE_LIST %d개"),
+            NumAttributeProperties, FKNGASAttributeCache::Num);
     }
 
-    return CachedMap;
+    /** @brief 엔진 초기화 완료 시점(네이티브 태그 등록 이후)에 무결성 검사를 1회 예약합니다. */
+    FDelayedAutoRegisterHelper GKNVerifyAttributeTableHelper(EDelayedRegisterRunPhase::EndOfEngineInit, &VerifyAttributeTable);
+#endif
+}
+
+EKNAttribute FKNGASAttributeCache::ToIndex(const FGameplayTag& Tag)
+{
+    // 어트리뷰트 수가 적으므로 네이티브 태그 표를 선형 비교합니다. (FName 비교 = 정수 비교, 해시/할당 없음)
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        if (GKNAttributeTags[Index]->GetTag() == Tag)
+        {
+            return static_cast<EKNAttribute>(Index);
+        }
+    }
+    return EKNAttribute::Count;
+}
+
+const FGameplayAttribute& FKNGASAttributeCache::GetAttribute(EKNAttribute Index)
+{
+    // 매직 스태틱: 최초 호출 스레드만 초기화하며 나머지는 완료를 대기합니다.
+    static const TStaticArray<FGameplayAttribute, Num> Attributes = []()
+    {
+        TStaticArray<FGameplayAttribute, Num> Result;
+        for (int32 i = 0; i < Num; ++i)
+        {
+            Result[i] = GKNAttributeGetters[i]();
+        }
+        return Result;
+    }();
+
+    check(Index < EKNAttribute::Count);
+    return Attributes[static_cast<int32>(Index)];
+}
+
+FGameplayTag FKNGASAttributeCache::GetTag(EKNAttribute Index)
+{
+    check(Index < EKNAttribute::Count);
+    return GKNAttributeTags[static_cast<int32>(Index)]->GetTag();
 }
-#pragma endregion 어트리뷰트 캐시 매니저 구현
\ No newline at end of file
+#pragma endregion 어트리뷰트 캐시 매니저 구현
@@ -0,0 +1,66 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GAS/System/KNOverclockMeter.h"
+
+#pragma region 오버클럭 미터 구현
+namespace
+{
+    /** @brief 임계값 돌파 직후에 타이머가 발동하도록 더하는 여유 시간 (부동소수 오차로 같은 레벨에 머무는 것을 방지) */
+    constexpr float KNOverclockEventSlack = 0.01f;
+}
+
+void FKNOverclockMeter::Configure(const FKNOverclockSettingRow& Setting)
+{
+    Thresholds[0] = Setting.Lv1Threshold;
+    Thresholds[1] = Setting.Lv2Threshold;
+    Thresholds[2] = Setting.Lv3Threshold;
+    DecayRate = FMath::Max(0.0f, Setting.OverclockDecayRate);
+    DecayDelay = FMath::Max(0.0f, Setting.OverclockDecayDelay);
+}
+
+void FKNOverclockMeter::ResetAnchor(float Point, float Now)
+{
+    AnchorPoint = Point;
+    DecayStartTime = Now + DecayDelay;
+}
+
+void FKNOverclockMeter::CommitAnchor(float Point, float Now)
+{
+    AnchorPoint = Point;
+    DecayStartTime = FMath::Min(DecayStartTime, Now);
+}
+
+float FKNOverclockMeter::GetPoint(float Now) const
+{
+    if (DecayRate <= 0.0f || Now <= DecayStartTime) return AnchorPoint;
+    return FMath::Max(0.0f, AnchorPoint - DecayRate * (Now - DecayStartTime));
+}
+
+int32 FKNOverclockMeter::ComputeLevel(float Point) const
+{
+    int32 Level = 0;
+    while (Level < MaxLevel && Point >= Thresholds[Level])
+    {
+        ++Level;
+    }
+    return Level;
+}
+
+bool FKNOverclockMeter::UpdateLevel(float Point, int32& OutOldLevel)
+{
+    OutOldLevel = CachedLevel;
+    CachedLevel = ComputeLevel(Point);
+    return CachedLevel != OutOldLevel;
+}
+
+float FKNOverclockMeter::GetNextDecayEventTime() const
+{
+    if (DecayRate <= 0.0f || AnchorPoint <= 0.0f) return -1.0f;
+
+    // 현재 레벨 임계값 아래로 내려가는 시점, Lv0이면 0에 도달하는 시점
+    const float Target = CachedLevel > 0 ? Thresholds[CachedLevel - 1] : 0.0f;
+    const float Slack = CachedLevel > 0 ? KNOverclockEventSlack : 0.0f;
+    return DecayStartTime + FMath::Max(0.0f, AnchorPoint - Target) / DecayRate + Slack;
+}
+#pragma endregion 오버클럭 미터 구현
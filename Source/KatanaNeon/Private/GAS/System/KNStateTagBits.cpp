@@ -0,0 +1,38 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GAS/System/KNStateTagBits.h"
+
+#pragma region 상태 태그 비트셋 구현
+namespace
+{
+    /** @brief 비트 인덱스 순서의 네이티브 태그 주소 표 (상수 초기화, 런타임 비용 없음) */
+    const FNativeGameplayTag* const GKNStateTags[] =
+    {
+#define KN_STATE_TAG_ADDRESS_ENTRY(Name, Tag) &Tag,
+        KN_STATE_TAG_LIST(KN_STATE_TAG_ADDRESS_ENTRY)
+#undef KN_STATE_TAG_ADDRESS_ENTRY
+    };
+
+    static_assert(UE_ARRAY_COUNT(GKNStateTags) == FKNStateTagBits::Num, "KN_STATE_TAG_LIST 태그 표 크기 불일치");
+}
+
+EKNStateTag FKNStateTagBits::ToIndex(const FGameplayTag& Tag)
+{
+    // 태그 존재 여부가 바뀔 때만 호출되므로 선형 비교로 충분합니다. (FName 비교 = 정수 비교)
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        if (GKNStateTags[Index]->GetTag() == Tag)
+        {
+            return static_cast<EKNStateTag>(Index);
+        }
+    }
+    return EKNStateTag::Count;
+}
+
+FGameplayTag FKNStateTagBits::GetTag(EKNStateTag Index)
+{
+    check(Index < EKNStateTag::Count);
+    return GKNStateTags[static_cast<int32>(Index)]->GetTag();
+}
+#pragma endregion 상태 태그 비트셋 구현
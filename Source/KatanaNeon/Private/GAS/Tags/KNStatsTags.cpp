@@ -38,6 +38,13 @@ namespace KatanaNeon
             UE_DEFINE_GAMEPLAY_TAG(AttackSpeed, "KatanaNeon.Data.Stats.AttackSpeed")
         }
 
+        namespace Damage
+        {
+            // ── 데미지 파이프라인 ─────────────────────────────
+            UE_DEFINE_GAMEPLAY_TAG(Base, "KatanaNeon.Data.Damage.Base")
+            UE_DEFINE_GAMEPLAY_TAG(Multiplier, "KatanaNeon.Data.Damage.Multiplier")
+        }
+
         namespace Actor
         {
             // ── Actor 분류 태그 ──────────────────────────────
@@ -0,0 +1,390 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GAS/Tasks/KNAbilityTask_BladeSweep.h"
+#include "Abilities/GameplayAbility.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Framework/System/KNCollisionChannels.h"
+
+#pragma region 기본 생성자 및 팩토리 구현
+UKNAbilityTask_BladeSweep::UKNAbilityTask_BladeSweep(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+    // 매 프레임 무기 포즈를 추적해야 하므로 틱 태스크로 동작합니다.
+    bTickingTask = true;
+}
+
+UKNAbilityTask_BladeSweep* UKNAbilityTask_BladeSweep::CreateBladeSweepTask(
+    UGameplayAbility* OwningAbility,
+    UAnimMontage* InMontage,
+    UStaticMeshComponent* InWeaponMesh,
+    FName InRootSocket,
+    FName InTipSocket,
+    float InStartNormTime,
+    float InEndNormTime,
+    float InSweepRadius,
+    float InSubStepDistance,
+    int32 InMaxSubStepsPerFrame,
+    FName InSectionName,
+    bool bInAsyncQueries)
+{
+    UKNAbilityTask_BladeSweep* Task = NewAbilityTask<UKNAbilityTask_BladeSweep>(OwningAbility);
+
+    Task->Montage = InMontage;
+    Task->WeaponMesh = InWeaponMesh;
+    Task->RootSocket = InRootSocket;
+    Task->TipSocket = InTipSocket;
+    Task->StartNormTime = FMath::Clamp(InStartNormTime, 0.0f, 1.0f);
+    Task->EndNormTime = FMath::Clamp(InEndNormTime, Task->StartNormTime, 1.0f);
+    Task->SweepRadius = FMath::Max(InSweepRadius, 0.1f);
+    Task->SubStepDistance = FMath::Max(InSubStepDistance, 1.0f);
+    Task->MaxSubStepsPerFrame = FMath::Max(InMaxSubStepsPerFrame, 1);
+    Task->SectionName = InSectionName;
+    Task->bAsyncQueries = bInAsyncQueries;
+
+    return Task;
+}
+#pragma endregion 기본 생성자 및 팩토리 구현
+
+#pragma region 태스크 오버라이드 구현
+void UKNAbilityTask_BladeSweep::Activate()
+{
+    Super::Activate();
+
+    UStaticMeshComponent* Mesh = WeaponMesh.Get();
+    if (!Mesh || !Montage || !Ability)
+    {
+        EndTask();
+        return;
+    }
+
+    if (!Mesh->DoesSocketExist(RootSocket) || !Mesh->DoesSocketExist(TipSocket))
+    {
+        UE_LOG(LogTemp, Warning,
+            TEXT("[KNBladeSweep] 소켓을 찾을 수 없습니다. Root: %s / Tip: %s"),
+            *RootSocket.ToString(), *TipSocket.ToString());
+        EndTask();
+        return;
+    }
+
+    // 스태틱 메시 소켓은 컴포넌트 공간에서 불변이므로 1회만 캐싱합니다.
+    LocalRoot = Mesh->GetSocketTransform(RootSocket, RTS_Component).GetLocation();
+    LocalTip = Mesh->GetSocketTransform(TipSocket, RTS_Component).GetLocation();
+
+    if (const FGameplayAbilityActorInfo* ActorInfo = Ability->GetCurrentActorInfo())
+    {
+        AnimInstance = ActorInfo->GetAnimInstance();
+    }
+
+    // 섹션 경계는 에셋 상수이므로 활성화 시 1회만 조회합니다.
+    RangeStartTime = 0.0f;
+    RangeLength = Montage->GetPlayLength();
+    const int32 SectionIndex = SectionName.IsNone() ? INDEX_NONE : Montage->GetSectionIndex(SectionName);
+    if (SectionIndex != INDEX_NONE)
+    {
+        float SectionEndTime = 0.0f;
+        Montage->GetSectionStartAndEndTime(SectionIndex, RangeStartTime, SectionEndTime);
+        RangeLength = SectionEndTime - RangeStartTime;
+    }
+
+    // 활성화 시점의 포즈를 보간 기준점으로 심어 두고, 첫 틱부터 [활성화 포즈, 현재 포즈] 구간을 훑습니다.
+    PrevNormTime = GetMontageNormTime();
+    PrevWeaponTransform = Mesh->GetComponentTransform();
+    bPrevPoseSwept = false;
+    bWindowOpened = false;
+    bSweepWindowDone = false;
+    SwingHitActors.Reset();
+
+    if (bAsyncQueries)
+    {
+        AsyncSweepDelegate.BindUObject(this, &UKNAbilityTask_BladeSweep::OnAsyncSweepCompleted);
+    }
+}
+
+void UKNAbilityTask_BladeSweep::TickTask(float DeltaTime)
+{
+    Super::TickTask(DeltaTime);
+
+    // 직전 프레임에 예약한 비동기 결과는 이번 프레임 틱 이전에 이미 전달되었습니다.
+    if (bSweepWindowDone)
+    {
+        EndTask();
+        return;
+    }
+
+    UStaticMeshComponent* Mesh = WeaponMesh.Get();
+    const float CurNormTime = GetMontageNormTime();
+
+    // 몽타주가 끝났거나 무기가 사라지면 이번 스윙은 종료합니다.
+    if (!Mesh || CurNormTime < 0.0f)
+    {
+        FinishSweepWindow();
+        return;
+    }
+
+    const FTransform CurWeaponTransform = Mesh->GetComponentTransform();
+
+    // 활성화 시 몽타주가 아직 재생 전이었거나 몽타주가 되감긴 경우: 보간 기준점만 다시 기록하고 다음 틱부터 훑습니다.
+    if (PrevNormTime < 0.0f || CurNormTime < PrevNormTime)
+    {
+        PrevNormTime = CurNormTime;
+        PrevWeaponTransform = CurWeaponTransform;
+        bPrevPoseSwept = false;
+        return;
+    }
+
+    const float Span = CurNormTime - PrevNormTime;
+
+    // 이번 프레임 구간 [Prev, Cur] 중 판정 구간 [Start, End]와 겹치는 비율만 훑습니다.
+    bool bReachedCurPose = false;
+    if (Span > KINDA_SMALL_NUMBER && PrevNormTime <= EndNormTime && CurNormTime >= StartNormTime)
+    {
+        const float AlphaFrom = FMath::Clamp((StartNormTime - PrevNormTime) / Span, 0.0f, 1.0f);
+        const float AlphaTo = FMath::Clamp((EndNormTime - PrevNormTime) / Span, 0.0f, 1.0f);
+        SweepInterpolated(PrevWeaponTransform, CurWeaponTransform, AlphaFrom, AlphaTo);
+        bReachedCurPose = AlphaTo >= 1.0f;
+    }
+    bPrevPoseSwept = bReachedCurPose;
+
+    PrevNormTime = CurNormTime;
+    PrevWeaponTransform = CurWeaponTransform;
+
+    if (CurNormTime > EndNormTime)
+    {
+        FinishSweepWindow();
+    }
+}
+
+void UKNAbilityTask_BladeSweep::OnDestroy(bool bInOwnerFinished)
+{
+    SwingHitActors.Reset();
+    HitBuffer.Reset();
+    AsyncSweepDelegate.Unbind();
+
+    Super::OnDestroy(bInOwnerFinished);
+}
+#pragma endregion 태스크 오버라이드 구현
+
+#pragma region 내부 헬퍼 함수 구현
+float UKNAbilityTask_BladeSweep::GetMontageNormTime() const
+{
+    const UAnimInstance* Anim = AnimInstance.Get();
+    if (!Anim || !Montage || !Anim->Montage_IsPlaying(Montage)) return -1.0f;
+
+    if (RangeLength <= KINDA_SMALL_NUMBER) return -1.0f;
+
+    // 섹션 시작 이전으로 점프했다면 이번 스윙은 끝난 것으로 봅니다. 이후 섹션으로 넘어간 경우는 1로 고정됩니다.
+    const float LocalTime = Anim->Montage_GetPosition(Montage) - RangeStartTime;
+    if (LocalTime < -KINDA_SMALL_NUMBER) return -1.0f;
+
+    return FMath::Clamp(LocalTime / RangeLength, 0.0f, 1.0f);
+}
+
+void UKNAbilityTask_BladeSweep::SweepInterpolated(
+    const FTransform& From, const FTransform& To, float AlphaFrom, float AlphaTo)
+{
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(KNBladeSweep), false);
+    if (AActor* Avatar = GetAvatarActor())
+    {
+        Params.AddIgnoredActor(Avatar);
+    }
+
+    FTransform PoseFrom;
+    PoseFrom.Blend(From, To, AlphaFrom);
+    FTransform PoseTo;
+    PoseTo.Blend(From, To, AlphaTo);
+
+    // 구간 진입 프레임: 첫 포즈를 기준으로 1회 브로드캐스트합니다.
+    if (!bWindowOpened)
+    {
+        bWindowOpened = true;
+        if (ShouldBroadcastAbilityTaskDelegates())
+        {
+            OnWindowOpened.Broadcast(PoseFrom.TransformPosition(LocalRoot), PoseFrom.TransformPosition(LocalTip));
+        }
+    }
+
+    // 칼끝 이동 거리에 비례해 서브스텝을 나누되, 프레임당 상한으로 비용을 고정합니다.
+    const float TipTravel = FVector::Dist(PoseFrom.TransformPosition(LocalTip), PoseTo.TransformPosition(LocalTip));
+    const int32 NumSteps = FMath::Clamp(FMath::CeilToInt(TipTravel / SubStepDistance), 1, MaxSubStepsPerFrame);
+
+    // AlphaFrom == 0 인 포즈를 직전 프레임 마지막 스텝에서 이미 훑었다면 건너뜁니다.
+    const bool bSkipFirstPose = AlphaFrom <= 0.0f && bPrevPoseSwept && !FMath::IsNearlyEqual(AlphaFrom, AlphaTo);
+    const int32 FirstStep = bSkipFirstPose ? 1 : 0;
+
+    for (int32 Step = FirstStep; Step <= NumSteps; ++Step)
+    {
+        const float Alpha = FMath::Lerp(AlphaFrom, AlphaTo, static_cast<float>(Step) / NumSteps);
+
+        FTransform Pose;
+        Pose.Blend(From, To, Alpha);
+        SweepSegment(Pose.TransformPosition(LocalRoot), Pose.TransformPosition(LocalTip), Params);
+
+        if (IsFinished()) return;
+    }
+}
+
+void UKNAbilityTask_BladeSweep::SweepSegment(
+    const FVector& Root, const FVector& Tip, const FCollisionQueryParams& Params)
+{
+    UWorld* World = GetWorld();
+    if (!World) return;
+
+    // PlayerAttack 채널은 살아 있는 적 허트박스만 응답하므로 결과에 캡슐·지형·아군이 섞이지 않습니다.
+    if (bAsyncQueries)
+    {
+        // 예약만 하고 즉시 반환합니다. 결과는 다음 프레임 OnAsyncSweepCompleted로 들어옵니다.
+        World->AsyncSweepByChannel(
+            EAsyncTraceType::Multi,
+            Root,
+            Tip,
+            FQuat::Identity,
+            KatanaNeon::Collision::PlayerAttack,
+            FCollisionShape::MakeSphere(SweepRadius),
+            Params,
+            FCollisionResponseParams::DefaultResponseParam,
+            &AsyncSweepDelegate);
+        return;
+    }
+
+    HitBuffer.Reset();
+    World->SweepMultiByChannel(
+        HitBuffer,
+        Root,
+        Tip,
+        FQuat::Identity,
+        KatanaNeon::Collision::PlayerAttack,
+        FCollisionShape::MakeSphere(SweepRadius),
+        Params);
+
+    ProcessSweepHits(HitBuffer);
+}
+
+void UKNAbilityTask_BladeSweep::ProcessSweepHits(TConstArrayView<FHitResult> Hits)
+{
+    for (const FHitResult& Hit : Hits)
+    {
+        AActor* HitActor = Hit.GetActor();
+        if (!HitActor) continue;
+
+        bool bAlreadyHit = false;
+        SwingHitActors.Add(HitActor, &bAlreadyHit);
+        if (bAlreadyHit) continue;
+
+        if (ShouldBroadcastAbilityTaskDelegates())
+        {
+            OnBladeHit.Broadcast(Hit);
+        }
+    }
+}
+
+void UKNAbilityTask_BladeSweep::FinishSweepWindow()
+{
+    if (bAsyncQueries)
+    {
+        bSweepWindowDone = true;
+        return;
+    }
+    EndTask();
+}
+
+void UKNAbilityTask_BladeSweep::OnAsyncSweepCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+    if (IsFinished()) return;
+
+    ProcessSweepHits(TraceDatum.OutHits);
+}
+#pragma endregion 내부 헬퍼 함수 구현
+
+#pragma region 쿼리 비용 벤치마크
+#if !UE_BUILD_SHIPPING
+/**
+ * @brief KN.Combat.BenchmarkBladeQuery [반복 횟수] [반경]
+ * 플레이어 전방 칼날 선분을 동기 SweepMultiByChannel과 AsyncSweepByChannel로 각각 N회 실행합니다.
+ * - 동기: 쿼리 전체의 게임 스레드 시간 (1회당 평균 µs)
+ * - 비동기 예약: AsyncSweepByChannel 호출만의 게임 스레드 시간 (쿼리 계산은 포함하지 않음)
+ * - 비동기 전달: 결과 델리게이트가 모두 도착한 뒤 예약~전달 지연(프레임·ms)과 적중 수를 따로 출력
+ * 적 50기를 스윕 범위 안에 배치한 뒤 실행합니다.
+ */
+static FAutoConsoleCommandWithWorldAndArgs GKNBladeQueryBenchmarkCommand(
+    TEXT("KN.Combat.BenchmarkBladeQuery"),
+    TEXT("칼날 스윕 비용 비교: 동기 쿼리 vs 비동기 예약(+결과 전달 지연). 사용법: KN.Combat.BenchmarkBladeQuery [Iterations] [Radius]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        const APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+        const APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+        if (!Pawn)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[KNBladeSweep] 벤치마크 실패: 플레이어 폰이 없습니다."));
+            return;
+        }
+
+        const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 200;
+        const float Radius = Args.Num() > 1 ? FMath::Max(FCString::Atof(*Args[1]), 1.0f) : 8.0f;
+
+        const FVector Root = Pawn->GetActorLocation() + Pawn->GetActorForwardVector() * 10.0f;
+        const FVector Tip = Pawn->GetActorLocation() + Pawn->GetActorForwardVector() * 400.0f;
+        const FCollisionShape Shape = FCollisionShape::MakeSphere(Radius);
+
+        FCollisionQueryParams Params(SCENE_QUERY_STAT(KNBladeSweep), false);
+        Params.AddIgnoredActor(Pawn);
+
+        TArray<FHitResult> Hits;
+        int32 SyncHits = 0;
+
+        const double SyncStart = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            Hits.Reset();
+            World->SweepMultiByChannel(Hits, Root, Tip, FQuat::Identity, KatanaNeon::Collision::PlayerAttack, Shape, Params);
+            SyncHits = Hits.Num();
+        }
+        const double SyncSec = FPlatformTime::Seconds() - SyncStart;
+
+        // 결과 전달까지 추적할 상태 — 델리게이트는 다음 프레임 이후 게임 스레드에서 호출됩니다.
+        struct FAsyncBenchmarkState
+        {
+            int32 Pending = 0;
+            int32 LastHits = 0;
+            double EnqueueStart = 0.0;
+            uint64 EnqueueFrame = 0;
+        };
+        const TSharedRef<FAsyncBenchmarkState> State = MakeShared<FAsyncBenchmarkState>();
+        State->Pending = Iterations;
+        State->EnqueueFrame = GFrameCounter;
+
+        const FTraceDelegate OnDelivered = FTraceDelegate::CreateLambda(
+            [State](const FTraceHandle&, FTraceDatum& Datum)
+            {
+                State->LastHits = Datum.OutHits.Num();
+
+                if (--State->Pending > 0) return;
+
+                UE_LOG(LogTemp, Log,
+                    TEXT("[KNBladeSweep] 비동기 결과 전달 완료 — 적중 %d, 예약~전달 %llu프레임 / %.2f ms (워커 계산 + 프레임 대기)"),
+                    State->LastHits, GFrameCounter - State->EnqueueFrame,
+                    (FPlatformTime::Seconds() - State->EnqueueStart) * 1.0e3);
+            });
+
+        // 예약 구간에는 쿼리 계산이 들어 있지 않습니다. 계산 비용은 워커 스레드로 옮겨져 위의 전달 로그에 지연으로 나타납니다.
+        State->EnqueueStart = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            World->AsyncSweepByChannel(EAsyncTraceType::Multi, Root, Tip, FQuat::Identity, KatanaNeon::Collision::PlayerAttack, Shape, Params,
+                FCollisionResponseParams::DefaultResponseParam, &OnDelivered);
+        }
+        const double AsyncSec = FPlatformTime::Seconds() - State->EnqueueStart;
+
+        const double ToUs = 1.0e6 / Iterations;
+        UE_LOG(LogTemp, Log,
+            TEXT("[KNBladeSweep] %d회, 반경 %.1f, 적중 %d — 동기 쿼리: %.2f µs / 비동기 예약만: %.2f µs (게임 스레드 1회당, 결과 전달 제외)"),
+            Iterations, Radius, SyncHits, SyncSec * ToUs, AsyncSec * ToUs);
+    }));
+#endif
+#pragma endregion 쿼리 비용 벤치마크
@@ -3,6 +3,9 @@
 
 #include "Objects/Projectiles/KNSlashProjectile.h"
 #include "AbilitySystemComponent.h"
+#include "Framework/System/KNHitQueueSubsystem.h"
+#include "Framework/System/KNCollisionChannels.h"
+#include "Framework/System/KNActorPoolSubsystem.h"
 #include "AbilitySystemInterface.h" // 베테랑 최적화: O(1) ASC 캐스팅용
 #include "Components/BoxComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
@@ -18,7 +21,8 @@ AKNSlashProjectile::AKNSlashProjectile()
     // ── Box 충돌 컴포넌트 ──
     CollisionBox = CreateDefaultSubobject<UBoxComponent>(TEXT("CollisionBox"));
     SetRootComponent(CollisionBox);
-    CollisionBox->SetCollisionProfileName(TEXT("Projectile"));
+    // KNProjectile 프로필: 지형과 적 허트박스에서만 멈추고, 이동 캡슐(Pawn)은 통과합니다.
+    CollisionBox->SetCollisionProfileName(KatanaNeon::Collision::Profile::Projectile);
     CollisionBox->SetGenerateOverlapEvents(false); // Overlap 대신 정확한 Hit 물리 이벤트 사용
     CollisionBox->SetNotifyRigidBodyCollision(true);
 
@@ -27,24 +31,22 @@ AKNSlashProjectile::AKNSlashProjectile()
     ProjectileMovement->bRotationFollowsVelocity = true;
     ProjectileMovement->bShouldBounce = false;
     ProjectileMovement->ProjectileGravityScale = 0.0f; // 참격파는 일직선으로 날아감
+    ProjectileMovement->bAutoActivate = false; // 풀에서 꺼낼 때 OnAcquiredFromPool이 활성화
 
     // ── 비주얼 이펙트 ──
     SlashFX = CreateDefaultSubobject<UNiagaraComponent>(TEXT("SlashFX"));
     SlashFX->SetupAttachment(RootComponent);
-    SlashFX->bAutoActivate = true;
+    SlashFX->bAutoActivate = false;
 }
 
-void AKNSlashProjectile::BeginPlay()
+void AKNSlashProjectile::LifeSpanExpired()
 {
-    Super::BeginPlay();
-
-    // Hit 콜백 등록
-    CollisionBox->OnComponentHit.AddDynamic(this, &AKNSlashProjectile::OnCollisionHit);
+    UKNActorPoolSubsystem::ReleaseActor(this);
 }
 #pragma endregion 기본 생성자 및 초기화 구현
 
 #pragma region 발사 초기화 인터페이스 구현
-void AKNSlashProjectile::InitProjectile(
+void AKNSlashProjectile::SetPayload(
     UAbilitySystemComponent* InInstigatorASC,
     TSubclassOf<UGameplayEffect>  InDamageGEClass,
     TSubclassOf<UGameplayEffect>  InGrogyGEClass,
@@ -55,21 +57,49 @@ void AKNSlashProjectile::InitProjectile(
     DamageGEClass = InDamageGEClass;
     GrogyGEClass = InGrogyGEClass;
     CachedRow = InRow;
+}
+#pragma endregion 발사 초기화 인터페이스 구현
+
+#pragma region 액터 풀 수명주기 구현
+void AKNSlashProjectile::OnAcquiredFromPool_Implementation()
+{
+    bHitProcessed = false;
 
     // Box 크기 및 이동 속도를 기획자 데이터(DataTable)로 초기화
-    CollisionBox->SetBoxExtent(InRow.SlashBoxHalfExtent);
-    ProjectileMovement->InitialSpeed = InRow.SlashSpeed;
-    ProjectileMovement->MaxSpeed = InRow.SlashSpeed;
+    CollisionBox->SetBoxExtent(CachedRow.SlashBoxHalfExtent);
+    CollisionBox->OnComponentHit.AddUniqueDynamic(this, &AKNSlashProjectile::OnCollisionHit);
+
+    // 이전 발사에서 지형에 막혀 시뮬레이션이 끝났다면 UpdatedComponent가 비어 있으므로 다시 연결합니다.
+    ProjectileMovement->SetUpdatedComponent(CollisionBox);
+    ProjectileMovement->InitialSpeed = CachedRow.SlashSpeed;
+    ProjectileMovement->MaxSpeed = CachedRow.SlashSpeed;
+    ProjectileMovement->Velocity = GetActorForwardVector() * CachedRow.SlashSpeed;
+    ProjectileMovement->Activate(true);
+    ProjectileMovement->UpdateComponentVelocity();
+
+    SlashFX->Activate(true);
 
     // ── 베테랑 최적화 2: Tick 거리 검사를 대체하는 엔진 네이티브 수명(LifeSpan) 시스템 ──
-    // 시간 = 거리 / 속력
-    if (InRow.SlashSpeed > 0.0f)
+    // 시간 = 거리 / 속력 (만료 시 LifeSpanExpired가 풀로 반납)
+    if (CachedRow.SlashSpeed > 0.0f)
     {
-        const float CalculatedLifeTime = InRow.SlashMaxDistance / InRow.SlashSpeed;
-        SetLifeSpan(CalculatedLifeTime); // 지정된 시간 뒤에 엔진이 비용 0으로 자동 Destroy 처리
+        SetLifeSpan(CachedRow.SlashMaxDistance / CachedRow.SlashSpeed);
     }
 }
-#pragma endregion 발사 초기화 인터페이스 구현
+
+void AKNSlashProjectile::OnReleasedToPool_Implementation()
+{
+    CollisionBox->OnComponentHit.RemoveDynamic(this, &AKNSlashProjectile::OnCollisionHit);
+
+    ProjectileMovement->StopMovementImmediately();
+    ProjectileMovement->Deactivate();
+    SlashFX->DeactivateImmediate();
+
+    InstigatorASC.Reset();
+    bHitProcessed = false;
+}
+#pragma endregion 액터 풀 수명주기 구현
+
 
 #pragma region 내부 헬퍼 함수 구현
 void AKNSlashProjectile::OnCollisionHit(
@@ -100,23 +130,25 @@ void AKNSlashProjectile::ProcessHit(AActor* TargetActor)
     // ASC가 없는 배경 프랍(벽, 바닥 등)에 맞은 경우: 이펙트만 터뜨리고 바로 소멸
     if (!TargetASC)
     {
-        Destroy();
+        UKNActorPoolSubsystem::ReleaseActor(this);
         return;
     }
 
     bHitProcessed = true; // 중복 피격 완벽 방지
 
-    // ── 1. 데미지 GE 적용 ──
+    // ── 1. 데미지 GE — 프레임 말 피격 큐에서 일괄 적용 ──
     if (DamageGEClass)
     {
-        FGameplayEffectContextHandle Context = InstigatorASC->MakeEffectContext();
-        Context.AddInstigator(GetInstigator(), this);
-
-        FGameplayEffectSpecHandle DmgSpec = InstigatorASC->MakeOutgoingSpec(DamageGEClass, 1.0f, Context);
-        if (FGameplayEffectSpec* Spec = DmgSpec.Data.Get())
+        if (UKNHitQueueSubsystem* HitQueue = UKNHitQueueSubsystem::Get(this))
         {
-            Spec->SetSetByCallerMagnitude(KatanaNeon::Data::Stats::Health, -CachedRow.SlashDamage);
-            TargetASC->ApplyGameplayEffectSpecToSelf(*Spec);
+            FKNHitRecord Record;
+            Record.SourceASC = InstigatorASC;
+            Record.TargetASC = TargetASC;
+            Record.DamageGEClass = DamageGEClass;
+            Record.BaseDamage = CachedRow.SlashDamage;
+            Record.Instigator = GetInstigator();
+            Record.EffectCauser = this;
+            HitQueue->Enqueue(MoveTemp(Record));
         }
     }
 
@@ -133,8 +165,8 @@ void AKNSlashProjectile::ProcessHit(AActor* TargetActor)
         }
     }
 
-    // 피격 후 발사체 소멸
-    Destroy();
+    // 피격 후 발사체를 풀로 반납
+    UKNActorPoolSubsystem::ReleaseActor(this);
 }
 #pragma endregion 내부 헬퍼 함수 구현
 
@@ -8,6 +8,7 @@
 #include "UI/Widgets/KNWeaponStateWidget.h"
 #include "GAS/Components/KNStatsComponent.h" 
 #include "AbilitySystemComponent.h"
+#include "GAS/Components/KNAbilitySystemComponent.h"
 #include "GAS/Attributes/KNAttributeSet.h"
 #include "GAS/Tags/KNStatsTags.h"
 
@@ -19,6 +20,30 @@ void UKNMainHUDWidget::NativeConstruct()
     // 보스 UI는 기본적으로 숨깁니다.
     SetBossHUDVisible(false);
 }
+
+void UKNMainHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+    Super::NativeTick(MyGeometry, InDeltaTime);
+
+    // 회복/소모 구간이 아닐 때는 값 변경 델리게이트만으로 충분합니다.
+    const UKNStatsComponent* Stats = StatsComponent.Get();
+    if (!Stats) return;
+
+    if (Stats->IsStaminaRegenerating())
+    {
+        UpdateStamina(Stats->GetCurrentStamina(), CachedMaxStamina);
+    }
+
+    if (Stats->IsChronosDraining())
+    {
+        UpdateChronos(Stats->GetCurrentChronos(), CachedMaxChronos);
+    }
+
+    if (Stats->IsOverclockDecaying())
+    {
+        UpdateOverclockPoint(Stats->GetCurrentOverclockPoint(), CachedMaxOverclockPoint);
+    }
+}
 #pragma endregion 위젯 생명주기 오버라이드 구현
 
 #pragma region 외부 제어 인터페이스 구현
@@ -26,6 +51,8 @@ void UKNMainHUDWidget::InitHUD(UKNStatsComponent* InStatsComponent)
 {
     if (!InStatsComponent) return;
 
+    StatsComponent = InStatsComponent;
+
     InStatsComponent->OnHealthChanged.AddDynamic(this, &UKNMainHUDWidget::OnHealthChangedCallback);
     InStatsComponent->OnStaminaChanged.AddDynamic(this, &UKNMainHUDWidget::OnStaminaChangedCallback);
     InStatsComponent->OnChronosChanged.AddDynamic(this, &UKNMainHUDWidget::OnChronosChangedCallback);
@@ -102,7 +129,7 @@ void UKNMainHUDWidget::SyncInitialValues(UKNStatsComponent* InStatsComponent)
     if (!AttrSet) return;
 
     // 무기 초기 상태 동기화
-    if (ASC->HasMatchingGameplayTag(KatanaNeon::State::Combat::WeaponDrawn))
+    if (UKNAbilitySystemComponent::HasState(ASC, EKNStateTag::WeaponDrawn))
     {
         UpdateWeaponState(true);
     }
@@ -112,9 +139,12 @@ void UKNMainHUDWidget::SyncInitialValues(UKNStatsComponent* InStatsComponent)
     }
 
     UpdateHealth(AttrSet->GetHealth(), AttrSet->GetMaxHealth());
-    UpdateStamina(AttrSet->GetStamina(), AttrSet->GetMaxStamina());
-    UpdateChronos(AttrSet->GetChronos(), AttrSet->GetMaxChronos());
-    UpdateOverclockPoint(AttrSet->GetOverclockPoint(), AttrSet->GetMaxOverclockPoint());
+    CachedMaxStamina = AttrSet->GetMaxStamina();
+    UpdateStamina(InStatsComponent->GetCurrentStamina(), CachedMaxStamina);
+    CachedMaxChronos = AttrSet->GetMaxChronos();
+    UpdateChronos(InStatsComponent->GetCurrentChronos(), CachedMaxChronos);
+    CachedMaxOverclockPoint = AttrSet->GetMaxOverclockPoint();
+    UpdateOverclockPoint(InStatsComponent->GetCurrentOverclockPoint(), CachedMaxOverclockPoint);
 }
 #pragma endregion 외부 제어 인터페이스 구현
 
@@ -126,16 +156,19 @@ void UKNMainHUDWidget::OnHealthChangedCallback(float Current, float Max)
 
 void UKNMainHUDWidget::OnStaminaChangedCallback(float Current, float Max)
 {
+    CachedMaxStamina = Max;
     UpdateStamina(Current, Max);
 }
 
 void UKNMainHUDWidget::OnChronosChangedCallback(float Current, float Max)
 {
+    CachedMaxChronos = Max;
     UpdateChronos(Current, Max);
 }
 
 void UKNMainHUDWidget::OnOverclockPointChangedCallback(float Current, float Max)
 {
+    CachedMaxOverclockPoint = Max;
     UpdateOverclockPoint(Current, Max);
 }
 
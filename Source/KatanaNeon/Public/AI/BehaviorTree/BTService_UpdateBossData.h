@@ -6,10 +6,35 @@
 #include "BehaviorTree/BTService.h"
 #include "BTService_UpdateBossData.generated.h"
 
+#pragma region 전방 선언
+class UAbilitySystemComponent;
+#pragma endregion 전방 선언
+
+#pragma region 노드 메모리
+/**
+ * @struct FBTUpdateBossDataMemory
+ * @brief  보스(비헤이비어 트리 인스턴스)별 이벤트 구독과 마지막 거리 구간입니다.
+ */
+struct FBTUpdateBossDataMemory
+{
+    /** @brief 그로기 태그 이벤트를 등록한 보스 ASC */
+    TWeakObjectPtr<UAbilitySystemComponent> ASC;
+
+    /** @brief 그로기 태그 이벤트 구독 핸들 (관련성 해제 시 제거) */
+    FDelegateHandle GroggyHandle;
+
+    /** @brief 마지막으로 DistToPlayer를 기록한 대상 */
+    TWeakObjectPtr<AActor> LastTarget;
+
+    /** @brief 마지막으로 기록한 거리 구간 (INDEX_NONE = 미기록) */
+    int32 Band = INDEX_NONE;
+};
+#pragma endregion 노드 메모리
+
 /**
  * @file    BTService_UpdateBossData.h
  * @class   UBTService_UpdateBossData
- * @brief   매 틱마다 보스 관련 블랙보드 데이터를 갱신하는 BT 서비스입니다.
+ * @brief   보스 관련 블랙보드 데이터를 값이 실제로 바뀔 때만 갱신하는 BT 서비스입니다.
  *
  * @details
  * [SRP 책임]
@@ -18,14 +43,22 @@
  * - 루트 노드에 붙여 항상 실행되도록 설정합니다.
  *
  * [갱신 항목]
- * - DistToPlayer : 보스와 플레이어 사이의 거리 (cm)
- * - bIsStunned   : GAS 태그 State.Combat.Groggy 보유 여부
+ * - bIsStunned   : State.Combat.Groggy 태그 이벤트(RegisterGameplayTagEvent)로만 갱신 — 폴링 없음
+ * - DistToPlayer : 거리 구간(근접·후퇴·교전) 경계를 넘을 때만 그 시점의 거리(cm)를 기록
+ *                  실시간 거리가 아니라 구간 전환 값이므로, 경계값 비교 외의 용도(정확한 거리 계산 등)로 읽으면 안 됩니다.
+ *
+ * [적응형 점검 주기]
+ * 구간 판정은 제곱 거리 비교로 하고, 다음 점검은 가장 가까운 경계까지 MaxClosingSpeed로 다가오는 데 걸리는 시간 뒤로 예약합니다.
+ * 플레이어가 멀거나 대상이 없는 대기 상태에서는 MaxCheckInterval마다 한 번만 깨어납니다.
+ * 경계 부근의 떨림은 BandHysteresis로 막으므로, 블랙보드 데코레이터 재평가는 구간이 실제로 바뀔 때만 일어납니다.
+ * 데코레이터의 거리 비교값은 구간 경계값과 맞춰 두어야 합니다. (기본값은 BT_Boss 데코레이터의 300 / 400 / 500)
+ * 기록되는 거리는 항상 경계에서 BandHysteresis 이상 떨어져 있으므로, 경계값과 같은 비교값은 구간과 같은 쪽으로 판정됩니다.
  */
 UCLASS(meta = (DisplayName = "보스 데이터 갱신 서비스"))
 class KATANANEON_API UBTService_UpdateBossData : public UBTService
 {
 	GENERATED_BODY()
-	
+
 #pragma region 기본 생성자 및 초기화
 public:
     /**
@@ -36,7 +69,7 @@ public:
 
 protected:
     /**
-     * @brief 블랙보드 에셋 연결 시 키를 실제 인덱스로 해결합니다.
+     * @brief 블랙보드 에셋 연결 시 키를 실제 인덱스로 해결하고, 구간 경계를 제곱 거리로 정렬해 둡니다.
      * @param Asset 연결된 비헤이비어 트리 에셋
      */
     virtual void InitializeFromAsset(UBehaviorTree& Asset) override;
@@ -44,8 +77,26 @@ protected:
 
 #pragma region 서비스 오버라이드
 protected:
+    virtual uint16 GetInstanceMemorySize() const override;
+    virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+    virtual void CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const override;
+
+    /**
+     * @brief 서비스 활성화 — 그로기 태그 이벤트를 구독하고 현재 상태를 한 번 기록합니다.
+     * @param OwnerComp 비헤이비어 트리 컴포넌트
+     * @param NodeMemory 노드 메모리
+     */
+    virtual void OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
     /**
-     * @brief 서비스 틱 — 플레이어 거리와 그로기 상태를 블랙보드에 갱신합니다.
+     * @brief 서비스 비활성화 — 그로기 태그 이벤트 구독을 해제합니다.
+     * @param OwnerComp 비헤이비어 트리 컴포넌트
+     * @param NodeMemory 노드 메모리
+     */
+    virtual void OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+    /**
+     * @brief 서비스 틱 — 거리 구간이 바뀌었을 때만 DistToPlayer를 기록하고 다음 점검 시각을 예약합니다.
      * @param OwnerComp 비헤이비어 트리 컴포넌트
      * @param NodeMemory 노드 메모리
      * @param DeltaSeconds 델타 시간
@@ -71,4 +122,61 @@ protected:
     FBlackboardKeySelector IsStunnedKey;
 #pragma endregion 에디터 노출 블랙보드 키
 
+#pragma region 거리 구간 설정
+protected:
+    /** @brief 근접 공격 구간 경계 (cm) */
+    UPROPERTY(EditAnywhere, Category = "KatanaNeon|Distance", meta = (ClampMin = 0.0f))
+    float MeleeRange = 300.0f;
+
+    /** @brief 후퇴 판단 구간 경계 (cm) */
+    UPROPERTY(EditAnywhere, Category = "KatanaNeon|Distance", meta = (ClampMin = 0.0f))
+    float RetreatRange = 400.0f;
+
+    /** @brief 교전 개시 구간 경계 (cm) */
+    UPROPERTY(EditAnywhere, Category = "KatanaNeon|Distance", meta = (ClampMin = 0.0f))
+    float EngageRange = 500.0f;
+
+    /** @brief 경계 양쪽의 여유 폭 — 경계를 이만큼 넘어야 구간이 바뀝니다. 경계 간격의 절반보다 작아야 합니다. (cm) */
+    UPROPERTY(EditAnywhere, Category = "KatanaNeon|Distance", meta = (ClampMin = 0.0f))
+    float BandHysteresis = 25.0f;
+
+    /** @brief 보스와 플레이어가 서로 가까워질 수 있는 최대 속도 — 다음 점검 시각 계산용 (cm/s) */
+    UPROPERTY(EditAnywhere, Category = "KatanaNeon|Distance", meta = (ClampMin = 1.0f))
+    float MaxClosingSpeed = 1500.0f;
+
+    /** @brief 최소 점검 간격 (초, 경계 바로 옆) */
+    UPROPERTY(EditAnywhere, Category = "KatanaNeon|Distance", meta = (ClampMin = 0.0f))
+    float MinCheckInterval = 0.05f;
+
+    /** @brief 최대 점검 간격 (초, 대상 없음 또는 모든 경계에서 멀 때) */
+    UPROPERTY(EditAnywhere, Category = "KatanaNeon|Distance", meta = (ClampMin = 0.0f))
+    float MaxCheckInterval = 0.5f;
+#pragma endregion 거리 구간 설정
+
+#pragma region 내부 헬퍼 함수
+private:
+    /**
+     * @brief 현재 구간과 여유 폭을 고려해 제곱 거리가 속한 구간을 구합니다.
+     * @param DistSq  보스-플레이어 제곱 거리
+     * @param Current 마지막으로 기록한 구간 (INDEX_NONE이면 여유 폭 없이 판정)
+     * @return 0(가장 가까움) ~ 경계 수(가장 멂)
+     */
+    int32 ComputeBand(float DistSq, int32 Current) const;
+
+    /**
+     * @brief 가장 가까운 경계에 도달할 수 있는 최단 시간으로 다음 점검 간격을 구합니다.
+     * @param Dist 보스-플레이어 거리
+     */
+    float ComputeNextInterval(float Dist) const;
+
+    /** @brief 오름차순 구간 경계 (cm) */
+    TArray<float, TInlineAllocator<3>> BandEdges;
+
+    /** @brief 바깥으로 나갈 때 쓰는 제곱 경계 ((Edge + Hysteresis)^2) */
+    TArray<float, TInlineAllocator<3>> OuterEdgesSq;
+
+    /** @brief 안으로 들어올 때 쓰는 제곱 경계 ((Edge - Hysteresis)^2) */
+    TArray<float, TInlineAllocator<3>> InnerEdgesSq;
+#pragma endregion 내부 헬퍼 함수
+
 };
@@ -27,8 +27,8 @@ class UAISenseConfig_Sight;
  * - "TargetPlayer"  : Object(AActor) — 감지된 플레이어
  * - "bIsAttacking"  : Bool           — 공격 중 여부
  * - "CurrentPhase"  : Int            — 현재 페이즈 인덱스
- * - "bIsStunned"    : Bool           — 그로기(행동 불능) 여부
- * - "DistToPlayer"  : Float          — 플레이어까지 거리 (BTService 갱신)
+ * - "bIsStunned"    : Bool           — 그로기(행동 불능) 여부 (BTService가 그로기 태그 이벤트로 갱신)
+ * - "DistToPlayer"  : Float          — 플레이어까지 거리 (BTService가 거리 구간이 바뀔 때만 갱신)
  */
 UCLASS()
 class KATANANEON_API AKNBossController : public AAIController
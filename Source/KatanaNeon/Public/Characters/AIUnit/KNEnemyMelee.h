@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Characters/AIUnit/KNEnemyBase.h"
+#include "WorldCollision.h"
 #include "KNEnemyMelee.generated.h"
 
 /**
@@ -39,6 +40,21 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "KatanaNeon|Enemy|Combat")
     void ActivateMeleeHitbox();
+
+protected:
+    /**
+     * @brief 근접 히트 시 적용할 데미지 Instant GE 클래스. (기본값: UKNDamageEffect)
+     * @details 플레이어 콤보와 같은 UKNDamageExecution 파이프라인으로 CachedEnemyStat.AttackDamage를 전달합니다.
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Enemy|GAS")
+    TSubclassOf<UGameplayEffect> MeleeDamageGEClass = nullptr;
+
+    /**
+     * @brief 근접 판정을 비동기 오버랩(AsyncOverlapByChannel)으로 수행할지 여부.
+     * @details 켜면 적중이 최대 1프레임 늦게 피격 큐에 등록됩니다.
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Enemy|Combat")
+    bool bUseAsyncMeleeQuery = false;
 #pragma endregion 근접 공격 인터페이스
 
 #pragma region 돌진 공격 인터페이스
@@ -61,5 +77,18 @@ private:
 
     /** @brief 돌진 상태를 해제하는 콜백 함수입니다. */
     void OnChargeEnd();
+
+    /**
+     * @brief 오버랩 결과에서 액터당 1회씩 데미지를 피격 큐에 등록합니다.
+     * @param Overlaps 오버랩 결과
+     */
+    void ResolveMeleeOverlaps(TConstArrayView<FOverlapResult> Overlaps);
+
+    /**
+     * @brief 비동기 근접 오버랩 결과 수신 콜백입니다. (다음 프레임)
+     * @param TraceHandle  트레이스 핸들
+     * @param OverlapDatum 오버랩 요청 및 결과
+     */
+    void OnAsyncMeleeOverlapCompleted(const FTraceHandle& TraceHandle, FOverlapDatum& OverlapDatum);
 #pragma endregion 런타임 전투 상태
 };
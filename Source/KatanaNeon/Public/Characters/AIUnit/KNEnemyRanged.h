@@ -10,6 +10,8 @@
 
 #pragma region 전방 선언
 class AActor;
+class UGameplayEffect;
+class UNiagaraSystem;
 #pragma endregion 전방 선언 끝
 
 /**
@@ -46,7 +48,23 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Enemy|DataTable")
     FDataTableRowHandle RangedStatRowHandle;
 
-    /** @brief 발사할 발사체 액터 클래스 (에디터 할당) */
+    /**
+     * @brief 발사체를 액터 대신 UKNProjectileSubsystem의 관리형 발사체로 쏠지 여부.
+     * @details 관리형 발사체는 ProjectileFX로만 보이므로, 이펙트를 지정한 블루프린트에서만 켭니다.
+     *          꺼져 있으면(기본) ProjectileClass 액터를 스폰(풀 재사용)하는 경로를 사용합니다.
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Enemy|Combat")
+    bool bUseProjectileManager = false;
+
+    /** @brief 관리형 발사체가 화면에 보일 때 바인딩되는 루프 Niagara 이펙트 */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Enemy|Combat", meta = (EditCondition = "bUseProjectileManager"))
+    TObjectPtr<UNiagaraSystem> ProjectileFX = nullptr;
+
+    /** @brief 관리형 발사체 적중 시 피격 큐로 적용할 데미지 GE 클래스 (기본값: UKNDamageEffect) */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Enemy|GAS")
+    TSubclassOf<UGameplayEffect> ProjectileDamageGEClass = nullptr;
+
+    /** @brief 발사할 발사체 액터 클래스 (bUseProjectileManager가 꺼져 있을 때 사용) */
     UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Enemy|Combat")
     TSubclassOf<AActor> ProjectileClass = nullptr;
 
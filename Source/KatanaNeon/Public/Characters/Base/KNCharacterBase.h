@@ -5,12 +5,15 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "AbilitySystemInterface.h"
+#include "GAS/System/KNAbilityRegistry.h"
+#include "Framework/System/KNTimeDilationSubsystem.h"
 #include "KNCharacterBase.generated.h"
 
 #pragma region 전방 선언
 class UAbilitySystemComponent;
 class UKNAttributeSet;
 class UGameplayAbility;
+class UCapsuleComponent;
 #pragma endregion 전방 선언 끝
 
 #pragma region 델리게이트 선언
@@ -36,6 +39,9 @@ public:
 protected:
     virtual void BeginPlay() override;
 
+    /** @brief 어빌리티 레지스트리의 ASC 콜백 구독을 해제합니다. */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     /** @brief 착지 시 공중 상태 태그(DoubleJumped 등)를 초기화합니다. */
     virtual void Landed(const FHitResult& Hit) override;
 #pragma endregion 기본 생성자 및 초기화 끝
@@ -47,8 +53,42 @@ public:
      * @return 이 캐릭터가 소유한 AbilitySystemComponent를 반환합니다.
      */
     virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
+
+    /**
+     * @brief 어빌리티 태그 → 스펙 핸들 / 주 인스턴스 O(1) 레지스트리를 반환합니다.
+     * @details 애님 노티파이와 입력 콜백이 스펙 선형 탐색 대신 사용합니다.
+     */
+    FORCEINLINE const FKNAbilityRegistry& GetAbilityRegistry() const { return AbilityRegistry; }
 #pragma endregion GAS 인터페이스 구현
 
+#pragma region 피격 판정
+public:
+    /** @brief 공격 쿼리가 브로드페이즈에서 걸러 돌려주는 피격 판정 캡슐을 반환합니다. */
+    FORCEINLINE UCapsuleComponent* GetHurtboxComponent() const { return HurtboxComponent; }
+
+protected:
+    /**
+     * @brief 이동 캡슐과 분리된 KNHurtbox 오브젝트 채널 피격 판정 캡슐입니다.
+     * @details 적은 KNEnemyHurtbox, 플레이어는 KNPlayerHurtbox 프로필을 사용하며,
+     * BeginPlay에서 이동 캡슐 크기에 맞춰집니다. 사망 시 콜리전이 꺼져 쿼리 결과에서 빠집니다.
+     */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "KatanaNeon|Collision", meta = (AllowPrivateAccess = "true"))
+    TObjectPtr<UCapsuleComponent> HurtboxComponent = nullptr;
+#pragma endregion 피격 판정
+
+#pragma region 시간 배율
+public:
+    /** @brief 시간 서브시스템에 등록된 진영 (크로노스 필드의 감속 대상 결정용) */
+    FORCEINLINE EKNTimeTeam GetTimeTeam() const { return TimeTeam; }
+
+protected:
+    /**
+     * @brief 시간 서브시스템의 진영 레이어 대상 구분입니다.
+     * @details 기본값은 적이며 플레이어가 생성자에서 덮어씁니다. BeginPlay에서 등록, EndPlay에서 해제됩니다.
+     */
+    EKNTimeTeam TimeTeam = EKNTimeTeam::Enemy;
+#pragma endregion 시간 배율
+
 #pragma region 사망 이벤트
 public:
     /** @brief 캐릭터 사망 시 외부 시스템이 구독할 델리게이트입니다. */
@@ -85,5 +125,8 @@ protected:
     /** @brief 캐릭터의 체력, 스태미나, 크로노스 등의 수치를 들고 있는 데이터 셋입니다. */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "KatanaNeon|GAS", meta = (AllowPrivateAccess = "true"))
     TObjectPtr<UKNAttributeSet> AttributeSet = nullptr;
+
+    /** @brief GiveDefaultAbilities 시 채워지고 ASC 활성/종료 콜백으로 갱신되는 어빌리티 레지스트리 */
+    FKNAbilityRegistry AbilityRegistry;
 #pragma endregion GAS 핵심 컴포넌트
 };
@@ -0,0 +1,84 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/StaticMeshComponent.h"
+
+#pragma region 전방 선언
+class UAbilitySystemComponent;
+class UKNStatsComponent;
+#pragma endregion 전방 선언
+
+/**
+ * @file    KNCombatContext.h
+ * @struct  FKNCombatContext
+ * @brief   플레이어 전투 어빌리티가 매 타격마다 참조하는 컴포넌트와 무기 소켓을 미리 해석해 둔 캐시입니다.
+ *
+ * @details
+ * AKNPlayerCharacter가 소유하며 BeginPlay와 발도/납도(무기 재부착) 시점에만 갱신됩니다.
+ * 어빌리티는 AKNPlayerCharacter::GetCombatContext로 접근하여
+ * FindComponentByClass, DoesSocketExist, 이름 기반 GetSocketLocation 없이 판정 좌표를 계산합니다.
+ *
+ * [소켓 캐싱]
+ * 스태틱 메시 소켓은 본 인덱스가 없고 컴포넌트 공간에서 불변이므로,
+ * 해석 결과를 컴포넌트 공간 좌표로 보관하고 월드 좌표는 컴포넌트 트랜스폼 1회 변환으로 구합니다.
+ *
+ * 포인터는 모두 캐릭터가 UPROPERTY로 소유한 컴포넌트이므로 캐릭터 수명 동안 유효합니다.
+ */
+struct FKNCombatContext
+{
+    /** @brief 캐릭터의 ASC */
+    UAbilitySystemComponent* AbilitySystem = nullptr;
+
+    /** @brief 플레이어 스탯 매니저 (오버클럭 게이지 적립/소모 대상) */
+    UKNStatsComponent* Stats = nullptr;
+
+    /** @brief 카타나 메시 */
+    UStaticMeshComponent* WeaponMesh = nullptr;
+
+    /** @brief 해석에 사용한 칼날 시작 소켓 이름 (어빌리티 설정과 비교용) */
+    FName BladeRootSocket;
+
+    /** @brief 해석에 사용한 칼날 끝 소켓 이름 (어빌리티 설정과 비교용) */
+    FName BladeTipSocket;
+
+    /** @brief 칼날 시작 소켓의 컴포넌트 공간 위치 */
+    FVector LocalBladeRoot = FVector::ZeroVector;
+
+    /** @brief 칼날 끝 소켓의 컴포넌트 공간 위치 */
+    FVector LocalBladeTip = FVector::ZeroVector;
+
+    /** @brief 두 칼날 소켓이 모두 해석되었는지 여부 */
+    bool bBladeSocketsResolved = false;
+
+    /** @brief 마지막 갱신 시점의 발도 상태 */
+    bool bWeaponDrawn = false;
+
+    /**
+     * @brief 요청한 소켓 이름이 캐시와 일치하는지 확인합니다. (FName 비교만 수행)
+     * @param RootSocket 칼날 시작 소켓 이름
+     * @param TipSocket  칼날 끝 소켓 이름
+     * @return 캐시된 좌표를 그대로 쓸 수 있으면 true
+     */
+    FORCEINLINE bool MatchesBladeSockets(FName RootSocket, FName TipSocket) const
+    {
+        return bBladeSocketsResolved && BladeRootSocket == RootSocket && BladeTipSocket == TipSocket;
+    }
+
+    /**
+     * @brief 현재 무기 포즈의 칼날 선분을 월드 좌표로 계산합니다.
+     * @param OutRoot 칼날 시작 위치
+     * @param OutTip  칼날 끝 위치
+     * @return 소켓이 해석되어 있지 않으면 false (출력값 미변경)
+     */
+    FORCEINLINE bool GetBladeSegment(FVector& OutRoot, FVector& OutTip) const
+    {
+        if (!bBladeSocketsResolved || !WeaponMesh) return false;
+
+        const FTransform& WeaponTransform = WeaponMesh->GetComponentTransform();
+        OutRoot = WeaponTransform.TransformPosition(LocalBladeRoot);
+        OutTip = WeaponTransform.TransformPosition(LocalBladeTip);
+        return true;
+    }
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Characters/Base/KNCharacterBase.h"
+#include "Characters/Player/KNCombatContext.h"
 #include "KNPlayerCharacter.generated.h"
 
 #pragma region 전방 선언
@@ -11,6 +12,8 @@ class USpringArmComponent;
 class UCameraComponent;
 class UKNStatsComponent;
 class UKNChronosSphereComponent;
+class UNiagaraComponent;
+class UNiagaraSystem;
 #pragma endregion 전방 선언
 
 /**
@@ -140,4 +143,62 @@ public:
     /** @brief 납도 콤보 노티파이에서 칼 메시 위치를 직접 제어하기 위한 Getter입니다. */
     FORCEINLINE UStaticMeshComponent* GetKatanaMesh() const { return KatanaMesh; }
 #pragma endregion 무기 시스템
+
+#pragma region 무기 궤적
+public:
+    /**
+     * @brief 칼날 두 소켓의 궤적 이펙트 방출을 시작합니다. (UKNAnimNotifyState_WeaponTrail에서 호출)
+     * @param TrailSystem 재생할 궤적 에셋 (nullptr이면 현재 에셋 유지, 다르면 교체)
+     * @param EnchantSize _EnchantSize Niagara 파라미터 값
+     */
+    void BeginWeaponTrail(UNiagaraSystem* TrailSystem, float EnchantSize);
+
+    /** @brief 궤적 방출을 멈춥니다. 남은 파티클은 자연스럽게 사그라듭니다. */
+    void EndWeaponTrail();
+
+protected:
+    /** @brief 기본 궤적 이펙트 (노티파이가 에셋을 지정하지 않으면 사용) */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Weapon|VFX")
+    TObjectPtr<UNiagaraSystem> WeaponTrailVFX = nullptr;
+
+    /** @brief 칼날 시작 소켓에 상시 부착된 궤적 컴포넌트 (생성·등록은 1회) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "KatanaNeon|Weapon|VFX")
+    TObjectPtr<UNiagaraComponent> TrailRootComponent = nullptr;
+
+    /** @brief 칼날 끝 소켓에 상시 부착된 궤적 컴포넌트 (생성·등록은 1회) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "KatanaNeon|Weapon|VFX")
+    TObjectPtr<UNiagaraComponent> TrailTipComponent = nullptr;
+#pragma endregion 무기 궤적
+
+#pragma region 전투 컨텍스트 캐시
+public:
+    /**
+     * @brief 어빌리티용 전투 컨텍스트 접근자입니다.
+     * @param Avatar 어빌리티의 아바타 액터
+     * @return 플레이어 캐릭터이면 캐시된 컨텍스트, 아니면 nullptr
+     */
+    static const FKNCombatContext* GetCombatContext(const AActor* Avatar);
+
+    /** @brief 캐시된 전투 컨텍스트를 반환합니다. */
+    FORCEINLINE const FKNCombatContext& GetCombatContext() const { return CombatContext; }
+
+protected:
+    /** @brief 칼날 시작 위치 소켓 이름 (카타나 메시 기준) */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Weapon")
+    FName BladeRootSocketName = TEXT("Socket_Blade_Root");
+
+    /** @brief 칼날 끝 위치 소켓 이름 (카타나 메시 기준) */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Weapon")
+    FName BladeTipSocketName = TEXT("Socket_Blade_Tip");
+
+private:
+    /**
+     * @brief 컴포넌트 포인터와 칼날 소켓 좌표를 다시 해석합니다.
+     * @details BeginPlay와 EquipWeapon/UnequipWeapon(무기 재부착) 시점에만 호출됩니다.
+     */
+    void RefreshCombatContext();
+
+    /** @brief 전투 어빌리티용 컴포넌트/소켓 캐시 */
+    FKNCombatContext CombatContext;
+#pragma endregion 전투 컨텍스트 캐시
 };
@@ -10,6 +10,7 @@
 #pragma region 전방 선언
 class UKNInputDataConfig;
 class UKNMainHUDWidget;
+class AKNCharacterBase;
 struct FInputActionValue;
 #pragma endregion 전방 선언
 
@@ -41,9 +42,16 @@ protected:
 
 #pragma region 내부 헬퍼 함수
 private:
+    /**
+     * @brief 현재 빙의 중인 KatanaNeon 캐릭터를 반환합니다.
+     * @return 빙의 캐릭터, 없거나 타입이 다르면 nullptr
+     */
+    AKNCharacterBase* GetControlledKNCharacter() const;
+
     /**
      * @brief GAS 어빌리티 실행 코드를 단일화한 헬퍼 함수 (리뷰 반영).
      * @details 중복 캐스팅과 컨테이너 생성 비용을 한 곳으로 모아 최적화했습니다.
+     *          어빌리티 레지스트리에 등록된 태그는 스펙 핸들로 직접 활성화합니다.
      * @param Tag 활성화하고자 하는 어빌리티의 네이티브 태그
      */
     void TryActivateAbilityByTag(const FGameplayTag& Tag);
@@ -4,14 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "Components/SphereComponent.h"
-#include "GameplayTagContainer.h"
+#include "Framework/System/KNTimeDilationSubsystem.h"
 #include "KNChronosSphereComponent.generated.h"
 
-#pragma region 전방 선언
-class UAbilitySystemComponent;
-class IAbilitySystemInterface;
-#pragma endregion 전방 선언
-
 /**
  * @file    KNChronosSphereComponent.h
  * @class   UKNChronosSphereComponent
@@ -19,11 +14,18 @@ class IAbilitySystemInterface;
  *
  * @details
  * [SRP 책임]
- * - "누가 구체 안에 있는가" 감지 및 CustomTimeDilation 적용/복구만 담당합니다.
+ * - "누가 구체 안에 있는가" 감지만 담당하며, 배율은 시간 서브시스템의 구체 레이어 멤버로 등록합니다.
+ *   (CustomTimeDilation 기록과 다른 레이어와의 합성·복구는 UKNTimeDilationSubsystem이 수행)
  * - 크로노스 게이지 소모(GE), 어빌리티 생애 주기는 KNAbility_Chronos에서 관리합니다.
  *
+ * [감지 방식]
+ * - bUseSpatialField(기본): 콜리전을 켜지 않고 시간 서브시스템의 필드 레이어로 등록합니다.
+ *   등록 시 분류된 액터를 공간 해시로 고정 주기 질의하므로 발사체가 경계를 자주 넘나들어도 비용이 늘지 않습니다.
+ *   소유자 진영의 반대 진영을 감속하므로 적에게 붙여도 동작합니다.
+ * - 오버랩 모드: 아래 콜리전 프로필과 오버랩 콜백으로 멤버를 갱신합니다. 필드 모드와 같이 반대 진영만 감속합니다.
+ *
  * [최적화 적용]
- * - FindComponentByClass(O(N)) 연산을 배제하고 IAbilitySystemInterface(O(1))로 대상을 식별합니다.
+ * - 전용 KNChronosField 오브젝트 채널에는 적 허트박스·발사체만 겹치므로, 대상은 컴포넌트 오브젝트 타입과 진영만으로 분류합니다.
  * - 오버랩 이벤트는 어빌리티가 활성화(ActivateSphere)될 때만 켜져 평시 틱 비용을 0으로 만듭니다.
  */
 UCLASS(ClassGroup = (KatanaNeon), meta = (BlueprintSpawnableComponent))
@@ -54,8 +56,8 @@ protected:
 public:
     /**
      * @brief 크로노스 구체를 활성화하고 현재 구체 내부 액터를 즉시 감속합니다.
-     * @param InEnemySlowScale       적 캐릭터에 적용할 CustomTimeDilation 배율
-     * @param InProjectileSlowScale  적 발사체에 적용할 CustomTimeDilation 배율
+     * @param InEnemySlowScale       상대 진영 캐릭터에 적용할 CustomTimeDilation 배율
+     * @param InProjectileSlowScale  상대 진영 발사체에 적용할 CustomTimeDilation 배율
      * @param InRadius               구체 반경 (cm)
      */
     void ActivateSphere(float InEnemySlowScale, float InProjectileSlowScale, float InRadius);
@@ -72,15 +74,12 @@ public:
     FORCEINLINE bool IsChronosActive() const { return bChronosActive; }
 #pragma endregion 외부 제어 인터페이스
 
-#pragma region 에디터 설정 데이터
+#pragma region 에디터 설정
 protected:
-    /**
-     * @brief 발사체 Actor를 식별하는 GameplayTag.
-     * @details KatanaNeon.Data.Actor.Projectile 태그를 기본값으로 사용합니다.
-     */
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "KatanaNeon|Chronos|Config")
-    FGameplayTag ProjectileTag;
-#pragma endregion 에디터 설정 데이터
+    /** @brief true이면 오버랩 콜백 대신 시간 서브시스템의 공간 해시 필드로 대상을 찾습니다. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "KatanaNeon|Chronos")
+    bool bUseSpatialField = true;
+#pragma endregion 에디터 설정
 
 #pragma region 런타임 상태
 private:
@@ -93,6 +92,9 @@ private:
      * @details TWeakObjectPtr 사용 — 파괴된 액터 참조 시 발생하는 크래시(Dangling Pointer) 방지.
      */
     TSet<TWeakObjectPtr<AActor>> SlowedActors;
+
+    /** @brief 활성화 중 시간 서브시스템에 등록한 구체(또는 필드) 레이어 */
+    FKNTimeLayerHandle SphereLayer;
 #pragma endregion 런타임 상태
 
 #pragma region 오버랩 콜백
@@ -117,23 +119,25 @@ private:
 #pragma region 내부 헬퍼 함수
 private:
     /**
-     * @brief 대상 Actor가 적 발사체인지 확인합니다. (최적화 적용)
+     * @brief 겹친 컴포넌트의 오브젝트 타입(KNProjectile / KNHurtbox)에 따라 소유 Actor를 감속합니다.
+     * @details 대상 진영(GetTargetTeam)이 아닌 액터는 건너뜁니다. (소유자의 참격파 등)
+     * @param OtherComp 구체와 겹친 컴포넌트
      */
-    bool IsProjectileActor(const AActor* Actor) const;
+    void TrySlowComponent(UPrimitiveComponent* OtherComp);
 
     /**
-     * @brief 대상 Actor가 적 캐릭터인지 확인합니다. (최적화 적용)
+     * @brief 대상 Actor를 구체 레이어 멤버로 등록하고 SlowedActors에 추가합니다.
      */
-    bool IsEnemyActor(const AActor* Actor) const;
+    void SetActorSlowScale(AActor* Actor, float Scale);
 
-    /**
-     * @brief 대상 Actor의 CustomTimeDilation을 설정합니다.
-     */
-    static void ApplyTimeDilationToActor(AActor* Actor, float Scale);
+    /** @brief 소유자 진영의 반대 진영 (필드·오버랩 감속 대상) */
+    EKNTimeTeam GetTargetTeam() const;
 
     /**
-     * @brief SlowedActors에서 이미 파괴된 약참조를 정리합니다.
+     * @brief 액터의 진영을 구합니다. 발사체는 Owner/Instigator 캐릭터의 진영을 따릅니다.
+     * @param Actor 구체와 겹친 액터
+     * @return 진영, 알 수 없으면 None
      */
-    void PurgeInvalidActors();
+    static EKNTimeTeam ResolveActorTeam(const AActor* Actor);
 #pragma endregion 내부 헬퍼 함수
 };
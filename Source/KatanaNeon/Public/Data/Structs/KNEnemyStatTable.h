@@ -39,6 +39,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "KatanaNeon|Enemy|Stat")
     float AttackRange = 200.0f;
 
+    /** @brief 근접 공격 1회당 기본 데미지 (UKNDamageEffect의 Damage.Base) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "KatanaNeon|Enemy|Stat")
+    float AttackDamage = 10.0f;
+
     /**
      * @brief 공격 예고(저스트 회피 판정) 윈도우 지속 시간 (초).
      * @details 이 시간 안에 플레이어가 대시하면 FlurryRush가 발동됩니다.
@@ -68,6 +72,17 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "KatanaNeon|Enemy|Ranged")
     float ProjectileLifeSpan = 5.0f;
 
+    /** @brief 발사체 충돌 반경 — 관리형 발사체의 구체 스윕 크기 (cm) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "KatanaNeon|Enemy|Ranged")
+    float ProjectileCollisionRadius = 15.0f;
+
+    /**
+     * @brief 발사체 액터 풀 워밍업 개수.
+     * @details 액터 경로(bUseProjectileManager 끔)에서 BeginPlay 시 미리 스폰합니다. KN.Pool.Stats의 최대 사용량을 기준으로 조정합니다.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "KatanaNeon|Enemy|Ranged", meta = (ClampMin = 0))
+    int32 ProjectilePoolSize = 4;
+
     /** @brief 최소 교전 거리 — 이 거리 안으로 들어오면 플레이어로부터 후퇴합니다 (cm) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "KatanaNeon|Enemy|Ranged")
     float MinEngagementRange = 600.0f;
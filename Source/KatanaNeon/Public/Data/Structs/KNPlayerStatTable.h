@@ -423,6 +423,11 @@ public:
     /** @brief 전투 이탈 상태일 때 초당 게이지 감소량 (지속 공격 유도 장치) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "KatanaNeon|Stats|Overclock|Decay")
     float OverclockDecayRate = 5.0f;
+
+    /** @brief 마지막 획득/소모 이후 전투 이탈로 판정하여 감소를 시작하기까지의 유예 시간 (초) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "KatanaNeon|Stats|Overclock|Decay",
+        meta = (ClampMin = 0.0f))
+    float OverclockDecayDelay = 5.0f;
 };
 #pragma endregion 오버클럭 게이지 설정 테이블
 
@@ -473,15 +478,15 @@ public:
 
     /**
      * @brief 크로노스 게이지 초당 소모량.
-     * @details 매 DrainTickInterval마다 (DrainRatePerSecond × DrainTickInterval)만큼 소모됩니다.
+     * @details 활성화 시점부터 해석적으로 소모되며, 잔량 / 소모량 시점에 자동 종료됩니다.
      */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "KatanaNeon|Chronos",
         meta = (ClampMin = 1.0f))
     float DrainRatePerSecond = 20.0f;
 
     /**
-     * @brief 크로노스 소모 GE 적용 주기 (초).
-     * @details 0.1초 권장. 너무 짧으면 GE 호출 빈도가 높아져 퍼포먼스에 영향을 줍니다.
+     * @brief (미사용) 구 주기 소모 방식의 GE 적용 주기 (초).
+     * @details 소모가 해석적 모델로 바뀌어 더 이상 읽지 않습니다. 기존 DataTable 에셋 호환을 위해 남겨 둡니다.
      */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "KatanaNeon|Chronos",
         meta = (ClampMin = 0.05f, ClampMax = 1.0f))
@@ -618,6 +623,14 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "KatanaNeon|Overclock|Lv2",
         meta = (ClampMin = 1.0f))
     float OverclockCost = 200.0f;
+
+    /**
+     * @brief 참격파 액터 풀 워밍업 개수.
+     * @details 액터 경로(bUseProjectileManager 끔)에서 어빌리티 부여 시 미리 스폰합니다. KN.Pool.Stats의 최대 사용량을 기준으로 조정합니다.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "KatanaNeon|Overclock|Lv2",
+        meta = (ClampMin = 0, ClampMax = 32))
+    int32 SlashPoolSize = 2;
 };
 #pragma endregion 오버클럭 2단계 어빌리티 설정 테이블
 
@@ -647,7 +660,7 @@ struct KATANANEON_API FKNOverclockLv3Row : public FTableRowBase
 public:
     /**
      * @brief 시간 정지 지속 시간 (실월드 초 기준).
-     * @details FTimerManager 기준이므로 GlobalTimeDilation과 무관하게 실시간으로 카운트됩니다.
+     * @details UKNTimeDilationSubsystem의 실시간 시계 기준이므로 GlobalTimeDilation과 무관하게 카운트됩니다.
      */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "KatanaNeon|Overclock|Lv3",
         meta = (ClampMin = 1.0f, ClampMax = 30.0f))
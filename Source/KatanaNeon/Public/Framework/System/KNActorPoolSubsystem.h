@@ -0,0 +1,209 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "KNActorPoolSubsystem.generated.h"
+
+#pragma region 전방 선언
+class AActor;
+class APawn;
+#pragma endregion 전방 선언
+
+#pragma region 액터 풀 설정 및 통계
+/**
+ * @struct FKNActorPoolPrewarmEntry
+ * @brief  레벨 로드 시 미리 만들어 둘 풀 액터 클래스와 개수입니다. (DefaultGame.ini)
+ */
+USTRUCT()
+struct FKNActorPoolPrewarmEntry
+{
+    GENERATED_BODY()
+
+    /** @brief IKNPooledActor를 구현한 액터 클래스 */
+    UPROPERTY()
+    TSoftClassPtr<AActor> ActorClass;
+
+    /** @brief 대기 목록 목표 개수 */
+    UPROPERTY()
+    int32 Count = 0;
+};
+
+/**
+ * @struct FKNActorPoolStats
+ * @brief  전체 풀 재사용 카운터입니다. (KN.Pool.Stats로 출력)
+ */
+struct FKNActorPoolStats
+{
+    /** @brief 대기 목록에서 재사용한 획득 수 */
+    int32 PoolHits = 0;
+
+    /** @brief 대기 목록이 비어 새로 스폰한 획득 수 */
+    int32 PoolMisses = 0;
+
+    /** @brief 미리 만든 액터 수 */
+    int32 Prewarmed = 0;
+
+    /** @brief 반납 수 */
+    int32 Releases = 0;
+
+    /** @brief 대기 목록 상한 초과로 파괴한 반납 수 */
+    int32 OverflowDestroyed = 0;
+};
+
+/**
+ * @struct FKNActorPoolBucket
+ * @brief  액터 클래스 하나에 대한 대기/사용 중 목록입니다.
+ */
+USTRUCT()
+struct FKNActorPoolBucket
+{
+    GENERATED_BODY()
+
+    /** @brief 비활성화되어 재사용을 기다리는 액터 */
+    UPROPERTY()
+    TArray<TObjectPtr<AActor>> Free;
+
+    /** @brief 현재 사용 중인 액터 */
+    UPROPERTY()
+    TArray<TObjectPtr<AActor>> InUse;
+
+    /** @brief 동시 사용 최대치 (풀 크기 튜닝용 high-water mark) */
+    int32 PeakInUse = 0;
+
+    /** @brief 이 클래스에서 대기 목록이 비어 새로 스폰한 횟수 */
+    int32 Misses = 0;
+};
+#pragma endregion 액터 풀 설정 및 통계
+
+/**
+ * @file    KNActorPoolSubsystem.h
+ * @class   UKNActorPoolSubsystem
+ * @brief   발사체 등 짧게 살다 사라지는 액터를 클래스별 풀에서 재사용하는 월드 서브시스템입니다.
+ *
+ * @details
+ * [수명주기] (SpawnActorDeferred / FinishSpawning과 같은 2단계)
+ * 1. AcquireDeferred: 대기 액터를 꺼내 트랜스폼·Owner·Instigator를 적용합니다. (아직 숨김·충돌 없음)
+ * 2. 호출자가 발사 데이터를 주입합니다.
+ * 3. FinishAcquire: 숨김·충돌·액터 틱을 되돌리고 IKNPooledActor::OnAcquiredFromPool을 호출합니다.
+ * 4. ReleaseActor: OnReleasedToPool 호출 후 숨김·충돌 해제·틱 정지·LifeSpan 해제, 대기 목록으로 이동합니다.
+ *
+ * [풀 대상]
+ * - IKNPooledActor를 구현한 클래스만 풀링합니다. 그 외 클래스는 AcquireDeferred가 nullptr을 반환하므로 호출자가 일반 스폰합니다.
+ * - 새 액터는 풀 안에서 스폰·BeginPlay를 마친 뒤 바로 비활성화되어, 재사용과 같은 경로로 활성화됩니다.
+ * - 워밍업: PrewarmClasses(DefaultGame.ini)는 OnWorldBeginPlay에서, 발사 주체는 DataTable 풀 크기로 Prewarm합니다.
+ * - 반납된 액터는 시간 레이어 진영 등록에서도 빠집니다.
+ */
+UCLASS(Config = Game)
+class KATANANEON_API UKNActorPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+#pragma region 서브시스템 생명주기
+public:
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+#pragma endregion 서브시스템 생명주기
+
+#pragma region 풀 인터페이스
+public:
+    /**
+     * @brief 월드 컨텍스트에서 액터 풀을 찾습니다.
+     * @param WorldContextObject 월드를 가진 오브젝트
+     * @return 서브시스템, 지원하지 않는 월드면 nullptr
+     */
+    static UKNActorPoolSubsystem* Get(const UObject* WorldContextObject);
+
+    /**
+     * @brief 풀 액터를 반납합니다. 풀이 관리하지 않는 액터(풀 없는 월드 포함)는 Destroy합니다.
+     * @param Actor 반납할 액터 (Destroy 대신 호출)
+     */
+    UFUNCTION(BlueprintCallable, Category = "KatanaNeon|Pool")
+    static void ReleaseActor(AActor* Actor);
+
+    /**
+     * @brief 클래스에 맞는 대기 액터를 꺼냅니다. 활성화는 FinishAcquire에서 이루어집니다.
+     * @param ActorClass IKNPooledActor를 구현한 액터 클래스
+     * @param Transform  배치할 월드 트랜스폼
+     * @param Owner      소유 액터
+     * @param Instigator 가해자 폰
+     * @return 비활성 상태의 액터, 풀링 대상이 아니면 nullptr
+     */
+    AActor* AcquireDeferred(UClass* ActorClass, const FTransform& Transform, AActor* Owner = nullptr, APawn* Instigator = nullptr);
+
+    /** @brief AcquireDeferred의 형 변환 버전 */
+    template<typename T>
+    T* AcquireDeferred(TSubclassOf<T> ActorClass, const FTransform& Transform, AActor* Owner = nullptr, APawn* Instigator = nullptr)
+    {
+        return Cast<T>(AcquireDeferred(ActorClass.Get(), Transform, Owner, Instigator));
+    }
+
+    /**
+     * @brief AcquireDeferred로 꺼낸 액터를 활성화하고 OnAcquiredFromPool을 호출합니다.
+     * @param Actor AcquireDeferred가 반환한 액터
+     */
+    void FinishAcquire(AActor* Actor);
+
+    /**
+     * @brief 풀 액터를 반납합니다.
+     * @param Actor 이 풀이 관리하는 사용 중 액터
+     * @return 이 풀의 사용 중 액터가 아니면 false
+     */
+    bool Release(AActor* Actor);
+
+    /**
+     * @brief 대기 액터를 Count개까지 미리 만들어 둡니다.
+     * @param ActorClass IKNPooledActor를 구현한 액터 클래스
+     * @param Count      대기 목록 목표 개수 (MaxFreePerClass로 제한)
+     */
+    void Prewarm(UClass* ActorClass, int32 Count);
+
+    /**
+     * @brief 클래스가 풀링 대상(IKNPooledActor 구현)인지 확인합니다.
+     * @param ActorClass 확인할 액터 클래스
+     */
+    static bool IsPoolable(const UClass* ActorClass);
+
+    /** @brief 풀 통계 */
+    const FKNActorPoolStats& GetStats() const { return Stats; }
+
+    /** @brief 통계를 0으로 되돌리고, 클래스별 최대 사용량을 현재 사용량으로 맞춥니다. */
+    void ResetStats();
+
+    /** @brief 클래스별 풀 (통계 출력용) */
+    const TMap<TObjectPtr<UClass>, FKNActorPoolBucket>& GetPools() const { return Pools; }
+#pragma endregion 풀 인터페이스
+
+#pragma region 설정 (DefaultGame.ini)
+protected:
+    /** @brief 클래스별 대기 목록 최대 크기 (초과 반납은 파괴) */
+    UPROPERTY(Config)
+    int32 MaxFreePerClass = 32;
+
+    /** @brief 레벨 로드 시 워밍업할 클래스 목록 */
+    UPROPERTY(Config)
+    TArray<FKNActorPoolPrewarmEntry> PrewarmClasses;
+#pragma endregion 설정
+
+#pragma region 내부 헬퍼 함수
+private:
+    /** @brief 풀 안에서 액터를 스폰하고 곧바로 비활성화합니다. */
+    AActor* SpawnPooledActor(UClass* ActorClass, const FTransform& Transform);
+
+    /** @brief 숨김·충돌 해제·틱 정지·LifeSpan 해제로 액터를 대기 상태로 만듭니다. */
+    static void DeactivateActor(AActor* Actor);
+#pragma endregion 내부 헬퍼 함수
+
+#pragma region 런타임 상태
+private:
+    /** @brief 액터 클래스 → 풀 */
+    UPROPERTY(Transient)
+    TMap<TObjectPtr<UClass>, FKNActorPoolBucket> Pools;
+
+    FKNActorPoolStats Stats;
+#pragma endregion 런타임 상태
+};
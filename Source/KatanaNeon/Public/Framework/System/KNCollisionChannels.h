@@ -0,0 +1,59 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+/**
+ * @file    KNCollisionChannels.h
+ * @brief   프로젝트 전용 콜리전 채널과 프로필 이름을 한곳에 모은 상수 모음입니다.
+ *
+ * @details
+ * 채널 번호와 응답 매트릭스는 Config/DefaultEngine.ini의 [/Script/Engine.CollisionProfile]에 정의되어 있습니다.
+ * 새 채널은 모두 기본 응답이 Ignore이므로, 엔진 기본 프로필(Pawn, BlockAll 등)은 블레이드/발사체 쿼리에 걸리지 않습니다.
+ *
+ * [응답 매트릭스]
+ * | 프로필            | 오브젝트 타입   | KNPlayerAttack | KNEnemyAttack | KNProjectile | KNChronosField | WorldDynamic |
+ * |-------------------|-----------------|----------------|---------------|--------------|----------------|--------------|
+ * | KNPlayerHurtbox   | KNHurtbox       | Ignore         | Overlap       | Ignore       | Ignore         | Ignore       |
+ * | KNEnemyHurtbox    | KNHurtbox       | Overlap        | Ignore        | Block        | Overlap        | Ignore       |
+ * | KNProjectile      | KNProjectile    | Ignore         | Ignore        | Ignore       | Overlap        | Overlap      |
+ * | KNChronosField    | KNChronosField  | Ignore         | Ignore        | Overlap      | Ignore         | Ignore       |
+ *
+ * 따라서 블레이드 스윕은 적 허트박스만, 적 근접 판정은 플레이어 허트박스만 브로드페이즈에서 돌려받으며,
+ * C++ 쪽에서 컴포넌트 탐색이나 진영 필터 루프를 돌 필요가 없습니다.
+ * 사망한 캐릭터는 허트박스 콜리전이 꺼지므로 쿼리 결과에서 자동으로 빠집니다.
+ * 적 허트박스는 오버랩 이벤트를 켜 두지만 겹치는 상대가 크로노스 필드뿐이므로, 이동 시 오버랩 갱신이 지형·소품과 짝지어지지 않습니다.
+ */
+namespace KatanaNeon::Collision
+{
+#pragma region 오브젝트 채널
+    /** @brief 캐릭터 피격 판정 전용 오브젝트 채널 (캡슐과 분리된 허트박스) */
+    inline constexpr ECollisionChannel Hurtbox = ECC_GameTraceChannel1;
+
+    /** @brief 발사체 오브젝트 채널 (참격파, 적 탄환) */
+    inline constexpr ECollisionChannel Projectile = ECC_GameTraceChannel2;
+
+    /** @brief 크로노스 감속 구체 오브젝트 채널 (적 허트박스·발사체만 겹침) */
+    inline constexpr ECollisionChannel ChronosField = ECC_GameTraceChannel5;
+#pragma endregion 오브젝트 채널
+
+#pragma region 트레이스 채널
+    /** @brief 플레이어 공격(블레이드 스윕) 쿼리 채널 — 적 허트박스만 응답합니다. */
+    inline constexpr ECollisionChannel PlayerAttack = ECC_GameTraceChannel3;
+
+    /** @brief 적 공격(근접 오버랩) 쿼리 채널 — 플레이어 허트박스만 응답합니다. */
+    inline constexpr ECollisionChannel EnemyAttack = ECC_GameTraceChannel4;
+#pragma endregion 트레이스 채널
+
+#pragma region 콜리전 프로필
+    namespace Profile
+    {
+        inline const FName PlayerHurtbox(TEXT("KNPlayerHurtbox"));
+        inline const FName EnemyHurtbox(TEXT("KNEnemyHurtbox"));
+        inline const FName Projectile(TEXT("KNProjectile"));
+        inline const FName ChronosField(TEXT("KNChronosField"));
+    }
+#pragma endregion 콜리전 프로필
+}
@@ -0,0 +1,201 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "KNCombatVFXSubsystem.generated.h"
+
+#pragma region 전방 선언
+class UNiagaraSystem;
+class UNiagaraComponent;
+#pragma endregion 전방 선언
+
+#pragma region VFX 우선순위
+/**
+ * @enum  EKNVFXPriority
+ * @brief 스폰 예산과 거리 컬링의 적용 여부를 결정하는 VFX 중요도입니다.
+ */
+enum class EKNVFXPriority : uint8
+{
+    /** @brief 적중 스파크 등 — 예산 초과 또는 컬링 거리 밖이면 생략됩니다. */
+    Cosmetic,
+
+    /** @brief 궁극기·참격파 등 게임플레이 피드백 — 항상 스폰되며 예산만 소모합니다. */
+    Essential,
+};
+#pragma endregion VFX 우선순위
+
+#pragma region VFX 풀 통계
+/**
+ * @struct FKNCombatVFXStats
+ * @brief  풀 재사용과 스폰 생략 카운터입니다. (KN.VFX.PoolStats로 출력)
+ */
+struct FKNCombatVFXStats
+{
+    /** @brief 풀에서 재사용한 스폰 수 */
+    int32 PoolHits = 0;
+
+    /** @brief 풀이 비어 새 컴포넌트를 만든 스폰 수 */
+    int32 PoolMisses = 0;
+
+    /** @brief 레벨 로드 시 미리 만든 컴포넌트 수 */
+    int32 Prewarmed = 0;
+
+    /** @brief 카메라 거리로 컬링된 스폰 수 */
+    int32 DistanceCulled = 0;
+
+    /** @brief 프레임 예산 초과로 생략된 스폰 수 */
+    int32 BudgetCulled = 0;
+
+    /** @brief 동시 재생 최대치 */
+    int32 PeakActive = 0;
+};
+
+/**
+ * @struct FKNVFXPoolBucket
+ * @brief  Niagara 시스템 에셋 하나에 대한 대기/재생 중 컴포넌트 목록입니다.
+ */
+USTRUCT()
+struct FKNVFXPoolBucket
+{
+    GENERATED_BODY()
+
+    /** @brief 재생이 끝나 재사용을 기다리는 컴포넌트 */
+    UPROPERTY()
+    TArray<TObjectPtr<UNiagaraComponent>> Free;
+
+    /** @brief 현재 재생 중인 컴포넌트 */
+    UPROPERTY()
+    TArray<TObjectPtr<UNiagaraComponent>> Active;
+};
+#pragma endregion VFX 풀 통계
+
+/**
+ * @file    KNCombatVFXSubsystem.h
+ * @class   UKNCombatVFXSubsystem
+ * @brief   전투 Niagara 이펙트를 에셋별 풀에서 재사용하고, 프레임 예산과 거리 컬링을 적용하는 월드 서브시스템입니다.
+ *
+ * @details
+ * [풀링]
+ * - 컴포넌트는 월드에 등록된 채로 보관되며, 재생 종료(OnSystemFinished) 시 대기 목록으로 돌아갑니다.
+ * - 대기 목록이 MaxFreePerSystem을 넘으면 남는 컴포넌트는 파괴합니다.
+ * - 워밍업: WarmupSystems(DefaultGame.ini)는 OnWorldBeginPlay에서, 어빌리티 에셋은 OnGiveAbility에서 Prewarm됩니다.
+ *
+ * [생략 규칙]
+ * - Cosmetic 스폰은 카메라로부터 CullDistance 밖이거나 이번 프레임 스폰 수가 SpawnBudgetPerFrame에 도달하면 생략됩니다.
+ * - Essential 스폰은 생략되지 않으며 예산만 소모합니다.
+ *
+ * 루프 시스템은 스스로 끝나지 않으므로 이 서비스로 스폰하지 않습니다.
+ */
+UCLASS(Config = Game)
+class KATANANEON_API UKNCombatVFXSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+#pragma region 서브시스템 생명주기
+public:
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+#pragma endregion 서브시스템 생명주기
+
+#pragma region VFX 스폰 인터페이스
+public:
+    /**
+     * @brief 월드 컨텍스트에서 VFX 서비스를 찾습니다.
+     * @param WorldContextObject 월드를 가진 오브젝트
+     * @return 서브시스템, 지원하지 않는 월드면 nullptr
+     */
+    static UKNCombatVFXSubsystem* Get(const UObject* WorldContextObject);
+
+    /**
+     * @brief 풀에서 컴포넌트를 꺼내 지정 위치에서 재생합니다.
+     * @param System   Niagara 시스템 에셋
+     * @param Location 월드 위치
+     * @param Rotation 월드 회전
+     * @param Priority 예산/컬링 적용 여부
+     * @return 재생 중인 컴포넌트, 생략되었으면 nullptr (재생 종료 후 재사용되므로 보관하지 마십시오)
+     */
+    UNiagaraComponent* SpawnAtLocation(
+        UNiagaraSystem* System,
+        const FVector& Location,
+        const FRotator& Rotation = FRotator::ZeroRotator,
+        EKNVFXPriority Priority = EKNVFXPriority::Cosmetic);
+
+    /**
+     * @brief 풀에 대기 컴포넌트를 Count개까지 미리 만들어 둡니다.
+     * @param System Niagara 시스템 에셋
+     * @param Count  대기 목록 목표 개수 (0 이하이면 PrewarmCount)
+     */
+    void Prewarm(UNiagaraSystem* System, int32 Count = 0);
+
+    /** @brief 풀 통계 */
+    const FKNCombatVFXStats& GetStats() const { return Stats; }
+
+    /** @brief 통계를 0으로 되돌립니다. */
+    void ResetStats() { Stats = FKNCombatVFXStats(); }
+
+    /** @brief 현재 재생 중인 풀 컴포넌트 수 */
+    int32 GetNumActive() const;
+
+    /** @brief 현재 대기 중인 풀 컴포넌트 수 */
+    int32 GetNumFree() const;
+#pragma endregion VFX 스폰 인터페이스
+
+#pragma region 설정 (DefaultGame.ini)
+protected:
+    /** @brief 프레임당 최대 스폰 수 (Essential 포함 집계, Cosmetic만 생략) */
+    UPROPERTY(Config)
+    int32 SpawnBudgetPerFrame = 8;
+
+    /** @brief Cosmetic 스폰을 생략하는 카메라 거리 (cm, 0 이하이면 컬링 안 함) */
+    UPROPERTY(Config)
+    float CullDistance = 6000.0f;
+
+    /** @brief Prewarm 기본 개수 */
+    UPROPERTY(Config)
+    int32 PrewarmCount = 4;
+
+    /** @brief 에셋별 대기 목록 최대 크기 */
+    UPROPERTY(Config)
+    int32 MaxFreePerSystem = 16;
+
+    /** @brief 레벨 로드 시 워밍업할 시스템 목록 */
+    UPROPERTY(Config)
+    TArray<TSoftObjectPtr<UNiagaraSystem>> WarmupSystems;
+#pragma endregion 설정
+
+#pragma region 내부 헬퍼 함수
+private:
+    /** @brief 월드에 등록된 비활성 풀 컴포넌트를 새로 만듭니다. */
+    UNiagaraComponent* CreatePooledComponent(UNiagaraSystem* System);
+
+    /** @brief 카메라로부터 CullDistance 밖인지 확인합니다. */
+    bool IsBeyondCullDistance(const FVector& Location) const;
+
+    /** @brief 이번 프레임 스폰 예산이 남았는지 확인합니다. (프레임이 바뀌면 카운터 초기화) */
+    bool HasSpawnBudget();
+
+    /** @brief 재생이 끝난 컴포넌트를 대기 목록으로 되돌립니다. */
+    UFUNCTION()
+    void OnPooledSystemFinished(UNiagaraComponent* FinishedComponent);
+#pragma endregion 내부 헬퍼 함수
+
+#pragma region 런타임 상태
+private:
+    /** @brief Niagara 시스템 → 풀 */
+    UPROPERTY(Transient)
+    TMap<TObjectPtr<UNiagaraSystem>, FKNVFXPoolBucket> Pools;
+
+    /** @brief 스폰 예산을 집계 중인 프레임 번호 */
+    uint64 BudgetFrame = 0;
+
+    /** @brief BudgetFrame에 소모한 스폰 수 */
+    int32 SpawnsThisFrame = 0;
+
+    FKNCombatVFXStats Stats;
+#pragma endregion 런타임 상태
+};
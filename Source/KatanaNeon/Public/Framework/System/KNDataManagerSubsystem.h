@@ -4,27 +4,30 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Framework/System/KNDataRowCache.h"
+#include "Data/Structs/KNPlayerStatTable.h"
+#include "Data/Structs/KNEnemyStatTable.h"
+#include <atomic>
 #include "KNDataManagerSubsystem.generated.h"
 
 #pragma region 전방 선언
-struct FKNBaseStatRow;
-struct FKNActionCostRow;
-struct FKNJumpSettingRow;
-struct FKNComboAttackRow;
-struct FKNOverclockSettingRow;
-struct FKNOverclockLv1Row;
-struct FKNOverclockLv2Row;
-struct FKNOverclockLv3Row;
-struct FKNChronosSettingRow;
-struct FKNEnemyBaseStatRow;
-struct FKNEnemyRangedStatRow;
-struct FKNBossPhaseRow;
+class UKNGameInstance;
 #pragma endregion 전방 선언
 
 /**
  * @file    KNDataManagerSubsystem.h
  * @class   UKNDataManagerSubsystem
  * @brief   KatanaNeon 프로젝트의 모든 데이터 테이블 조회를 담당하는 전역 매니저입니다.
+ *
+ * @details
+ * [평탄화 캐시]
+ * Initialize 시 13종 마스터 테이블을 각각 TKNDataRowCache(연속 배열)로 1회 복사합니다.
+ * - 콜드 패스: GetXxxCache().FindId(Name) 으로 정수 핸들을 얻어 보관합니다.
+ * - 핫 패스  : GetXxxCache().Get(Id) / GetDefault() 로 해시 조회 없이 배열 인덱싱만 합니다.
+ * - 에디터 행 핸들(FDataTableRowHandle)을 쓰는 어빌리티는 OnGiveAbility에서 TKNDataRowBinding으로 1회 해석합니다.
+ * - 기존 FName 기반 Getter는 캐시의 이름 표를 통해 동일한 행 포인터를 반환합니다. (콜드 패스 호환용)
+ * 캐시는 Initialize 이후 Deinitialize 전까지 변경되지 않으므로 IsDataReady()가 true인 동안
+ * 워커 스레드에서도 const 참조로 안전하게 읽을 수 있습니다.
  */
 UCLASS()
 class KATANANEON_API UKNDataManagerSubsystem : public UGameInstanceSubsystem
@@ -37,6 +40,41 @@ public:
     virtual void Deinitialize() override;
 #pragma endregion 서브시스템 생명주기
 
+#pragma region 평탄화 캐시 접근 인터페이스
+public:
+    /**
+     * @brief 월드 컨텍스트의 게임 인스턴스에서 데이터 매니저를 찾습니다.
+     * @param WorldContextObject 월드를 가진 오브젝트
+     * @return 서브시스템, 게임 인스턴스가 없으면 nullptr
+     */
+    static UKNDataManagerSubsystem* Get(const UObject* WorldContextObject);
+
+    /**
+     * @brief 캐시 적재가 끝나 읽기 가능한 상태인지 반환합니다. (스레드 안전)
+     * @return 모든 테이블 캐시가 게시(publish)되었으면 true
+     */
+    bool IsDataReady() const { return bDataReady.load(std::memory_order_acquire); }
+
+    // ── 플레이어 데이터 캐시 ──
+    const TKNDataRowCache<FKNBaseStatRow>& GetPlayerBaseStatCache() const { return PlayerBaseStatCache; }
+    const TKNDataRowCache<FKNActionCostRow>& GetActionCostCache() const { return ActionCostCache; }
+    const TKNDataRowCache<FKNJumpSettingRow>& GetJumpSettingCache() const { return JumpSettingCache; }
+    const TKNDataRowCache<FKNComboAttackRow>& GetDrawnComboAttackCache() const { return DrawnComboAttackCache; }
+    const TKNDataRowCache<FKNComboAttackRow>& GetSheathComboAttackCache() const { return SheathComboAttackCache; }
+
+    // ── 시스템(오버클럭, 크로노스) 데이터 캐시 ──
+    const TKNDataRowCache<FKNOverclockSettingRow>& GetOverclockSettingCache() const { return OverclockSettingCache; }
+    const TKNDataRowCache<FKNOverclockLv1Row>& GetOverclockLv1Cache() const { return OverclockLv1Cache; }
+    const TKNDataRowCache<FKNOverclockLv2Row>& GetOverclockLv2Cache() const { return OverclockLv2Cache; }
+    const TKNDataRowCache<FKNOverclockLv3Row>& GetOverclockLv3Cache() const { return OverclockLv3Cache; }
+    const TKNDataRowCache<FKNChronosSettingRow>& GetChronosSettingCache() const { return ChronosSettingCache; }
+
+    // ── 적 및 보스 데이터 캐시 ──
+    const TKNDataRowCache<FKNEnemyBaseStatRow>& GetEnemyStatCache() const { return EnemyStatCache; }
+    const TKNDataRowCache<FKNEnemyRangedStatRow>& GetEnemyRangedStatCache() const { return EnemyRangedStatCache; }
+    const TKNDataRowCache<FKNBossPhaseRow>& GetBossPhaseCache() const { return BossPhaseCache; }
+#pragma endregion 평탄화 캐시 접근 인터페이스
+
 #pragma region 글로벌 데이터 조회 인터페이스
 public:
     // ── 플레이어 데이터 조회 ──
@@ -63,4 +101,105 @@ public:
      */
     const FKNBossPhaseRow* GetBossPhase(const FName& RowName) const;
 #pragma endregion 글로벌 데이터 조회 인터페이스
+
+#pragma region 내부 헬퍼 함수
+private:
+    /**
+     * @brief 게임 인스턴스에 할당된 모든 테이블을 캐시로 평탄화합니다.
+     * @param GI 테이블을 보유한 게임 인스턴스
+     */
+    void BuildCaches(const UKNGameInstance* GI);
+
+    /** @brief 모든 캐시를 비우고 준비 플래그를 내립니다. */
+    void ResetCaches();
+#pragma endregion 내부 헬퍼 함수
+
+#pragma region 평탄화 캐시 데이터
+private:
+    TKNDataRowCache<FKNBaseStatRow> PlayerBaseStatCache;
+    TKNDataRowCache<FKNActionCostRow> ActionCostCache;
+    TKNDataRowCache<FKNJumpSettingRow> JumpSettingCache;
+    TKNDataRowCache<FKNComboAttackRow> DrawnComboAttackCache;
+    TKNDataRowCache<FKNComboAttackRow> SheathComboAttackCache;
+    TKNDataRowCache<FKNOverclockSettingRow> OverclockSettingCache;
+    TKNDataRowCache<FKNOverclockLv1Row> OverclockLv1Cache;
+    TKNDataRowCache<FKNOverclockLv2Row> OverclockLv2Cache;
+    TKNDataRowCache<FKNOverclockLv3Row> OverclockLv3Cache;
+    TKNDataRowCache<FKNChronosSettingRow> ChronosSettingCache;
+    TKNDataRowCache<FKNEnemyBaseStatRow> EnemyStatCache;
+    TKNDataRowCache<FKNEnemyRangedStatRow> EnemyRangedStatCache;
+    TKNDataRowCache<FKNBossPhaseRow> BossPhaseCache;
+
+    /** @brief 캐시 게시 플래그 (release 저장 / acquire 로드로 워커 스레드 가시성 보장) */
+    std::atomic<bool> bDataReady{ false };
+#pragma endregion 평탄화 캐시 데이터
+};
+
+#pragma region 행 핸들 바인딩
+/**
+ * @class  TKNDataRowBinding
+ * @brief  에디터에서 지정한 FDataTableRowHandle을 평탄화 캐시의 정수 핸들로 1회 해석해 두는 바인딩입니다.
+ *
+ * @details
+ * - Bind  : OnGiveAbility 등 콜드 패스에서 1회 호출합니다. (이름 해시 조회는 여기서만 발생)
+ * - Get   : 바인딩되어 있으면 배열 인덱싱만 하고, 아니면(CDO, 마스터 테이블이 아닌 테이블 지정 등) 원본 핸들의 GetRow로 조회합니다.
+ * 데이터 매니저는 약참조로 보관하므로 게임 인스턴스 종료 이후에는 자동으로 원본 핸들 경로로 돌아갑니다.
+ */
+template <typename RowT>
+class TKNDataRowBinding
+{
+public:
+    /** @brief 데이터 매니저의 캐시 접근자 (예: &UKNDataManagerSubsystem::GetActionCostCache) */
+    using FCacheGetter = const TKNDataRowCache<RowT>& (UKNDataManagerSubsystem::*)() const;
+
+    /**
+     * @brief 행 핸들을 캐시 정수 핸들로 해석합니다.
+     * @param WorldContextObject 게임 인스턴스를 찾을 오브젝트
+     * @param InCacheGetter      행 타입에 맞는 캐시 접근자
+     * @param Handle             에디터에서 지정한 행 핸들
+     * @return 캐시로 바인딩되었으면 true
+     */
+    bool Bind(const UObject* WorldContextObject, FCacheGetter InCacheGetter, const FDataTableRowHandle& Handle)
+    {
+        Reset();
+
+        const UKNDataManagerSubsystem* DataManager = UKNDataManagerSubsystem::Get(WorldContextObject);
+        if (!DataManager || !DataManager->IsDataReady() || !InCacheGetter) return false;
+
+        Id = (DataManager->*InCacheGetter)().FindId(Handle);
+        if (!Id.IsValid()) return false;
+
+        Manager = DataManager;
+        CacheGetter = InCacheGetter;
+        return true;
+    }
+
+    /** @brief 바인딩을 해제합니다. */
+    void Reset()
+    {
+        Manager.Reset();
+        CacheGetter = nullptr;
+        Id = TKNDataRowId<RowT>();
+    }
+
+    /**
+     * @brief 행을 조회합니다. (핫 패스)
+     * @param Handle        바인딩되지 않았을 때 사용할 원본 행 핸들 (Bind에 넘긴 것과 같은 핸들)
+     * @param ContextString GetRow 실패 로그용 문맥
+     * @return 행 포인터, 없으면 nullptr
+     */
+    const RowT* Get(const FDataTableRowHandle& Handle, const TCHAR* ContextString) const
+    {
+        if (const UKNDataManagerSubsystem* DataManager = Manager.Get())
+        {
+            return (DataManager->*CacheGetter)().Get(Id);
+        }
+        return Handle.GetRow<RowT>(ContextString);
+    }
+
+private:
+    TWeakObjectPtr<const UKNDataManagerSubsystem> Manager;
+    FCacheGetter CacheGetter = nullptr;
+    TKNDataRowId<RowT> Id;
 };
+#pragma endregion 행 핸들 바인딩
@@ -0,0 +1,177 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+
+/**
+ * @file    KNDataRowCache.h
+ * @brief   데이터 테이블 1개를 연속 배열로 평탄화한 읽기 전용 캐시와 정수 행 핸들입니다.
+ * @details UDataTable::FindRow는 호출마다 FName 해시 조회와 구조체 타입 검사를 수행합니다.
+ * 이 캐시는 서브시스템 초기화 시 행을 한 번만 복사해 두고, 이후에는 인덱스 접근만 허용합니다.
+ * 빌드 이후 내용이 변하지 않으므로 워커 스레드에서 const 참조로 읽어도 안전합니다.
+ */
+
+#pragma region 행 핸들
+/**
+ * @struct TKNDataRowId
+ * @brief  캐시 배열 내 행 위치를 가리키는 타입 안전 정수 핸들입니다.
+ * @tparam RowT 대상 행 구조체 타입 (다른 테이블 핸들과 섞이지 않도록 구분)
+ */
+template <typename RowT>
+struct TKNDataRowId
+{
+    int32 Index = INDEX_NONE;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+
+    bool operator==(const TKNDataRowId& Other) const { return Index == Other.Index; }
+    bool operator!=(const TKNDataRowId& Other) const { return Index != Other.Index; }
+};
+#pragma endregion 행 핸들
+
+#pragma region 행 캐시
+/**
+ * @class  TKNDataRowCache
+ * @brief  UDataTable의 행을 TArray<RowT>로 복사해 둔 불변 캐시입니다.
+ *
+ * @details
+ * [사용 흐름]
+ * 1. Build(Table)  : 게임 스레드에서 1회 호출하여 행 복사 및 이름 → 인덱스 표 작성
+ * 2. FindId(Name)  : 초기화/BeginPlay 등 콜드 패스에서 1회 이름을 핸들로 변환
+ * 3. Get(Id)       : 핫 패스에서 배열 인덱싱만으로 행 참조
+ *
+ * 행에 포함된 에셋 참조(몽타주, VFX 등)는 원본 테이블을 보유한 UKNGameInstance가 GC로부터 보호합니다.
+ */
+template <typename RowT>
+class TKNDataRowCache
+{
+public:
+    /** @brief 테이블 기본 행 이름 (기획 데이터 규약) */
+    static FName GetDefaultRowName() { return FName(TEXT("Default")); }
+
+    /**
+     * @brief 테이블의 모든 행을 연속 배열로 복사합니다.
+     * @param Table 원본 데이터 테이블 (nullptr이면 빈 캐시)
+     * @return 구조체 타입이 일치하여 정상 적재되었으면 true
+     */
+    bool Build(const UDataTable* Table)
+    {
+        Reset();
+        if (!Table) return false;
+
+        if (!Table->GetRowStruct() || !Table->GetRowStruct()->IsChildOf(RowT::StaticStruct()))
+        {
+            UE_LOG(LogTemp, Error, TEXT("[KNDataRowCache] %s 의 행 구조체가 %s 와 일치하지 않습니다."),
+                *Table->GetName(), *RowT::StaticStruct()->GetName());
+            return false;
+        }
+
+        const TMap<FName, uint8*>& RowMap = Table->GetRowMap();
+        Rows.Reserve(RowMap.Num());
+        RowNames.Reserve(RowMap.Num());
+        NameToIndex.Reserve(RowMap.Num());
+
+        for (const TPair<FName, uint8*>& Pair : RowMap)
+        {
+            const int32 NewIndex = Rows.Add(*reinterpret_cast<const RowT*>(Pair.Value));
+            RowNames.Add(Pair.Key);
+            NameToIndex.Add(Pair.Key, NewIndex);
+        }
+
+        DefaultId = FindId(GetDefaultRowName());
+        SourceTable = Table;
+        return true;
+    }
+
+    /** @brief 캐시를 비웁니다. */
+    void Reset()
+    {
+        Rows.Reset();
+        RowNames.Reset();
+        NameToIndex.Reset();
+        DefaultId = TKNDataRowId<RowT>();
+        SourceTable.Reset();
+    }
+
+    /**
+     * @brief 행 이름을 정수 핸들로 변환합니다. (콜드 패스 전용)
+     * @param RowName 행 이름
+     * @return 행 핸들, 없으면 무효 핸들
+     */
+    TKNDataRowId<RowT> FindId(const FName& RowName) const
+    {
+        TKNDataRowId<RowT> Id;
+        if (const int32* Found = NameToIndex.Find(RowName))
+        {
+            Id.Index = *Found;
+        }
+        return Id;
+    }
+
+    /**
+     * @brief 에디터에서 지정한 행 핸들을 정수 핸들로 변환합니다. (콜드 패스 전용)
+     * @param Handle 테이블과 행 이름
+     * @return 핸들의 테이블이 이 캐시의 원본 테이블이고 행이 있으면 유효 핸들
+     */
+    TKNDataRowId<RowT> FindId(const FDataTableRowHandle& Handle) const
+    {
+        if (!Handle.DataTable || Handle.DataTable != SourceTable.Get()) return TKNDataRowId<RowT>();
+        return FindId(Handle.RowName);
+    }
+
+    /**
+     * @brief 핸들로 행을 조회합니다. (핫 패스, 해시 조회 없음)
+     * @param Id FindId로 얻은 핸들
+     * @return 행 포인터, 무효 핸들이면 nullptr
+     */
+    const RowT* Get(TKNDataRowId<RowT> Id) const
+    {
+        return Rows.IsValidIndex(Id.Index) ? &Rows[Id.Index] : nullptr;
+    }
+
+    /**
+     * @brief 이름으로 행을 조회합니다. (FindRow 대체 호환 경로)
+     * @param RowName 행 이름
+     * @return 행 포인터, 없으면 nullptr
+     */
+    const RowT* Find(const FName& RowName) const
+    {
+        return Get(FindId(RowName));
+    }
+
+    /** @brief "Default" 행을 조회합니다. (빌드 시 미리 해석된 핸들 사용) */
+    const RowT* GetDefault() const { return Get(DefaultId); }
+
+    /** @brief "Default" 행 핸들을 반환합니다. */
+    TKNDataRowId<RowT> GetDefaultId() const { return DefaultId; }
+
+    /** @brief 모든 행의 읽기 전용 연속 뷰 (순회용) */
+    TConstArrayView<RowT> GetRows() const { return Rows; }
+
+    /** @brief 핸들에 대응하는 행 이름 (디버그/로그용) */
+    FName GetRowName(TKNDataRowId<RowT> Id) const
+    {
+        return RowNames.IsValidIndex(Id.Index) ? RowNames[Id.Index] : NAME_None;
+    }
+
+    int32 Num() const { return Rows.Num(); }
+
+private:
+    /** @brief 행 데이터 연속 배열 */
+    TArray<RowT> Rows;
+
+    /** @brief Rows와 같은 순서의 행 이름 */
+    TArray<FName> RowNames;
+
+    /** @brief 이름 → 인덱스 표 (콜드 패스 전용) */
+    TMap<FName, int32> NameToIndex;
+
+    /** @brief 빌드 시 해석된 "Default" 행 핸들 */
+    TKNDataRowId<RowT> DefaultId;
+
+    /** @brief 평탄화한 원본 테이블 (행 핸들 해석 시 테이블 일치 확인용) */
+    TWeakObjectPtr<const UDataTable> SourceTable;
+};
+#pragma endregion 행 캐시
@@ -0,0 +1,208 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Engine/HitResult.h"
+#include "GameplayEffect.h"
+#include "KNHitQueueSubsystem.generated.h"
+
+#pragma region 전방 선언
+class UAbilitySystemComponent;
+class UKNStatsComponent;
+class UNiagaraSystem;
+class UKNHitQueueSubsystem;
+#pragma endregion 전방 선언
+
+#pragma region 피격 레코드
+/**
+ * @struct FKNHitRecord
+ * @brief  한 프레임 동안 큐에 쌓이는 피격 1건의 데이터입니다.
+ * @details 데미지 · 오버클럭 획득 · 적중 VFX를 모두 선택적으로 담으며, 해결은 프레임 말 일괄 처리됩니다.
+ *          큐는 같은 프레임의 GC 이전에 비워지므로 VFX 에셋은 원시 포인터로 보관합니다.
+ */
+struct FKNHitRecord
+{
+    // ── 데미지 (UKNDamageExecution) ──
+    /** @brief 데미지 스펙의 소스 ASC */
+    TWeakObjectPtr<UAbilitySystemComponent> SourceASC;
+
+    /** @brief 데미지를 받을 ASC */
+    TWeakObjectPtr<UAbilitySystemComponent> TargetASC;
+
+    /** @brief 데미지 GE 클래스 (nullptr이면 데미지 없음) */
+    TSubclassOf<UGameplayEffect> DamageGEClass;
+
+    /** @brief 배율 적용 전 기본 데미지 */
+    float BaseDamage = 0.0f;
+
+    /** @brief 공격자 측 누적 배율 */
+    float DamageMultiplier = 1.0f;
+
+    /** @brief 인스티게이터 (nullptr이면 소스 ASC의 OwnerActor) */
+    TWeakObjectPtr<AActor> Instigator;
+
+    /** @brief 이펙트 유발자 (nullptr이면 소스 ASC의 AvatarActor) */
+    TWeakObjectPtr<AActor> EffectCauser;
+
+    /** @brief 컨텍스트에 기록할 히트 결과 (bHasHitResult일 때만 사용) */
+    FHitResult Hit;
+    bool bHasHitResult = false;
+
+    // ── 오버클럭 획득 ──
+    /** @brief 오버클럭 포인트를 받을 스탯 컴포넌트 */
+    TWeakObjectPtr<UKNStatsComponent> OverclockReceiver;
+
+    /** @brief 오버클럭 획득량 */
+    float OverclockGain = 0.0f;
+
+    // ── 적중 VFX ──
+    /** @brief 적중 VFX (nullptr이면 생략) */
+    UNiagaraSystem* HitVFX = nullptr;
+
+    FVector VFXLocation = FVector::ZeroVector;
+    FRotator VFXRotation = FRotator::ZeroRotator;
+};
+
+/**
+ * @struct FKNHitQueueStats
+ * @brief  피격 큐 처리 통계입니다. (KN.Combat.HitQueueStats로 출력)
+ */
+struct FKNHitQueueStats
+{
+    /** @brief 마지막 해결 프레임의 피격 수 */
+    int32 LastFrameHits = 0;
+
+    /** @brief 프레임당 최대 피격 수 */
+    int32 PeakFrameHits = 0;
+
+    /** @brief 누적 피격 수 */
+    int32 TotalHits = 0;
+
+    /** @brief 피격이 1건 이상 있었던 해결 프레임 수 */
+    int32 ResolvedFrames = 0;
+
+    /** @brief 실제로 적용한 데미지 GE 수 (병합 후) */
+    int32 DamageApplications = 0;
+
+    /** @brief 실제로 적용한 오버클럭 획득 수 (병합 후) */
+    int32 OverclockApplications = 0;
+
+    /** @brief 실제로 스폰한 VFX 수 (중복 제거 후) */
+    int32 VFXSpawned = 0;
+
+    /** @brief 마지막 해결 소요 시간 (ms) */
+    double LastResolveMs = 0.0;
+
+    /** @brief 누적 해결 소요 시간 (ms) */
+    double TotalResolveMs = 0.0;
+};
+#pragma endregion 피격 레코드
+
+#pragma region 피격 큐 틱 함수
+/**
+ * @struct FKNHitQueueTickFunction
+ * @brief  피격 큐를 TG_PostUpdateWork에서 해결하는 월드 틱 함수입니다.
+ */
+USTRUCT()
+struct FKNHitQueueTickFunction : public FTickFunction
+{
+    GENERATED_BODY()
+
+    /** @brief 큐를 소유한 서브시스템 (서브시스템이 등록/해제를 관리) */
+    UKNHitQueueSubsystem* Owner = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+    virtual FString DiagnosticMessage() override;
+    virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FKNHitQueueTickFunction> : public TStructOpsTypeTraitsBase2<FKNHitQueueTickFunction>
+{
+    enum { WithCopy = false };
+};
+#pragma endregion 피격 큐 틱 함수
+
+/**
+ * @file    KNHitQueueSubsystem.h
+ * @class   UKNHitQueueSubsystem
+ * @brief   한 프레임의 피격을 모아 프레임 말(TG_PostUpdateWork)에 일괄 해결하는 월드 서브시스템입니다.
+ *
+ * @details
+ * [일괄 해결 규칙]
+ * - 데미지: 같은 (소스 ASC, 대상 ASC, GE 클래스) 피격은 합산하여 GE 1회로 적용합니다.
+ * - 오버클럭: 수령자별 획득량을 합산하여 GainOverclockPoint 1회로 적용합니다.
+ * - VFX: 같은 에셋이 VFXMergeDistance 이내에서 겹치면 1개만 스폰합니다.
+ * 해결 중 콜백에서 추가된 피격은 다음 프레임으로 넘어갑니다.
+ */
+UCLASS()
+class KATANANEON_API UKNHitQueueSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+#pragma region 서브시스템 생명주기
+public:
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+#pragma endregion 서브시스템 생명주기
+
+#pragma region 피격 큐 인터페이스
+public:
+    /**
+     * @brief 월드 컨텍스트에서 피격 큐를 찾습니다.
+     * @param WorldContextObject 월드를 가진 오브젝트
+     * @return 서브시스템, 지원하지 않는 월드면 nullptr
+     */
+    static UKNHitQueueSubsystem* Get(const UObject* WorldContextObject);
+
+    /**
+     * @brief 피격 1건을 이번 프레임 큐에 추가합니다.
+     * @param Record 피격 데이터
+     */
+    void Enqueue(FKNHitRecord&& Record);
+
+    /** @brief 쌓인 피격을 즉시 일괄 해결합니다. (틱 함수에서 호출) */
+    void Flush();
+
+    /** @brief 처리 통계 */
+    const FKNHitQueueStats& GetStats() const { return Stats; }
+
+    /** @brief 통계를 0으로 되돌립니다. */
+    void ResetStats() { Stats = FKNHitQueueStats(); }
+
+    /** @brief 같은 VFX를 하나로 합치는 거리 (cm) */
+    static constexpr float VFXMergeDistance = 30.0f;
+#pragma endregion 피격 큐 인터페이스
+
+#pragma region 내부 헬퍼 함수
+private:
+    /** @brief 데미지를 (소스, 대상, GE) 단위로 합산해 적용합니다. */
+    void ResolveDamage();
+
+    /** @brief 오버클럭 획득을 수령자 단위로 합산해 적용합니다. */
+    void ResolveOverclock();
+
+    /** @brief 겹치는 VFX를 제거하고 스폰합니다. */
+    void ResolveVFX();
+#pragma endregion 내부 헬퍼 함수
+
+#pragma region 런타임 상태
+private:
+    /** @brief 이번 프레임에 쌓이는 피격 */
+    TArray<FKNHitRecord> PendingHits;
+
+    /** @brief 해결 중인 피격 (PendingHits와 교체하여 버퍼 재사용) */
+    TArray<FKNHitRecord> ResolvingHits;
+
+    /** @brief 프레임 말 해결 틱 함수 */
+    FKNHitQueueTickFunction TickFunction;
+
+    FKNHitQueueStats Stats;
+#pragma endregion 런타임 상태
+};
@@ -0,0 +1,44 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "KNPooledActorInterface.generated.h"
+
+UINTERFACE(MinimalAPI, Blueprintable)
+class UKNPooledActor : public UInterface
+{
+    GENERATED_BODY()
+};
+
+/**
+ * @file    KNPooledActorInterface.h
+ * @class   IKNPooledActor
+ * @brief   UKNActorPoolSubsystem이 재사용하는 액터가 구현하는 수명주기 훅입니다.
+ *
+ * @details
+ * 풀 액터는 생성 시 BeginPlay를 한 번만 거치고, 이후에는 이 두 훅으로만 활성/비활성화됩니다.
+ * - 숨김·충돌·액터 틱·LifeSpan 타이머는 풀이 공통으로 처리합니다.
+ * - 컴포넌트 상태(이동, 이펙트, 충돌 크기)와 발사별 플래그는 구현 측 훅에서 되돌립니다.
+ * - 소멸 대신 UKNActorPoolSubsystem::ReleaseActor로 반납해야 합니다.
+ */
+class KATANANEON_API IKNPooledActor
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief 풀에서 꺼내 FinishAcquire로 활성화될 때 호출됩니다.
+     * @details 호출 시점에 트랜스폼·Owner·Instigator와 호출자가 주입한 발사 데이터가 이미 적용되어 있습니다.
+     */
+    UFUNCTION(BlueprintNativeEvent, Category = "KatanaNeon|Pool")
+    void OnAcquiredFromPool();
+
+    /**
+     * @brief 풀로 반납되어 비활성화되기 직전에 호출됩니다.
+     * @details 다음 사용자가 이전 발사의 상태를 보지 않도록 런타임 상태를 초기화합니다.
+     */
+    UFUNCTION(BlueprintNativeEvent, Category = "KatanaNeon|Pool")
+    void OnReleasedToPool();
+};
@@ -0,0 +1,288 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "CollisionShape.h"
+#include "WorldCollision.h"
+#include "Framework/System/KNTimeDilationSubsystem.h"
+#include "KNProjectileSubsystem.generated.h"
+
+#pragma region 전방 선언
+class UNiagaraSystem;
+class UNiagaraComponent;
+class UAbilitySystemComponent;
+class UGameplayEffect;
+class UKNProjectileSubsystem;
+#pragma endregion 전방 선언
+
+#pragma region 발사 파라미터
+/**
+ * @struct FKNProjectileLaunchParams
+ * @brief  관리형 발사체 1발의 발사 데이터입니다. (DataTable 행에서 채워 Launch에 전달)
+ */
+struct FKNProjectileLaunchParams
+{
+    /** @brief 발사 위치 */
+    FVector Location = FVector::ZeroVector;
+
+    /** @brief 초기 속도 (cm/s, 중력 없음) */
+    FVector Velocity = FVector::ZeroVector;
+
+    /** @brief 생존 시간 (개체 기준 초, 감속 시 함께 늘어남) */
+    float LifeTime = 0.0f;
+
+    /** @brief 스윕 형상 (박스는 진행 방향으로 회전) */
+    FCollisionShape Shape = FCollisionShape::MakeSphere(10.0f);
+
+    /** @brief 발사한 진영 (반대 진영 허트박스에만 적중, 크로노스 필드 대상 판정) */
+    EKNTimeTeam Team = EKNTimeTeam::None;
+
+    /** @brief 발사자 (자기 피격 제외, 히트 인스티게이터) */
+    TWeakObjectPtr<AActor> Owner;
+
+    /** @brief 데미지 스펙 소스 ASC */
+    TWeakObjectPtr<UAbilitySystemComponent> SourceASC;
+
+    /** @brief 데미지 GE 클래스 (피격 큐로 적용) */
+    TSubclassOf<UGameplayEffect> DamageGEClass;
+
+    /** @brief 기본 데미지 */
+    float BaseDamage = 0.0f;
+
+    /** @brief 적중 시 즉시 적용할 Duration GE (선택) */
+    TSubclassOf<UGameplayEffect> GrogyGEClass;
+
+    /** @brief GrogyGEClass 지속 시간 (초) */
+    float GrogyDuration = 0.0f;
+
+    /** @brief 화면에 보일 때만 바인딩되는 루프 Niagara 프록시 (선택) */
+    UNiagaraSystem* ProxySystem = nullptr;
+};
+
+/**
+ * @struct FKNProjectileStats
+ * @brief  관리형 발사체 카운터입니다. (KN.Projectile.Stats로 출력)
+ */
+struct FKNProjectileStats
+{
+    int32 Launched = 0;
+    int32 Rejected = 0;
+    int32 Expired = 0;
+    int32 CharacterHits = 0;
+    int32 WorldHits = 0;
+    int32 Sweeps = 0;
+    int32 ProxyBinds = 0;
+    int32 PeakLive = 0;
+
+    /** @brief 마지막/최대 틱 게임 스레드 비용 (ms) */
+    double LastTickMs = 0.0;
+    double PeakTickMs = 0.0;
+};
+
+/**
+ * @struct FKNProjectileProxyBucket
+ * @brief  Niagara 시스템 에셋 하나에 대한 대기 중 프록시 컴포넌트 목록입니다.
+ */
+USTRUCT()
+struct FKNProjectileProxyBucket
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<TObjectPtr<UNiagaraComponent>> Free;
+};
+#pragma endregion 발사 파라미터
+
+#pragma region 발사체 틱 함수
+/**
+ * @struct FKNProjectileTickFunction
+ * @brief  모든 관리형 발사체를 한 번에 전진·판정하는 월드 틱 함수입니다. (TG_PrePhysics)
+ */
+USTRUCT()
+struct FKNProjectileTickFunction : public FTickFunction
+{
+    GENERATED_BODY()
+
+    /** @brief 틱 함수를 소유한 서브시스템 (서브시스템이 등록/해제를 관리) */
+    UKNProjectileSubsystem* Owner = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+    virtual FString DiagnosticMessage() override;
+    virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FKNProjectileTickFunction> : public TStructOpsTypeTraitsBase2<FKNProjectileTickFunction>
+{
+    enum { WithCopy = false };
+};
+#pragma endregion 발사체 틱 함수
+
+/**
+ * @file    KNProjectileSubsystem.h
+ * @class   UKNProjectileSubsystem
+ * @brief   적 원거리 발사체와 Lv2 참격파를 액터 없이 SoA 배열로 시뮬레이션하는 월드 서브시스템입니다.
+ *
+ * @details
+ * [데이터 배치]
+ * 위치·속도·남은 수명·시간 배율·발사자를 각각의 배열(SoA)로 두고, 데미지 데이터 등 적중 시에만 읽는 값은
+ * 별도 페이로드 배열에 둡니다. 제거는 모든 배열에서 RemoveAtSwap으로 수행합니다.
+ *
+ * [틱 순서] (프레임당 1회, 전체 일괄)
+ * 1. 지난 프레임에 예약한 비동기 스윕 결과 해석 → 적중/지형 충돌 발사체 제거
+ * 2. 시간 서브시스템의 진영·필드 레이어로 발사체별 배율 갱신 (크로노스 감속, 시간 정지 시 0)
+ * 3. 배율이 적용된 델타로 전진·수명 감소 후 이동 구간 스윕 (WorldStatic + KNHurtbox 오브젝트 타입)
+ * 4. 만료 발사체 제거 후 카메라 시야 안의 발사체에만 풀 프록시(Niagara)를 바인딩
+ *
+ * [충돌]
+ * bUseAsyncSweeps이면 스윕을 예약만 하고 다음 프레임에 결과를 읽으므로 게임 스레드 비용이 거의 없습니다. (적중 지연 최대 1프레임)
+ * 발사 진영과 같은 진영의 허트박스는 통과하며, 데미지는 피격 큐로 프레임 말에 일괄 적용됩니다.
+ */
+UCLASS(Config = Game)
+class KATANANEON_API UKNProjectileSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+#pragma region 서브시스템 생명주기
+public:
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+#pragma endregion 서브시스템 생명주기
+
+#pragma region 발사 인터페이스
+public:
+    /**
+     * @brief 월드 컨텍스트에서 발사체 서브시스템을 찾습니다.
+     * @param WorldContextObject 월드를 가진 오브젝트
+     * @return 서브시스템, 지원하지 않는 월드면 nullptr
+     */
+    static UKNProjectileSubsystem* Get(const UObject* WorldContextObject);
+
+    /**
+     * @brief 관리형 발사체 1발을 추가합니다.
+     * @param Params 발사 데이터
+     * @return MaxProjectiles 초과 또는 잘못된 수명이면 false
+     */
+    bool Launch(const FKNProjectileLaunchParams& Params);
+
+    /** @brief 현재 살아 있는 발사체 수 */
+    int32 GetNumLive() const { return Positions.Num(); }
+
+    /** @brief 현재 바인딩된 프록시 수 */
+    int32 GetNumBoundProxies() const { return NumBoundProxies; }
+
+    /**
+     * @brief 모든 발사체를 한 번에 전진·판정합니다. (틱 함수에서 호출)
+     * @param DeltaTime 글로벌 TimeDilation이 적용된 월드 델타
+     */
+    void Tick(float DeltaTime);
+
+    /** @brief 통계 */
+    const FKNProjectileStats& GetStats() const { return Stats; }
+
+    /** @brief 통계를 0으로 되돌립니다. */
+    void ResetStats() { Stats = FKNProjectileStats(); }
+#pragma endregion 발사 인터페이스
+
+#pragma region 설정 (DefaultGame.ini)
+protected:
+    /** @brief 동시 발사체 상한 */
+    UPROPERTY(Config)
+    int32 MaxProjectiles = 2048;
+
+    /** @brief 이동 구간 스윕을 비동기로 예약할지 여부 (적중 지연 최대 1프레임) */
+    UPROPERTY(Config)
+    bool bUseAsyncSweeps = true;
+
+    /** @brief 프록시를 바인딩하는 카메라 최대 거리 (cm) */
+    UPROPERTY(Config)
+    float ProxyCullDistance = 6000.0f;
+
+    /** @brief 동시 바인딩 프록시 상한 */
+    UPROPERTY(Config)
+    int32 MaxBoundProxies = 256;
+#pragma endregion 설정
+
+#pragma region 내부 헬퍼 함수
+private:
+    /** @brief 적중 시에만 읽는 발사체 데이터 */
+    struct FPayload
+    {
+        TWeakObjectPtr<UAbilitySystemComponent> SourceASC;
+        TSubclassOf<UGameplayEffect> DamageGEClass;
+        TSubclassOf<UGameplayEffect> GrogyGEClass;
+        TWeakObjectPtr<UNiagaraSystem> ProxySystem;
+        FCollisionShape Shape;
+        float BaseDamage = 0.0f;
+        float GrogyDuration = 0.0f;
+        EKNTimeTeam Team = EKNTimeTeam::None;
+    };
+
+    /** @brief 지난 프레임 비동기 스윕 결과를 해석합니다. */
+    void ResolvePendingSweeps(UWorld& World);
+
+    /** @brief 시간 레이어로 발사체별 배율을 갱신합니다. */
+    void UpdateDilation();
+
+    /** @brief 전진·수명 감소 후 이동 구간 스윕을 수행(또는 예약)합니다. */
+    void Integrate(UWorld& World, float DeltaTime);
+
+    /**
+     * @brief 스윕 결과에서 첫 유효 충돌을 찾아 처리합니다. 소유자와 같은 진영 허트박스는 건너뜁니다.
+     * @return 발사체가 소멸해야 하면 true
+     */
+    bool ProcessSweepHits(int32 Index, TArray<FHitResult>& Hits);
+
+    /** @brief 캐릭터 적중 — 데미지는 피격 큐에 등록하고 그로기 GE는 즉시 적용합니다. */
+    void ApplyCharacterHit(int32 Index, AActor* TargetActor, const FHitResult& Hit);
+
+    /** @brief 제거 표시된 발사체를 모든 배열에서 제거합니다. */
+    void RemoveDead();
+
+    /** @brief 카메라 시야 안의 발사체에만 프록시를 바인딩하고 위치를 갱신합니다. */
+    void UpdateProxies(UWorld& World);
+
+    /** @brief 풀에서 프록시를 꺼내 발사체에 바인딩합니다. */
+    void BindProxy(UWorld& World, int32 Index);
+
+    /** @brief 발사체의 프록시를 풀로 되돌립니다. */
+    void ReleaseProxy(int32 Index);
+
+    /** @brief 발사체를 제거 대상으로 표시합니다. */
+    FORCEINLINE void Kill(int32 Index) { RemainingLife[Index] = -1.0f; bHasDead = true; }
+#pragma endregion 내부 헬퍼 함수
+
+#pragma region 런타임 상태
+private:
+    // ── 매 틱 순회하는 SoA 열 ──
+    TArray<FVector> Positions;
+    TArray<FVector> Velocities;
+    TArray<float> RemainingLife;
+    TArray<float> DilationScales;
+    TArray<TWeakObjectPtr<AActor>> Owners;
+
+    // ── 적중·스윕·표시 시에만 접근하는 열 ──
+    TArray<FPayload> Payloads;
+    TArray<FTraceHandle> PendingSweeps;
+
+    /** @brief 발사체별 바인딩된 프록시 (없으면 nullptr) */
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UNiagaraComponent>> BoundProxies;
+
+    /** @brief Niagara 시스템 → 대기 프록시 */
+    UPROPERTY(Transient)
+    TMap<TObjectPtr<UNiagaraSystem>, FKNProjectileProxyBucket> ProxyPool;
+
+    int32 NumBoundProxies = 0;
+    bool bHasDead = false;
+
+    FKNProjectileTickFunction TickFunction;
+    FKNProjectileStats Stats;
+#pragma endregion 런타임 상태
+};
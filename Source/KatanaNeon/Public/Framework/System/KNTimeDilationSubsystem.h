@@ -0,0 +1,533 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "TimerManager.h"
+#include "KNTimeDilationSubsystem.generated.h"
+
+#pragma region 전방 선언
+class UKNTimeDilationSubsystem;
+class UNiagaraComponent;
+class USceneComponent;
+#pragma endregion 전방 선언
+
+#pragma region 시간 레이어 타입
+/**
+ * @enum  EKNTimeLayerScope
+ * @brief 시간 레이어가 적용되는 범위입니다.
+ */
+enum class EKNTimeLayerScope : uint8
+{
+    /** @brief 월드 전체 (WorldSettings TimeDilation) */
+    Global,
+
+    /** @brief 특정 진영에 등록된 모든 액터 */
+    Team,
+
+    /** @brief 단일 액터 */
+    Actor,
+
+    /** @brief 구체 멤버 액터 (멤버별 배율, 크로노스 구체가 오버랩으로 갱신) */
+    Sphere,
+
+    /** @brief 진영 틱 정지 (배율 대신 액터·컴포넌트 틱 자체를 중단) */
+    Freeze,
+};
+
+/**
+ * @enum  EKNTimeTeam
+ * @brief 진영 레이어 대상 구분입니다. 캐릭터는 BeginPlay에서 진영과 함께 등록됩니다.
+ */
+enum class EKNTimeTeam : uint8
+{
+    None,
+    Player,
+    Enemy,
+};
+
+/**
+ * @enum  EKNTimeBody
+ * @brief 등록 시 1회 분류되는 액터 종류입니다. 크로노스 필드가 종류별 배율을 고르는 데 사용합니다.
+ */
+enum class EKNTimeBody : uint8
+{
+    Character,
+    Projectile,
+};
+
+/**
+ * @struct FKNTimeLayerHandle
+ * @brief  PushXxxLayer가 반환하는 레이어 식별자입니다. PopLayer 시 무효화됩니다.
+ */
+struct FKNTimeLayerHandle
+{
+    int32 Id = INDEX_NONE;
+
+    bool IsValid() const { return Id != INDEX_NONE; }
+    void Invalidate() { Id = INDEX_NONE; }
+};
+
+/**
+ * @struct FKNRealTimerHandle
+ * @brief  비감속(실시간) 타이머 식별자입니다.
+ */
+struct FKNRealTimerHandle
+{
+    uint32 Id = 0;
+
+    bool IsValid() const { return Id != 0; }
+    void Invalidate() { Id = 0; }
+};
+
+/**
+ * @struct FKNTimeDilationStats
+ * @brief  재계산·쓰기 횟수 카운터입니다. (KN.Time.Stats로 출력)
+ */
+struct FKNTimeDilationStats
+{
+    /** @brief 레이어 변경으로 재계산한 프레임 수 */
+    int32 Recomputes = 0;
+
+    /** @brief 실제로 CustomTimeDilation을 쓴 횟수 */
+    int32 ActorWrites = 0;
+
+    /** @brief 값이 같아 쓰기를 생략한 횟수 */
+    int32 ActorWritesSkipped = 0;
+
+    /** @brief WorldSettings TimeDilation을 쓴 횟수 */
+    int32 GlobalWrites = 0;
+
+    /** @brief 누적 레이어 추가 수 */
+    int32 LayersPushed = 0;
+
+    /** @brief 틱을 정지시킨 누적 액터 수 */
+    int32 ActorsFrozen = 0;
+
+    /** @brief 틱을 정지시킨 누적 액터·컴포넌트 틱 함수 수 */
+    int32 TicksSuspended = 0;
+
+    /** @brief 크로노스 필드 공간 해시 갱신 횟수 */
+    int32 FieldUpdates = 0;
+
+    /** @brief 셀이 바뀌어 버킷을 옮긴 후보 수 */
+    int32 FieldCellMoves = 0;
+
+    /** @brief 필드 질의에서 거리 검사한 후보 수 (해시 셀 내 액터만) */
+    int32 FieldCandidatesTested = 0;
+
+    /** @brief 필드 멤버 추가·제거·배율 변경 수 */
+    int32 FieldMemberChanges = 0;
+};
+#pragma endregion 시간 레이어 타입
+
+#pragma region 시간 레이어 틱 함수
+/**
+ * @struct FKNTimeDilationTickFunction
+ * @brief  변경된 레이어를 반영하고 실시간 타이머를 진행하는 월드 틱 함수입니다. (TG_PrePhysics 선두)
+ */
+USTRUCT()
+struct FKNTimeDilationTickFunction : public FTickFunction
+{
+    GENERATED_BODY()
+
+    /** @brief 틱 함수를 소유한 서브시스템 (서브시스템이 등록/해제를 관리) */
+    UKNTimeDilationSubsystem* Owner = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+    virtual FString DiagnosticMessage() override;
+    virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FKNTimeDilationTickFunction> : public TStructOpsTypeTraitsBase2<FKNTimeDilationTickFunction>
+{
+    enum { WithCopy = false };
+};
+#pragma endregion 시간 레이어 틱 함수
+
+/**
+ * @file    KNTimeDilationSubsystem.h
+ * @class   UKNTimeDilationSubsystem
+ * @brief   글로벌·진영·액터·구체 시간 배율 레이어를 우선순위로 합성하여 단일 지점에서 기록하는 월드 서브시스템입니다.
+ *
+ * @details
+ * [합성 규칙]
+ * - 글로벌: Global 레이어 중 우선순위가 가장 높은 레이어의 배율 (없으면 1.0)
+ * - 액터: 해당 액터에 적용되는 Team/Actor/Sphere 레이어 중 우선순위가 가장 높은 레이어 하나가 결정합니다.
+ *   - bRealTime 레이어: 실시간 대비 체감 배율 = Scale (글로벌 감속을 상쇄)
+ *   - 일반 레이어:      실시간 대비 체감 배율 = Global × Scale
+ *   CustomTimeDilation = 체감 배율 / Global
+ * 같은 우선순위에서는 나중에 추가된 레이어가 이깁니다.
+ *
+ * [쓰기 최소화]
+ * 레이어가 바뀐 프레임에만 TG_PrePhysics 선두에서 1회 재계산하며,
+ * 현재 값과 다른 액터에만 CustomTimeDilation을 씁니다. 레이어 변경이 없으면 틱 비용은 실시간 타이머 검사뿐입니다.
+ *
+ * [틱 정지]
+ * Freeze 레이어가 있는 진영의 등록 액터(폰이면 컨트롤러 포함)는 액터·컴포넌트 틱을 끄고 Niagara를 일시정지합니다.
+ * 정지 시점에 켜져 있던 것만 기록해 두었다가 해제 시 그대로 되돌리므로, 원래 꺼져 있던 틱은 건드리지 않습니다.
+ * 정지 중에도 GE 적용(피격 큐)은 틱과 무관하게 즉시 처리됩니다.
+ *
+ * [크로노스 필드]
+ * 필드 레이어는 구체 레이어의 한 형태로, 멤버를 오버랩 콜백 대신 FieldUpdateInterval(실시간)마다
+ * 등록 액터의 균일 공간 해시(XY 셀)를 질의해 채웁니다. 새 멤버 집합은 이전과 비교해 바뀐 경우에만 반영하므로
+ * 경계 통과 빈도와 무관하게 비용은 필드 안팎 셀의 액터 수에 비례합니다. 여러 필드(적이 펼친 필드 포함)가 동시에 동작합니다.
+ * 해시는 등록·해제 시점에 후보를 추가·제거하며 유지되고, 갱신마다 필드가 노리는 진영의 후보 위치만 다시 읽어
+ * 셀이 바뀐 후보만 버킷을 옮깁니다. (매 갱신 전체 재구성·멤버 맵 할당 없음)
+ *
+ * [시계]
+ * - GetRealTimeSeconds: 일시정지 시 멈추지만 TimeDilation의 영향을 받지 않는 시계
+ * - GetDilatedTimeSeconds: 월드 게임 시간 (FTimerManager와 동일 기준)
+ * 시간 정지처럼 글로벌 배율이 극단적인 구간의 지속 시간은 SetRealTimeTimer로 잽니다.
+ */
+UCLASS(Config = Game)
+class KATANANEON_API UKNTimeDilationSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+#pragma region 레이어 우선순위
+public:
+    /** @brief 크로노스 구체 감속 */
+    static constexpr int32 PriorityChronos = 100;
+
+    /** @brief 퍼펙트 패링 플러리 러시 슬로우 모션 */
+    static constexpr int32 PriorityFlurryRush = 200;
+
+    /** @brief 오버클럭 Lv3 시간 정지 */
+    static constexpr int32 PriorityTimeStop = 300;
+#pragma endregion 레이어 우선순위
+
+#pragma region 서브시스템 생명주기
+public:
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+#pragma endregion 서브시스템 생명주기
+
+#pragma region 레이어 인터페이스
+public:
+    /**
+     * @brief 월드 컨텍스트에서 시간 서브시스템을 찾습니다.
+     * @param WorldContextObject 월드를 가진 오브젝트
+     * @return 서브시스템, 지원하지 않는 월드면 nullptr
+     */
+    static UKNTimeDilationSubsystem* Get(const UObject* WorldContextObject);
+
+    /**
+     * @brief 월드 전체 배율 레이어를 추가합니다.
+     * @param Scale    글로벌 시간 배율
+     * @param Priority 우선순위 (높을수록 우선)
+     */
+    FKNTimeLayerHandle PushGlobalLayer(float Scale, int32 Priority);
+
+    /**
+     * @brief 진영 배율 레이어를 추가합니다.
+     * @param Team      대상 진영
+     * @param Scale     배율
+     * @param Priority  우선순위
+     * @param bRealTime true이면 글로벌 감속을 상쇄하여 실시간 대비 Scale로 움직입니다.
+     */
+    FKNTimeLayerHandle PushTeamLayer(EKNTimeTeam Team, float Scale, int32 Priority, bool bRealTime = false);
+
+    /**
+     * @brief 단일 액터 배율 레이어를 추가합니다.
+     * @param Actor     대상 액터
+     * @param Scale     배율
+     * @param Priority  우선순위
+     * @param bRealTime true이면 글로벌 감속을 상쇄하여 실시간 대비 Scale로 움직입니다.
+     */
+    FKNTimeLayerHandle PushActorLayer(AActor* Actor, float Scale, int32 Priority, bool bRealTime = false);
+
+    /**
+     * @brief 멤버별 배율을 갖는 구체 레이어를 추가합니다. 멤버는 SetSphereMember로 갱신합니다.
+     * @param Priority 우선순위
+     */
+    FKNTimeLayerHandle PushSphereLayer(int32 Priority);
+
+    /**
+     * @brief 공간 해시로 멤버를 주기적으로 갱신하는 크로노스 필드 레이어를 추가합니다.
+     * @param Center          필드 중심 컴포넌트 (파괴되면 필드는 빈 상태가 됩니다)
+     * @param Radius          필드 반경 (cm)
+     * @param TargetTeam      감속 대상 진영
+     * @param CharacterScale  대상 진영 캐릭터 배율
+     * @param ProjectileScale 대상 진영 발사체 배율
+     * @param Priority        우선순위
+     */
+    FKNTimeLayerHandle PushFieldLayer(
+        USceneComponent* Center,
+        float Radius,
+        EKNTimeTeam TargetTeam,
+        float CharacterScale,
+        float ProjectileScale,
+        int32 Priority);
+
+    /**
+     * @brief 구체·필드 레이어의 현재 멤버 수를 반환합니다.
+     * @param Handle 레이어 핸들
+     */
+    int32 GetNumLayerMembers(const FKNTimeLayerHandle& Handle) const;
+
+    /**
+     * @brief 구체 레이어에 멤버를 추가하거나 배율을 갱신합니다.
+     * @param Handle 구체 레이어 핸들
+     * @param Actor  멤버 액터
+     * @param Scale  멤버 배율
+     */
+    void SetSphereMember(const FKNTimeLayerHandle& Handle, AActor* Actor, float Scale);
+
+    /**
+     * @brief 구체 레이어에서 멤버를 제거합니다.
+     * @param Handle 구체 레이어 핸들
+     * @param Actor  멤버 액터
+     */
+    void RemoveSphereMember(const FKNTimeLayerHandle& Handle, AActor* Actor);
+
+    /**
+     * @brief 진영 틱 정지 레이어를 추가합니다. 해당 진영 액터는 다음 재계산에서 틱이 정지됩니다.
+     * @param Team 정지할 진영
+     */
+    FKNTimeLayerHandle PushFreezeLayer(EKNTimeTeam Team);
+
+    /**
+     * @brief 틱 정지 중인 액터인지 확인합니다.
+     * @param Actor 확인할 액터
+     */
+    bool IsActorFrozen(const AActor* Actor) const { return FrozenActors.Contains(Actor); }
+
+    /** @brief 현재 틱 정지 중인 액터 수 */
+    int32 GetNumFrozenActors() const { return FrozenActors.Num(); }
+
+    /**
+     * @brief 레이어를 제거하고 핸들을 무효화합니다. 가려져 있던 하위 레이어가 다시 적용됩니다.
+     * @param Handle 제거할 레이어 핸들
+     */
+    void PopLayer(FKNTimeLayerHandle& Handle);
+
+    /**
+     * @brief 진영 레이어·크로노스 필드 대상 액터로 등록합니다. (캐릭터 BeginPlay, 발사체 스폰 직후)
+     * @param Actor 등록할 액터
+     * @param Team  소속 진영
+     * @param Body  액터 종류 (필드 배율 선택용, 등록 시 1회 분류)
+     */
+    void RegisterActor(AActor* Actor, EKNTimeTeam Team, EKNTimeBody Body = EKNTimeBody::Character);
+
+    /**
+     * @brief 진영 등록을 해제하고, 정지 중이던 틱은 즉시 되돌립니다. (캐릭터 EndPlay, 풀 반납)
+     * @param Actor 해제할 액터
+     */
+    void UnregisterActor(AActor* Actor);
+
+    /** @brief 현재 적용 중인 글로벌 배율 */
+    float GetGlobalScale() const { return AppliedGlobalScale; }
+
+    /**
+     * @brief 액터가 아닌 시뮬레이션 개체(관리형 발사체 등)가 위치에서 받을 CustomTimeDilation 상당 배율을 계산합니다.
+     * @details Team 레이어와 위치를 포함하는 필드 레이어만 합성하며, 진영이 틱 정지 중이면 0을 반환합니다.
+     *          (오버랩 모드 구체 레이어는 액터 멤버십 기반이므로 포함되지 않습니다)
+     * @param Location 월드 위치
+     * @param Team     개체 진영
+     * @param Body     개체 종류 (필드 배율 선택)
+     */
+    float GetPointScale(const FVector& Location, EKNTimeTeam Team, EKNTimeBody Body) const;
+#pragma endregion 레이어 인터페이스
+
+#pragma region 시계 인터페이스
+public:
+    /** @brief 일시정지 시 멈추고 TimeDilation과 무관하게 흐르는 시계 (초) */
+    double GetRealTimeSeconds() const { return RealTimeSeconds; }
+
+    /** @brief 월드 게임 시간 (초, TimeDilation 적용) */
+    double GetDilatedTimeSeconds() const;
+
+    /**
+     * @brief 실시간 시계 기준 1회성 타이머를 설정합니다.
+     * @param InOutHandle 타이머 핸들 (유효하면 기존 타이머를 교체)
+     * @param Delegate    만료 시 호출할 델리게이트
+     * @param Seconds     실시간 지연 (초)
+     */
+    void SetRealTimeTimer(FKNRealTimerHandle& InOutHandle, FTimerDelegate Delegate, float Seconds);
+
+    /**
+     * @brief 실시간 타이머를 취소하고 핸들을 무효화합니다.
+     * @param InOutHandle 취소할 타이머 핸들
+     */
+    void ClearRealTimeTimer(FKNRealTimerHandle& InOutHandle);
+
+    /** @brief 변경된 레이어를 반영하고 실시간 타이머를 진행합니다. (틱 함수에서 호출) */
+    void Tick();
+
+    /** @brief 통계 */
+    const FKNTimeDilationStats& GetStats() const { return Stats; }
+
+    /** @brief 통계를 0으로 되돌립니다. */
+    void ResetStats() { Stats = FKNTimeDilationStats(); }
+
+    /** @brief 현재 레이어 목록을 로그로 출력합니다. */
+    void DumpLayers() const;
+#pragma endregion 시계 인터페이스
+
+#pragma region 설정 (DefaultGame.ini)
+protected:
+    /** @brief 크로노스 필드 멤버 갱신 주기 (실시간 초) */
+    UPROPERTY(Config)
+    float FieldUpdateInterval = 0.1f;
+
+    /** @brief 크로노스 필드 공간 해시 셀 크기 (cm) */
+    UPROPERTY(Config)
+    float FieldCellSize = 500.0f;
+#pragma endregion 설정
+
+#pragma region 내부 헬퍼 함수
+private:
+    /** @brief 레이어 1개 */
+    struct FLayer
+    {
+        int32 Id = INDEX_NONE;
+        EKNTimeLayerScope Scope = EKNTimeLayerScope::Global;
+        int32 Priority = 0;
+        float Scale = 1.0f;
+        bool bRealTime = false;
+        EKNTimeTeam Team = EKNTimeTeam::None;
+        TWeakObjectPtr<AActor> Actor;
+        TMap<TWeakObjectPtr<AActor>, float> Members;
+
+        /** @brief 크로노스 필드 (Sphere 스코프에서 멤버를 공간 해시로 갱신) */
+        bool bField = false;
+        TWeakObjectPtr<USceneComponent> FieldCenter;
+        float FieldRadius = 0.0f;
+        float FieldProjectileScale = 1.0f;
+    };
+
+    /** @brief 배율 기록 대상 액터 */
+    struct FTrackedActor
+    {
+        EKNTimeTeam Team = EKNTimeTeam::None;
+        EKNTimeBody Body = EKNTimeBody::Character;
+        bool bRegistered = false;
+
+        /** @brief FieldCandidates 내 인덱스 (진영 등록 중에만 유효) */
+        int32 FieldCandidateIndex = INDEX_NONE;
+    };
+
+    /** @brief 공간 해시에 담기는 필드 후보 (마지막 갱신 시점 위치 스냅샷) */
+    struct FFieldCandidate
+    {
+        TWeakObjectPtr<AActor> Actor;
+        FVector Location = FVector::ZeroVector;
+        EKNTimeTeam Team = EKNTimeTeam::None;
+        EKNTimeBody Body = EKNTimeBody::Character;
+
+        /** @brief 현재 들어 있는 해시 셀 (bHashed일 때만 유효) */
+        FIntPoint Cell = FIntPoint::ZeroValue;
+        bool bHashed = false;
+    };
+
+    /** @brief 틱 정지로 꺼 둔 틱 함수 기록 (해제 시 이 목록만 되돌림) */
+    struct FSuspendedTicks
+    {
+        TArray<TWeakObjectPtr<AActor>> Actors;
+        TArray<TWeakObjectPtr<UActorComponent>> Components;
+        TArray<TWeakObjectPtr<UNiagaraComponent>> PausedNiagara;
+    };
+
+    /** @brief 실시간 타이머 1개 */
+    struct FRealTimer
+    {
+        uint32 Id = 0;
+        double ExpireTime = 0.0;
+        FTimerDelegate Delegate;
+    };
+
+    /** @brief 새 레이어를 추가하고 핸들을 반환합니다. */
+    FKNTimeLayerHandle AddLayer(FLayer&& Layer);
+
+    /** @brief 핸들로 레이어를 찾습니다. */
+    FLayer* FindLayer(const FKNTimeLayerHandle& Handle);
+
+    /** @brief 액터를 기록 대상에 추가합니다. */
+    void TrackActor(AActor* Actor);
+
+    /** @brief 글로벌 레이어를 합성합니다. */
+    float ResolveGlobalScale() const;
+
+    /**
+     * @brief 액터의 CustomTimeDilation을 합성합니다.
+     * @param Actor       대상 액터
+     * @param Team        등록 진영
+     * @param GlobalScale 적용된 글로벌 배율
+     * @param bOutTargeted Actor/Sphere 레이어가 이 액터를 직접 가리키면 true
+     */
+    float ResolveActorScale(const AActor* Actor, EKNTimeTeam Team, float GlobalScale, bool& bOutTargeted) const;
+
+    /** @brief 모든 레이어를 합성해 바뀐 값만 기록합니다. */
+    void Recompute();
+
+    /** @brief Freeze 레이어와 정지 집합을 비교해 새로 정지·해제할 액터만 처리합니다. */
+    void ApplyFreezeLayers();
+
+    /** @brief 액터와 컴포넌트의 켜져 있는 틱을 끄고 기록합니다. */
+    void SuspendTicks(AActor* Actor, FSuspendedTicks& OutRecord);
+
+    /** @brief 기록된 틱을 되돌립니다. */
+    static void ResumeTicks(const FSuspendedTicks& Record);
+
+    /** @brief 필드 대상 진영 후보의 위치를 다시 읽고, 셀이 바뀐 후보만 버킷을 옮깁니다. */
+    void RefreshSpatialHash();
+
+    /** @brief 진영 등록 액터를 필드 후보로 추가하거나, 이미 후보면 진영·종류만 갱신합니다. */
+    void AddFieldCandidate(AActor* Actor, FTrackedActor& Tracked);
+
+    /** @brief 후보를 해시와 목록에서 제거합니다. (마지막 후보를 빈 자리로 옮김) */
+    void RemoveFieldCandidate(int32 Index);
+
+    /** @brief 해시 버킷에서 후보 인덱스 하나를 제거합니다. */
+    void RemoveFromFieldCell(const FIntPoint& Cell, int32 Index);
+
+    /** @brief 모든 필드 레이어의 멤버를 해시로 질의하고 바뀐 필드만 반영합니다. */
+    void UpdateFields();
+
+    /** @brief 월드 위치의 해시 셀 좌표 */
+    FIntPoint GetFieldCell(const FVector& Location) const;
+
+    /** @brief 만료된 실시간 타이머를 실행합니다. */
+    void FireExpiredRealTimers();
+#pragma endregion 내부 헬퍼 함수
+
+#pragma region 런타임 상태
+private:
+    TArray<FLayer> Layers;
+    TMap<TWeakObjectPtr<AActor>, FTrackedActor> TrackedActors;
+    TArray<FRealTimer> RealTimers;
+    TMap<TWeakObjectPtr<AActor>, FSuspendedTicks> FrozenActors;
+
+    /** @brief 진영 등록 액터의 필드 후보와 셀 → 후보 인덱스 (등록·해제·셀 이동 시에만 변경) */
+    TArray<FFieldCandidate> FieldCandidates;
+    TMap<FIntPoint, TArray<int32>> SpatialHash;
+
+    /** @brief 필드별 새 멤버 집합을 모으는 작업 맵 (바뀐 필드는 멤버 맵과 교환하여 할당을 재사용) */
+    TMap<TWeakObjectPtr<AActor>, float> FieldScratchMembers;
+
+    /** @brief 마지막 필드 갱신 이후 흐른 실시간 */
+    float FieldAccumulator = 0.0f;
+
+    /** @brief 새 필드가 추가되어 다음 틱에 즉시 갱신해야 하는지 여부 */
+    bool bFieldUpdatePending = false;
+
+    int32 NextLayerId = 0;
+    uint32 NextTimerId = 0;
+
+    /** @brief 레이어가 바뀌어 다음 틱에 재계산이 필요한지 여부 */
+    bool bDirty = false;
+
+    float AppliedGlobalScale = 1.0f;
+    double RealTimeSeconds = 0.0;
+
+    FKNTimeDilationTickFunction TickFunction;
+    FKNTimeDilationStats Stats;
+#pragma endregion 런타임 상태
+};
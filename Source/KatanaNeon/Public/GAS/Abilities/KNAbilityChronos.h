@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbility.h"
 #include "Data/Structs/KNPlayerStatTable.h"
+#include "Framework/System/KNDataManagerSubsystem.h"
 #include "KNAbilityChronos.generated.h"
 
 #pragma region 전방 선언
@@ -12,6 +13,8 @@ class UKNChronosSphereComponent;
 class AKNCharacterBase;
 class UAbilitySystemComponent;
 class UGameplayEffect;
+class UKNStatsComponent;
+struct FOnAttributeChangeData;
 #pragma endregion 전방 선언
 
 /**
@@ -28,9 +31,14 @@ class UGameplayEffect;
  * - 최초 활성화 : State.Combat.ChronosActive 태그 부여 → 구체 콜리전 활성화 → 게이지 소모 시작
  * - 재활성화(토글 OFF) : 게이지 소모 중지 → 구체 비활성화 → 태그 제거 → EndAbility
  *
+ * [해석적 소모]
+ * - 소모는 (시작 시각, 초당 소모량)으로만 표현되며, 활성 중에는 GE를 적용하지 않습니다.
+ * - 잔량 / 소모량으로 고갈 시각을 1회 계산하여 단발 타이머로 자동 종료합니다.
+ * - 어트리뷰트는 종료(토글 OFF/취소/고갈) 시 ChronosDrainGEClass 1회 적용으로 확정합니다.
+ *
  * [SRP 책임 분리]
  * - 구체 범위 감속  : UKNChronosSphereComponent에 완전 위임
- * - 게이지 소모     : Instant GE 주기 적용
+ * - 게이지 소모     : UKNStatsComponent 해석적 소모 상태 + 종료 시 Instant GE 1회
  * - 어빌리티 생애   : ActivateAbility / EndAbility
  */
 UCLASS()
@@ -49,6 +57,14 @@ public:
 
 #pragma region GAS 핵심 오버라이드
 public:
+    /**
+     * @brief 어빌리티 부여 시 1회 호출.
+     * @details ChronosSettingRowHandle을 데이터 매니저 캐시의 정수 핸들로 해석해 두어 활성화 경로의 행 조회를 배열 인덱싱으로 만듭니다.
+     * @param ActorInfo 소유 액터 정보
+     * @param Spec      부여된 어빌리티 스펙
+     */
+    virtual void OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+
     /**
      * @brief 활성화 조건 검사.
      * @details 크로노스 게이지가 0보다 클 때, 또는 이미 활성화(토글 OFF 진행) 중일 때 허용합니다.
@@ -107,8 +123,8 @@ protected:
     FDataTableRowHandle ChronosSettingRowHandle;
 
     /**
-     * @brief 크로노스 게이지 주기 소모용 Instant GE 클래스 (에디터 할당).
-     * @details SetByCaller(Chronos, -소모량)으로 주기마다 적용됩니다.
+     * @brief 크로노스 게이지 소모 확정용 Instant GE 클래스 (에디터 할당).
+     * @details 종료 시 SetByCaller(Chronos, -총 소모량)으로 1회 적용됩니다.
      */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "KatanaNeon|Ability|Chronos|GAS")
     TSubclassOf<UGameplayEffect> ChronosDrainGEClass = nullptr;
@@ -119,8 +135,11 @@ private:
     /** @brief 현재 크로노스가 활성화 상태인지 여부 (토글 판별) */
     bool bIsChronosActive = false;
 
-    /** @brief 게이지 소모 주기 타이머 핸들 */
-    FTimerHandle DrainTimerHandle;
+    /** @brief 크로노스 고갈 시각에 1회 발동하는 자동 종료 타이머 핸들 */
+    FTimerHandle DepletionTimerHandle;
+
+    /** @brief 활성 중 외부 크로노스 증감을 감지하는 델리게이트 핸들 */
+    FDelegateHandle ChronosChangedHandle;
 
     /** @brief DataTable에서 로드한 설정 캐시 */
     FKNChronosSettingRow CachedSetting;
@@ -130,6 +149,12 @@ private:
      * @details 메모리 누수를 방지하기 위해 TWeakObjectPtr를 사용합니다.
      */
     TWeakObjectPtr<UKNChronosSphereComponent> WeakSphereComp = nullptr;
+
+    /** @brief 해석적 소모 상태를 보관하는 스탯 컴포넌트 약참조 */
+    TWeakObjectPtr<UKNStatsComponent> WeakStatsComp = nullptr;
+
+    /** @brief ChronosSettingRowHandle의 캐시 바인딩 (OnGiveAbility에서 1회 해석) */
+    TKNDataRowBinding<FKNChronosSettingRow> ChronosSettingRowBinding;
 #pragma endregion 런타임 상태
 
 #pragma region 내부 헬퍼 함수
@@ -147,10 +172,25 @@ private:
     bool ResolveSphereComponent();
 
     /**
-     * @brief 크로노스 게이지 소모 주기 타이머 콜백.
-     * @details DrainTickInterval마다 호출되어 게이지를 소모하고, 0 도달 시 어빌리티를 자동 종료합니다.
+     * @brief 현재 잔량 기준으로 고갈 시각을 계산하여 자동 종료 타이머를 (재)예약합니다.
+     */
+    void ScheduleDepletion();
+
+    /**
+     * @brief 누적 소모량을 계산해 ChronosDrainGEClass로 어트리뷰트에 1회 확정합니다.
+     */
+    void SettleChronosDrain();
+
+    /**
+     * @brief 고갈 시각 도달 시 호출되어 어빌리티를 자동 종료합니다.
      */
     UFUNCTION()
-    void OnDrainTick();
+    void OnChronosDepleted();
+
+    /**
+     * @brief 활성 중 크로노스 어트리뷰트가 외부 요인으로 바뀌면 고갈 시각을 다시 계산합니다.
+     * @param Data 변경된 어트리뷰트 정보
+     */
+    void OnChronosAttributeChanged(const FOnAttributeChangeData& Data);
 #pragma endregion 내부 헬퍼 함수
 };
@@ -5,11 +5,15 @@
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbility.h"
 #include "Data/Structs/KNPlayerStatTable.h"
+#include "GAS/System/KNComboGraph.h"
+#include "WorldCollision.h"
 #include "KNAbilityComboAttack.generated.h"
 
 #pragma region 전방 선언
 class UKNStatsComponent;
 class UAbilityTask_PlayMontageAndWait;
+class UKNAbilityTask_BladeSweep;
+class UStaticMeshComponent;
 #pragma endregion 전방 선언
 
 #pragma region 열거형 데이터
@@ -34,12 +38,26 @@ enum class EKNComboAttackType : uint8
  * [콤보 트리 – DataTable 행 키 규약]
  * - 약공격 : LightAttack_1 ~ LightAttack_5
  * - 강공격 : HeavyAttack_1 ~ HeavyAttack_5
+ * - 두 테이블은 어빌리티 부여(OnGiveAbility) 시 FKNComboGraph로 컴파일되며,
+ *   누락 행은 이때 로그로 보고됩니다. 런타임 단계 진행은 노드 인덱스 전이만 수행합니다.
  *
  * [입력 버퍼링 흐름]
  * - 비활성 상태 → TryActivate → ActivateAbility (1단계 시작)
  * - 활성 상태   → Controller가 BufferNextInput 직접 호출
  * - AN_ComboWindowOpen 도달 → 버퍼 확인 → 즉시 AdvanceCombo 또는 윈도우 오픈
  *
+ * [섹션 콤보 재생]
+ * - bUseSectionComboPlayback 이 켜져 있고 다음 행이 같은 몽타주의 MontageSectionName 을 가리키면
+ *   몽타주 태스크를 새로 만들지 않고 Montage_JumpToSection 으로 즉시 이어 붙입니다.
+ * - 재생 중인 섹션은 다음 섹션 링크를 끊어 두므로, 입력이 없으면 해당 섹션 끝에서 몽타주가 종료됩니다.
+ * - 몽타주가 다르거나 섹션이 없으면 기존처럼 단계별 새 태스크로 재생합니다.
+ *
+ * [히트박스 판정]
+ * - 매 단계 몽타주 재생과 함께 UKNAbilityTask_BladeSweep 을 가동합니다.
+ * - DT의 HitboxStartNormTime ~ HitboxEndNormTime 구간 동안 칼날을 프레임 간 보간 스윕합니다.
+ *   섹션 재생 시 정규화 시간은 해당 섹션 길이 기준입니다.
+ * - 적중 중복 제거는 스윙(단계) 단위로 유지됩니다.
+ *
  * [ComboWindowTime 의미]
  * - > 0.0f : 다음 입력 대기 창이 열림
  * - = 0.0f : 피니셔(Finisher) — Heavy 또는 Light 5단계 종료
@@ -77,6 +95,13 @@ public:
         const FGameplayTagContainer* TargetTags = nullptr,
         OUT FGameplayTagContainer* OptionalRelevantTags = nullptr) const override;
 
+    /**
+     * @brief 어빌리티 부여 시 콤보 테이블을 그래프로 컴파일합니다.
+     * @param ActorInfo 소유 액터 정보
+     * @param Spec      부여된 어빌리티 스펙
+     */
+    virtual void OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+
     /**
      * @brief 어빌리티 활성화.
      * @details 콤보 윈도우가 열려 있으면 다음 단계로 진행하고,
@@ -121,14 +146,15 @@ public:
 
     /**
      * @brief AnimNotify(HitboxOpen)에서 호출 — 히트박스 구체 판정을 실행합니다.
-     * @details CachedComboRow.DamageMultiplier × BaseDamage 의 데미지 GE를 적중 대상에게 적용합니다.
+     * @details 연속 스윕 태스크가 가동 중이면 판정은 태스크가 전담하므로 아무것도 하지 않습니다.
+     *          태스크를 띄울 수 없는 경우(소켓/애님 인스턴스 부재)에만 단발 스윕으로 대체합니다.
      */
     UFUNCTION(BlueprintCallable, Category = "KatanaNeon|Ability|Combo")
     void ActivateHitbox();
 
     /**
      * @brief AnimNotify(ComboWindowOpen)에서 호출 — 다음 입력 수신 창을 엽니다.
-     * @details CachedComboRow.ComboWindowTime 초 뒤에 창이 닫히고 어빌리티가 종료됩니다.
+     * @details CurrentComboRow->ComboWindowTime 초 뒤에 창이 닫히고 어빌리티가 종료됩니다.
      *          ComboWindowTime == 0.0f 이면 즉시 종료합니다.
      */
     UFUNCTION(BlueprintCallable, Category = "KatanaNeon|Ability|Combo")
@@ -168,8 +194,8 @@ protected:
     TObjectPtr<UDataTable> SheathComboDataTable = nullptr;
 
     /**
-     * @brief 히트박스 판정 시 적용할 데미지 Instant GE 클래스.
-     * @details SetByCaller(Health, -최종데미지)로 적용됩니다.
+     * @brief 히트박스 판정 시 적용할 데미지 Instant GE 클래스. (기본값: UKNDamageEffect)
+     * @details UKNDamageExecution 파이프라인 — SetByCaller(Damage.Base, Damage.Multiplier)로 적용됩니다.
      */
     UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Ability|Combo|GAS")
     TSubclassOf<UGameplayEffect> DamageGEClass = nullptr;
@@ -185,13 +211,54 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Ability|Combo|GAS")
     TSubclassOf<UGameplayEffect> StaminaCostGEClass = nullptr;
 
-    /** @brief 오버클럭 1단계 수치 행 핸들 (데미지 배율 조회용) */
+    /** @brief 오버클럭 1단계 수치 행 핸들 (데미지 배율 조회용, 부여 시 1회 조회) */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "KatanaNeon|Ability|Combo|Overclock")
     FDataTableRowHandle OverclockLv1RowHandle;
 
-    /** @brief 오버클럭 3단계 수치 행 핸들 (시간 정지 데미지 배율 조회용) */
+    /** @brief 오버클럭 3단계 수치 행 핸들 (시간 정지 데미지 배율 조회용, 부여 시 1회 조회) */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "KatanaNeon|Ability|Combo|Overclock")
     FDataTableRowHandle OverclockLv3RowHandle;
+
+    /**
+     * @brief 같은 몽타주 안의 섹션 점프로 콤보를 이어 붙일지 여부.
+     * @details 끄면 단계마다 몽타주를 처음부터 새 태스크로 재생합니다.
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Ability|Combo|Montage")
+    bool bUseSectionComboPlayback = true;
+
+    /** @brief 칼날 시작점(코등이) 소켓 이름 */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Ability|Combo|Hitbox")
+    FName BladeRootSocketName = TEXT("Socket_Blade_Root");
+
+    /** @brief 칼날 끝점 소켓 이름 */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Ability|Combo|Hitbox")
+    FName BladeTipSocketName = TEXT("Socket_Blade_Tip");
+
+    /** @brief 칼날 두께 — 스윕 구체 반경 (cm) */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Ability|Combo|Hitbox",
+        meta = (ClampMin = 1.0f))
+    float BladeSweepRadius = 8.0f;
+
+    /**
+     * @brief 서브스텝 1회당 허용되는 칼끝 최대 이동 거리 (cm).
+     * @details 구체 지름(반경 × 2) 이하로 두면 프레임 사이에 빈틈이 생기지 않습니다.
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Ability|Combo|Hitbox",
+        meta = (ClampMin = 1.0f))
+    float BladeSubStepDistance = 16.0f;
+
+    /** @brief 프레임당 최대 서브스텝 수 — 저프레임에서도 판정 비용 상한을 보장합니다. */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Ability|Combo|Hitbox",
+        meta = (ClampMin = 1, ClampMax = 16))
+    int32 MaxBladeSubStepsPerFrame = 6;
+
+    /**
+     * @brief 칼날 판정을 비동기 스윕(AsyncSweepByChannel)으로 수행할지 여부.
+     * @details 켜면 게임 스레드가 충돌 쿼리를 기다리지 않는 대신 적중이 최대 1프레임 늦게 처리됩니다.
+     *          다수의 적이 밀집한 구간에서 스윕 비용이 클 때 사용합니다.
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "KatanaNeon|Ability|Combo|Hitbox")
+    bool bUseAsyncBladeQueries = false;
 #pragma endregion 에디터 설정 데이터
 
 #pragma region 런타임 콤보 상태
@@ -200,6 +267,10 @@ private:
     UPROPERTY()
     TObjectPtr<UAbilityTask_PlayMontageAndWait> CurrentMontageTask = nullptr;
 
+    /** @brief 현재 스윙의 연속 칼날 스윕 태스크 (스윙 단위 중복 제거 보유) */
+    UPROPERTY()
+    TObjectPtr<UKNAbilityTask_BladeSweep> CurrentSweepTask = nullptr;
+
     /** @brief 현재 진행 중인 콤보 단계 (1 ~ 5, 0 = 비활성) */
     int32 CurrentComboStep = 0;
 
@@ -225,24 +296,38 @@ private:
     /** @brief 어빌리티 최대 지속 시간 안전망 타이머 — 모든 경로에서 EndAbility 미호출 시 강제 종료 */
     FTimerHandle SafetyTimerHandle;
 
-    /** @brief 현재 단계의 DataTable 데이터 캐시 */
-    FKNComboAttackRow CachedComboRow;
+    /**
+     * @brief 발도/납도 콤보 테이블을 컴파일한 상태 그래프.
+     * @details const 경로(CanActivateAbility)에서도 지연 컴파일할 수 있도록 mutable입니다.
+     */
+    mutable FKNComboGraph ComboGraph;
+
+    /** @brief 현재 진행 중인 콤보 그래프 노드 (INDEX_NONE = 비활성) */
+    int32 CurrentComboNode = INDEX_NONE;
+
+    /** @brief 현재 노드의 행 데이터 (ComboGraph 소유, 복사 없음) */
+    const FKNComboAttackRow* CurrentComboRow = nullptr;
 
     /** @brief 콤보 윈도우가 열리기 전에 입력이 들어왔을 때 버퍼링합니다. */
     bool bInputBuffered = false;
 
     /** @brief 버퍼링된 입력이 Heavy인지 여부 */
     bool bBufferedInputIsHeavy = false;
+
+    /** @brief 전술 오버클럭(Lv1) 데미지 배율 (OnGiveAbility에서 행 캐싱) */
+    float TacticalDamageMultiplier = 1.0f;
+
+    /** @brief 시간 정지(Lv3) 중 데미지 배율 (OnGiveAbility에서 행 캐싱) */
+    float FrozenDamageMultiplier = 1.0f;
 #pragma endregion 런타임 콤보 상태
 
 #pragma region 내부 헬퍼 함수
 private:
     /**
-     * @brief 현재 스탠스에 해당하는 DataTable을 반환합니다.
-     * @param bDrawn 발도 여부 (true = DrawnComboDataTable, false = SheathComboDataTable)
-     * @return 해당 DataTable 포인터, 미할당 시 nullptr
+     * @brief 컴파일된 콤보 그래프를 반환합니다. 아직 컴파일되지 않았다면 지금 컴파일합니다.
+     * @return 콤보 그래프
      */
-    UDataTable* GetComboDataTable(bool bDrawn) const;
+    const FKNComboGraph& GetComboGraph() const;
 
     /**
      * @brief 현재 ASC의 WeaponDrawn 태그 유무로 발도 상태를 판별합니다.
@@ -252,19 +337,11 @@ private:
     bool IsWeaponDrawn(const FGameplayAbilityActorInfo* ActorInfo) const;
 
     /**
-     * @brief 단계·타입에서 DataTable 행 이름을 생성합니다.
-     * @param Step       콤보 단계 (1 ~ 5)
-     * @param AttackType 공격 타입 (EKNComboAttackType::Light 또는 Heavy)
-     * @return "LightAttack_N" 또는 "HeavyAttack_N" 형태의 FName
+     * @brief 콤보 그래프 노드로 진입하여 단계·타입·행 포인터를 갱신합니다.
+     * @param NodeIndex 진입할 노드 (GetEntryNode / GetNextNode 결과)
+     * @return 유효한 노드이면 true
      */
-    FName MakeComboRowName(int32 Step, EKNComboAttackType AttackType) const;
-
-    /**
-     * @brief DataTable에서 지정 행을 읽어 CachedComboRow에 저장합니다.
-     * @param RowName 조회할 행 이름
-     * @return 로드 성공 여부
-     */
-    bool LoadComboRow(const FName& RowName);
+    bool EnterComboNode(int32 NodeIndex);
 
     /**
      * @brief 현재 캐시된 StaminaCost만큼 스태미나를 GE로 즉시 소모합니다.
@@ -273,12 +350,73 @@ private:
     bool ConsumeStamina();
 
     /**
-     * @brief CachedComboRow.ComboMontage를 PlayMontageAndWait Task로 재생합니다.
+     * @brief 현재 오버클럭 상태로 공격자 측 데미지 배율(전술 × 시간 정지)을 구합니다.
+     * @details 피격마다 캐시된 상태 비트로 계산하므로 콤보 도중의 상태 변화도 다음 타격부터 반영됩니다.
+     * @param ASC 공격자 ASC
+     * @return 공격자 측 데미지 배율
+     */
+    float GetAttackerDamageMultiplier(const UAbilitySystemComponent* ASC) const;
+
+    /**
+     * @brief CurrentComboRow->ComboMontage를 PlayMontageAndWait Task로 재생합니다.
      *        PlayRate는 DT의 PlayRate × AttributeSet.AttackSpeed 로 계산합니다.
      * @return Task 생성 성공 여부
      */
     bool PlayComboMontage();
 
+    /**
+     * @brief 재생 중인 콤보 몽타주 태스크를 유지한 채 지정 섹션으로 점프합니다.
+     * @param Montage  다음 단계 몽타주 (현재 재생 중인 몽타주와 같아야 함)
+     * @param Section  점프할 섹션 이름
+     * @param PlayRate 다음 단계 재생 배율
+     * @return 점프에 성공하면 true, 새 태스크가 필요하면 false
+     */
+    bool TryJumpToComboSection(UAnimMontage* Montage, FName Section, float PlayRate);
+
+    /**
+     * @brief 아바타의 카타나 메시를 반환합니다.
+     * @return 카타나 스태틱 메시, 없으면 nullptr
+     */
+    UStaticMeshComponent* GetWeaponMesh() const;
+
+    /**
+     * @brief 이번 스윙의 연속 칼날 스윕 태스크를 가동합니다. 이전 스윙 태스크는 종료합니다.
+     * @param Montage 판정 구간의 기준이 되는 몽타주
+     * @param Section 정규화 기준 섹션 (NAME_None = 몽타주 전체)
+     */
+    void StartBladeSweep(UAnimMontage* Montage, FName Section);
+
+    /** @brief 진행 중인 칼날 스윕 태스크를 종료합니다. */
+    void StopBladeSweep();
+
+    /**
+     * @brief 적중 1건의 데미지 GE, 오버클럭 획득, 적중 VFX를 피격 큐(UKNHitQueueSubsystem)에 등록합니다.
+     * @param Hit 스윙 내 최초 적중 결과
+     */
+    UFUNCTION()
+    void OnBladeHit(const FHitResult& Hit);
+
+    /**
+     * @brief 노티파이 단발 판정 결과에서 액터당 1회씩 OnBladeHit을 호출합니다.
+     * @param HitResults 스윕 결과
+     */
+    void ResolveHitboxResults(TConstArrayView<FHitResult> HitResults);
+
+    /**
+     * @brief 노티파이 단발 판정의 비동기 스윕 결과 수신 콜백입니다. (다음 프레임)
+     * @param TraceHandle 트레이스 핸들
+     * @param TraceDatum  스윕 요청 및 결과
+     */
+    void OnAsyncHitboxSweepCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+    /**
+     * @brief 판정 구간 진입 시 칼날 중간 위치에 SlashVFX를 스폰합니다.
+     * @param BladeRoot 칼날 시작점
+     * @param BladeTip  칼날 끝점
+     */
+    UFUNCTION()
+    void OnBladeWindowOpened(FVector BladeRoot, FVector BladeTip);
+
     /** @brief 다음 단계로 진행하거나, 최종 단계면 어빌리티를 종료합니다. */
     void AdvanceCombo();
 
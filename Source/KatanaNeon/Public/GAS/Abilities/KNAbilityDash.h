@@ -6,6 +6,7 @@
 #include "Abilities/GameplayAbility.h"
 #include "Engine/DataTable.h"
 #include "Data/Structs/KNPlayerStatTable.h"
+#include "Framework/System/KNDataManagerSubsystem.h"
 #include "KNAbilityDash.generated.h"
 
 #pragma region 전방 선언
@@ -48,6 +49,14 @@ public:
 
 #pragma region GAS 핵심 오버라이드
 public:
+    /**
+     * @brief 어빌리티 부여 시 1회 호출.
+     * @details ActionCostRowHandle을 데이터 매니저 캐시의 정수 핸들로 해석해 두어 활성화 경로의 행 조회를 배열 인덱싱으로 만듭니다.
+     * @param ActorInfo 소유 액터 정보
+     * @param Spec      부여된 어빌리티 스펙
+     */
+    virtual void OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+
     /**
      * @brief 활성화 조건 검사.
      * @details 지정된 액션 비용 이상의 스태미나가 있을 때만 허용합니다.
@@ -143,6 +152,9 @@ private:
 
     /** @brief 대시 몽타주 재생 중 여부 — 몽타주 종료 전까지 EndAbility를 지연시킵니다. */
     bool bIsDashMontageActive = false;
+
+    /** @brief ActionCostRowHandle의 캐시 바인딩 (OnGiveAbility에서 1회 해석) */
+    TKNDataRowBinding<FKNActionCostRow> ActionCostRowBinding;
 #pragma endregion 런타임 상태
 
 #pragma region 내부 헬퍼 함수
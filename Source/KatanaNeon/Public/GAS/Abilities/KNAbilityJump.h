@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbility.h"
 #include "Data/Structs/KNPlayerStatTable.h"
+#include "Framework/System/KNDataManagerSubsystem.h"
 #include "KNAbilityJump.generated.h"
 
 #pragma region 전방 선언
@@ -44,6 +45,14 @@ public:
 
 #pragma region GAS 핵심 오버라이드
 public:
+    /**
+     * @brief 어빌리티 부여 시 1회 호출.
+     * @details JumpSettingRowHandle을 데이터 매니저 캐시의 정수 핸들로 해석해 두어 활성화 경로의 행 조회를 배열 인덱싱으로 만듭니다.
+     * @param ActorInfo 소유 액터 정보
+     * @param Spec      부여된 어빌리티 스펙
+     */
+    virtual void OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+
     /**
      * @brief 활성화 조건 검사. 지상 점프 또는 (공중 + 더블 점프 가능) 상태일 때 허용합니다.
      * @param Handle               어빌리티 스펙 핸들
@@ -116,6 +125,9 @@ private:
 
     /** @brief 어빌리티 실행 중 비용 처리를 위해 로드 성공 여부를 추적합니다. */
     bool bSettingLoaded = false;
+
+    /** @brief JumpSettingRowHandle의 캐시 바인딩 (OnGiveAbility에서 1회 해석) */
+    TKNDataRowBinding<FKNJumpSettingRow> JumpSettingRowBinding;
 #pragma endregion 런타임 상태
 
 #pragma region 내부 헬퍼 함수
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbility.h"
 #include "Data/Structs/KNPlayerStatTable.h"
+#include "Framework/System/KNDataManagerSubsystem.h"
 #include "KNAbilityOverclockLv1.generated.h"
 
 #pragma region 전방 선언
@@ -52,6 +53,14 @@ public:
 
 #pragma region GAS 핵심 오버라이드
 public:
+    /**
+     * @brief 어빌리티 부여 시 1회 호출.
+     * @details Lv1SettingRowHandle을 데이터 매니저 캐시의 정수 핸들로 해석해 두어 활성화 경로의 행 조회를 배열 인덱싱으로 만듭니다.
+     * @param ActorInfo 소유 액터 정보
+     * @param Spec      부여된 어빌리티 스펙
+     */
+    virtual void OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+
     /**
      * @brief 전술 강화 어빌리티 활성화.
      * @details 오버클럭 소모 → 상태 태그 부여 → Duration GE 적용 → 타이머 설정 순으로 진행합니다.
@@ -109,6 +118,9 @@ private:
 
     /** @brief DataTable에서 읽어와 런타임에 캐싱한 Lv1 설정 데이터 */
     FKNOverclockLv1Row CachedSetting;
+
+    /** @brief Lv1SettingRowHandle의 캐시 바인딩 (OnGiveAbility에서 1회 해석) */
+    TKNDataRowBinding<FKNOverclockLv1Row> Lv1SettingRowBinding;
 #pragma endregion 런타임 상태
 
 #pragma region 내부 헬퍼 함수
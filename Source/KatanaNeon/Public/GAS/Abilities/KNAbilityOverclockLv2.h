@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbility.h"
 #include "Data/Structs/KNPlayerStatTable.h"
+#include "Framework/System/KNDataManagerSubsystem.h"
 #include "KNAbilityOverclockLv2.generated.h"
 
 #pragma region 전방 선언
@@ -28,11 +29,12 @@ class UGameplayEffect;
  *
  * [참격파 발사 흐름]
  * 1. ActivateAbility: 오버클럭 소모 → 발동 몽타주 재생 (PlayMontageAndWait Task)
- * 2. 몽타주 실행 중 AnimNotify "SlashRelease" 수신 → 참격파(AKNSlashProjectile) 스폰
- * 3. AKNSlashProjectile이 이동/피격 처리를 전담 (SRP 준수)
+ * 2. 몽타주 실행 중 AnimNotify "SlashRelease" 수신 → UKNActorPoolSubsystem에서 AKNSlashProjectile을 꺼내 발사
+ *    (bUseProjectileManager를 켜면 UKNProjectileSubsystem의 관리형 발사체로 발사)
+ * 3. 발사체 서브시스템(또는 AKNSlashProjectile)이 이동/피격 처리를 전담 (SRP 준수)
  *
  * [SRP 책임 분리]
- * - 참격파 로직     : AKNSlashProjectile에 완전 위임
+ * - 참격파 로직     : UKNProjectileSubsystem / AKNSlashProjectile에 완전 위임
  * - 오버클럭 소모   : KNStatsComponent::ConsumeOverclockLevel(2) 위임
  * - 수치/에셋 관리  : DT_OverclockLv2Setting DataTable
  */
@@ -52,6 +54,13 @@ public:
 
 #pragma region GAS 핵심 오버라이드
 public:
+    /**
+     * @brief 어빌리티 부여 시 참격파 액터 풀을 DataTable 크기만큼 미리 채웁니다.
+     * @param ActorInfo 소유 액터 정보
+     * @param Spec      부여된 어빌리티 스펙
+     */
+    virtual void OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+
     /**
      * @brief 참격파 어빌리티 활성화.
      * @details 오버클럭 소모 → 몽타주 재생 태스크 실행 순으로 진행합니다.
@@ -106,11 +115,23 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "KatanaNeon|Ability|OverclockLv2|Montage")
     TObjectPtr<UAnimMontage> SlashMontage_Sheath = nullptr;
 
-    /** @brief 발사할 참격파 블루프린트 클래스 (에디터 할당) */
+    /**
+     * @brief 참격파를 액터 대신 UKNProjectileSubsystem의 관리형 발사체로 쏠지 여부.
+     * @details 관리형 참격파는 SlashWaveFX로만 보이므로, 이펙트를 지정한 블루프린트에서만 켭니다.
+     *          꺼져 있으면(기본) SlashProjectileClass 액터를 풀에서 꺼내는 경로를 사용합니다.
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "KatanaNeon|Ability|OverclockLv2|Projectile")
+    bool bUseProjectileManager = false;
+
+    /** @brief 관리형 참격파가 화면에 보일 때 바인딩되는 루프 Niagara 이펙트 */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "KatanaNeon|Ability|OverclockLv2|Projectile", meta = (EditCondition = "bUseProjectileManager"))
+    TObjectPtr<UNiagaraSystem> SlashWaveFX = nullptr;
+
+    /** @brief 발사할 참격파 블루프린트 클래스 (bUseProjectileManager가 꺼져 있을 때 사용) */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "KatanaNeon|Ability|OverclockLv2|Projectile")
     TSubclassOf<AKNSlashProjectile> SlashProjectileClass = nullptr;
 
-    /** @brief 피격 시 즉시 적용할 데미지 Instant GE 클래스 */
+    /** @brief 피격 시 즉시 적용할 데미지 Instant GE 클래스 (기본값: UKNDamageEffect) */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "KatanaNeon|Ability|OverclockLv2|GAS")
     TSubclassOf<UGameplayEffect> SlashDamageGEClass = nullptr;
 
@@ -130,6 +151,9 @@ private:
 
     /** @brief AnimNotify가 여러 번 호출되어 참격파가 중복 발사되는 것을 막는 안전장치 */
     bool bSlashReleased = false;
+
+    /** @brief Lv2SettingRowHandle의 캐시 바인딩 (OnGiveAbility에서 1회 해석) */
+    TKNDataRowBinding<FKNOverclockLv2Row> Lv2SettingRowBinding;
 #pragma endregion 런타임 상태
 
 #pragma region 내부 헬퍼 함수
@@ -5,12 +5,13 @@
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbility.h"
 #include "Data/Structs/KNPlayerStatTable.h"
+#include "Framework/System/KNDataManagerSubsystem.h"
+#include "Framework/System/KNTimeDilationSubsystem.h"
 #include "KNAbilityOverclockLv3.generated.h"
 
 #pragma region 전방 선언
 class UAnimMontage;
 class UNiagaraSystem;
-class AWorldSettings;
 class AKNCharacterBase;
 class UKNStatsComponent;
 class UAbilitySystemComponent;
@@ -28,10 +29,10 @@ class UAbilitySystemComponent;
  *
  * [시간 정지 흐름]
  * 1. 오버클럭 포인트 소모 → 몽타주 및 이펙트 재생
- * 2. GlobalTimeDilation = WorldTimeDilationScale (≈0.0001) → 월드 거의 정지
- * 3. 플레이어 CustomTimeDilation = 1.0 / WorldTimeDilationScale → 플레이어만 정상 속도 유지
+ * 2. 시간 서브시스템 글로벌 레이어 = WorldTimeDilationScale (≈0.0001) → 월드 거의 정지
+ * 3. 플레이어 실시간 레이어 → 플레이어만 정상 속도 유지, 적 진영 Freeze 레이어 → 적 틱 정지
  * 4. State.Combat.WorldTimeFrozen 태그 부여
- * 5. TimeStopDuration 경과 → 자동 해제 → EndAbility
+ * 5. 실시간 TimeStopDuration 경과 → 자동 해제 → EndAbility
  *
  * [정지 중 공격 처리 (SRP 준수)]
  * - 데미지 배율 적용은 이 클래스가 아닌, ComboAttack 어빌리티가 GetFrozenDamageMultiplier()를
@@ -53,6 +54,14 @@ public:
 
 #pragma region GAS 핵심 오버라이드
 public:
+    /**
+     * @brief 어빌리티 부여 시 1회 호출.
+     * @details Lv3SettingRowHandle을 데이터 매니저 캐시의 정수 핸들로 해석해 두어 활성화 경로의 행 조회를 배열 인덱싱으로 만듭니다.
+     * @param ActorInfo 소유 액터 정보
+     * @param Spec      부여된 어빌리티 스펙
+     */
+    virtual void OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+
     /**
      * @brief 시간 정지 궁극기 발동.
      * @details 오버클럭 소모 → 발동 연출 → 시간 배율 설정 → 자동 해제 타이머를 가동합니다.
@@ -106,14 +115,26 @@ protected:
 
 #pragma region 런타임 상태
 private:
-    /** @brief 시간 정지 자동 해제 타이머 핸들 */
-    FTimerHandle TimeStopTimerHandle;
+    /** @brief 시간 정지 자동 해제 타이머 핸들 (실시간 시계) */
+    FKNRealTimerHandle TimeStopTimerHandle;
+
+    /** @brief 시간 정지 월드 감속 레이어 */
+    FKNTimeLayerHandle TimeStopGlobalLayer;
+
+    /** @brief 시간 정지 중 플레이어 실시간 레이어 */
+    FKNTimeLayerHandle TimeStopPlayerLayer;
+
+    /** @brief 시간 정지 중 적 진영 틱 정지 레이어 */
+    FKNTimeLayerHandle TimeStopFreezeLayer;
 
     /** @brief 현재 시간 정지 중인지 여부 */
     bool bIsTimeStopped = false;
 
     /** @brief DataTable에서 읽어와 런타임에 캐싱한 Lv3 설정 데이터 */
     FKNOverclockLv3Row CachedSetting;
+
+    /** @brief Lv3SettingRowHandle의 캐시 바인딩 (OnGiveAbility에서 1회 해석) */
+    TKNDataRowBinding<FKNOverclockLv3Row> Lv3SettingRowBinding;
 #pragma endregion 런타임 상태
 
 #pragma region 내부 헬퍼 함수
@@ -130,11 +151,8 @@ private:
      */
     bool ConsumeOverclockLevel();
 
-    /**
-     * @brief GlobalTimeDilation과 플레이어 CustomTimeDilation을 동시에 설정합니다.
-     * @param WorldScale GlobalTimeDilation에 적용할 배율
-     */
-    void ApplyTimeDilation(float WorldScale);
+    /** @brief 시간 정지 레이어를 제거합니다. (중복 호출 안전) */
+    void ReleaseTimeStopLayers();
 
     /**
      * @brief 시간 정지를 활성화합니다 (배율 적용 → 태그 부여 → 타이머 설정).
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbility.h"
 #include "Data/Structs/KNPlayerStatTable.h"
+#include "Framework/System/KNDataManagerSubsystem.h"
+#include "Framework/System/KNTimeDilationSubsystem.h"
 #include "KNAbilityParry.generated.h"
 
 #pragma region 전방 선언
@@ -42,6 +44,14 @@ public:
 
 #pragma region GAS 핵심 오버라이드
 public:
+    /**
+     * @brief 어빌리티 부여 시 1회 호출.
+     * @details ActionCostRowHandle, OverclockSettingRowHandle을 데이터 매니저 캐시의 정수 핸들로 해석해 두어 활성화 경로의 행 조회를 배열 인덱싱으로 만듭니다.
+     * @param ActorInfo 소유 액터 정보
+     * @param Spec      부여된 어빌리티 스펙
+     */
+    virtual void OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+
     /**
      * @brief 활성화 조건 검사.
      * @details DT_ActionCost.ParryStaminaCost (= 15) 이상 스태미나가 있어야 합니다.
@@ -130,6 +140,18 @@ private:
 
     /** @brief 현재 FlurryRush 상태인지 여부 */
     bool bIsFlurryRush = false;
+
+    /** @brief FlurryRush 월드 감속 레이어 */
+    FKNTimeLayerHandle FlurryGlobalLayer;
+
+    /** @brief FlurryRush 중 플레이어 실시간 레이어 */
+    FKNTimeLayerHandle FlurryPlayerLayer;
+
+    /** @brief ActionCostRowHandle의 캐시 바인딩 (OnGiveAbility에서 1회 해석) */
+    TKNDataRowBinding<FKNActionCostRow> ActionCostRowBinding;
+
+    /** @brief OverclockSettingRowHandle의 캐시 바인딩 (OnGiveAbility에서 1회 해석) */
+    TKNDataRowBinding<FKNOverclockSettingRow> OverclockSettingRowBinding;
 #pragma endregion 런타임 상태
 
 #pragma region 내부 헬퍼 함수
@@ -148,11 +170,14 @@ private:
 
     /**
      * @brief FlurryRush 슬로우 모션을 활성화합니다.
-     * @details GlobalTimeDilation = FlurrySlowMotionScale,
-     *          Player.CustomTimeDilation = 1.0 / FlurrySlowMotionScale
+     * @details 시간 서브시스템에 글로벌 레이어(FlurrySlowMotionScale)와
+     *          플레이어 실시간 레이어(1.0)를 추가합니다.
      */
     void ActivateFlurryRushSlowMotion();
 
+    /** @brief FlurryRush 시간 레이어를 제거합니다. (중복 호출 안전) */
+    void ReleaseFlurryRushSlowMotion();
+
     /**
      * @brief FlurryRush 슬로우 모션을 해제하고 어빌리티를 종료합니다.
      */
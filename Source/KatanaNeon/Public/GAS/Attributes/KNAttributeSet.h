@@ -14,6 +14,28 @@
 struct FGameplayEffectModCallbackData;
 #pragma endregion 전방 선언
 
+#pragma region 어트리뷰트 목록 (X-매크로)
+/**
+ * @brief UKNAttributeSet 어트리뷰트 전체 목록입니다.
+ * @details 각 항목은 동일한 이름의 FGameplayAttributeData 프로퍼티와
+ * KatanaNeon::Data::Stats 네이티브 태그 쌍을 의미합니다.
+ * 어트리뷰트를 추가할 때는 UPROPERTY + ATTRIBUTE_ACCESSORS 선언과 함께 이 목록에 한 줄을 추가합니다.
+ * FKNGASAttributeCache가 이 목록으로 컴파일 타임 인덱스 표를 생성합니다.
+ */
+#define KN_ATTRIBUTE_LIST(X) \
+    X(Health) \
+    X(MaxHealth) \
+    X(MovementSpeed) \
+    X(Stamina) \
+    X(MaxStamina) \
+    X(StaminaRegenRate) \
+    X(Chronos) \
+    X(MaxChronos) \
+    X(OverclockPoint) \
+    X(MaxOverclockPoint) \
+    X(AttackSpeed)
+#pragma endregion 어트리뷰트 목록 (X-매크로)
+
 /**
  * @class UKNAttributeSet
  * @brief KatanaNeon 프로젝트 캐릭터의 핵심 전투 및 생존 스탯을 관리하는 어트리뷰트 셋입니다.
@@ -39,6 +61,15 @@ public:
      */
     virtual void PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue) override;
 
+    /**
+     * @brief GameplayEffect가 어트리뷰트에 적용되기 직전에 호출됩니다.
+     * @details Stamina/OverclockPoint 대상 Additive GE이면 UKNStatsComponent에 누적된 해석적 회복·감소분을
+     *          GE 수치에 합산하여, 증감량이 최신 값 기준으로 적용되도록 합니다. (스탯 컴포넌트는 ASC 캐시로 조회)
+     * @param Data 적용될 GameplayEffect에 대한 상세 데이터
+     * @return false를 반환하면 해당 Modifier 적용이 취소됩니다.
+     */
+    virtual bool PreGameplayEffectExecute(FGameplayEffectModCallbackData& Data) override;
+
     /**
      * @brief GameplayEffect가 적용되어 어트리뷰트 값이 최종 변경된 후 호출되는 후처리 콜백입니다.
      * @param Data 적용된 GameplayEffect에 대한 상세 데이터
@@ -0,0 +1,137 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystemComponent.h"
+#include "GAS/System/KNStateTagBits.h"
+#include "GAS/System/KNEffectSpecCache.h"
+#include "KNAbilitySystemComponent.generated.h"
+
+#pragma region 전방 선언
+class UKNStatsComponent;
+#pragma endregion 전방 선언
+
+/**
+ * @file    KNAbilitySystemComponent.h
+ * @class   UKNAbilitySystemComponent
+ * @brief   KatanaNeon::State 태그 보유 상태를 비트셋으로 미러링하는 프로젝트 전용 ASC입니다.
+ * @details 태그 카운트가 0 ↔ 1 이상으로 바뀔 때마다 엔진이 호출하는 OnTagUpdated에서 비트를 갱신하므로,
+ *          Loose 태그와 GE 부여 태그 모두 동일하게 추적됩니다.
+ *          핫 패스의 상태 검사는 HasMatchingGameplayTag 대신 HasState(단일 비트 검사)를 사용합니다.
+ *          Instant GE 스펙은 MakePooledSpec으로 (GE 클래스, 레벨)별 템플릿을 재사용합니다.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class KATANANEON_API UKNAbilitySystemComponent : public UAbilitySystemComponent
+{
+    GENERATED_BODY()
+
+#pragma region 상태 태그 조회 및 조작
+public:
+    /** @brief 상태 태그 보유 여부를 단일 비트 검사로 반환합니다. */
+    bool HasStateTag(EKNStateTag Tag) const { return StateBits.Has(Tag); }
+
+    /**
+     * @brief 상태 태그를 Loose로 부여합니다. 비트는 OnTagUpdated에서 같은 호출 안에 갱신됩니다.
+     * @param Tag 부여할 상태 태그
+     */
+    void AddStateTag(EKNStateTag Tag);
+
+    /**
+     * @brief 상태 태그를 보유 중일 때만 Loose 태그를 제거합니다. (비트 검사 + 제거를 한 번에 수행)
+     * @param Tag 제거할 상태 태그
+     */
+    void RemoveStateTag(EKNStateTag Tag);
+
+    /**
+     * @brief 임의 ASC에 대한 상태 태그 조회입니다.
+     * @details UKNAbilitySystemComponent면 비트 검사, 아니면 HasMatchingGameplayTag로 대체합니다.
+     * @param InASC 조회 대상 ASC (nullptr이면 false)
+     * @param Tag   조회할 상태 태그
+     * @return 보유 중이면 true
+     */
+    static bool HasState(const UAbilitySystemComponent* InASC, EKNStateTag Tag);
+
+    /**
+     * @brief 임의 ASC에 상태 태그를 Loose로 부여합니다.
+     * @param InASC 대상 ASC (nullptr이면 무시)
+     * @param Tag   부여할 상태 태그
+     */
+    static void AddState(UAbilitySystemComponent* InASC, EKNStateTag Tag);
+
+    /**
+     * @brief 임의 ASC에서 상태 태그를 보유 중일 때만 제거합니다.
+     * @param InASC 대상 ASC (nullptr이면 무시)
+     * @param Tag   제거할 상태 태그
+     */
+    static void RemoveState(UAbilitySystemComponent* InASC, EKNStateTag Tag);
+#pragma endregion 상태 태그 조회 및 조작
+
+#pragma region GE 스펙 캐시
+public:
+    /**
+     * @brief 임의 ASC에서 적용 준비가 끝난 GE 스펙을 얻습니다.
+     * @details UKNAbilitySystemComponent면 스펙 캐시를 사용하고, 아니면 MakeEffectContext + MakeOutgoingSpec으로 대체합니다.
+     *          반환된 스펙에는 SetByCaller 값이 없으므로 호출자가 필요한 값을 다시 설정해야 합니다.
+     * @param InASC        스펙의 소스 ASC (nullptr이면 무효 핸들)
+     * @param EffectClass  GE 클래스
+     * @param Level        GE 레벨
+     * @param Instigator   인스티게이터 (nullptr이면 ASC의 OwnerActor)
+     * @param EffectCauser 이펙트 유발자 (nullptr이면 ASC의 AvatarActor)
+     * @return 스펙 핸들
+     */
+    static FGameplayEffectSpecHandle MakePooledSpec(
+        UAbilitySystemComponent* InASC,
+        TSubclassOf<UGameplayEffect> EffectClass,
+        float Level = 1.0f,
+        AActor* Instigator = nullptr,
+        AActor* EffectCauser = nullptr);
+
+    /** @brief 스펙 캐시 생성/재사용 카운터 */
+    const FKNEffectSpecCacheStats& GetSpecCacheStats() const { return SpecCache.GetStats(); }
+
+    /** @brief 스펙 캐시 카운터를 0으로 되돌립니다. */
+    void ResetSpecCacheStats() { SpecCache.ResetStats(); }
+#pragma endregion GE 스펙 캐시
+
+#pragma region 스탯 컴포넌트 캐시
+public:
+    /**
+     * @brief 이 ASC를 사용하는 스탯 컴포넌트를 등록합니다. (UKNStatsComponent::InitializeStatComponent에서 1회 호출)
+     * @param InStats 스탯 컴포넌트
+     */
+    void SetStatsComponent(UKNStatsComponent* InStats) { StatsComponent = InStats; }
+
+    /** @brief 등록된 스탯 컴포넌트 (없으면 nullptr) */
+    UKNStatsComponent* GetStatsComponent() const { return StatsComponent.Get(); }
+
+    /**
+     * @brief 임의 ASC에 등록된 스탯 컴포넌트를 조회합니다. (컴포넌트 탐색 없음)
+     * @param InASC 조회 대상 ASC
+     * @return UKNAbilitySystemComponent에 등록된 스탯 컴포넌트, 없으면 nullptr
+     */
+    static UKNStatsComponent* GetStats(const UAbilitySystemComponent* InASC);
+#pragma endregion 스탯 컴포넌트 캐시
+
+#pragma region GAS 핵심 오버라이드
+protected:
+    /**
+     * @brief 태그의 명시적 카운트가 0 ↔ 1 이상으로 바뀔 때 호출되어 비트셋을 갱신합니다.
+     * @param Tag       변경된 태그
+     * @param TagExists 변경 후 보유 여부
+     */
+    virtual void OnTagUpdated(const FGameplayTag& Tag, bool TagExists) override;
+#pragma endregion GAS 핵심 오버라이드
+
+#pragma region 런타임 상태
+private:
+    /** @brief KN_STATE_TAG_LIST 태그의 보유 여부 미러 */
+    FKNStateTagBits StateBits;
+
+    /** @brief Instant GE 스펙 템플릿 및 컨텍스트 풀 */
+    FKNEffectSpecCache SpecCache;
+
+    /** @brief 해석적 스태미나·오버클럭 값을 가진 스탯 컴포넌트 (어트리뷰트 셋·비용 검사용 캐시) */
+    TWeakObjectPtr<UKNStatsComponent> StatsComponent;
+#pragma endregion 런타임 상태
+};
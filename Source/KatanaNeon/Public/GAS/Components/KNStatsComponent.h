@@ -8,6 +8,7 @@
 #include "GameplayTagContainer.h"
 #include "Engine/DataTable.h"
 #include "Data/Structs/KNPlayerStatTable.h"
+#include "GAS/System/KNOverclockMeter.h"
 #include "KNStatsComponent.generated.h"
 
 /**
@@ -141,13 +142,111 @@ public:
 public:
     /**
      * @brief 현재 플레이어가 도달한 오버클럭 레벨(0~3)을 반환합니다.
-     * @details 하드코딩된 포인트 연산 대신, 부여된 네이티브 GameplayTag를 기반으로 O(1) 속도로 검사합니다.
+     * @details 임계값 돌파 시에만 갱신되는 FKNOverclockMeter의 캐시 레벨을 반환합니다. (태그 조회 없음)
      * @return 현재 오버클럭 레벨 (0, 1, 2, 3)
      */
     UFUNCTION(BlueprintCallable, Category = "KatanaNeon|Overclock")
     int32 GetCurrentOverclockLevel() const;
+
+    /**
+     * @brief 전투 이탈 감소분을 반영한 현재 오버클럭 포인트를 계산하여 반환합니다.
+     * @return 현재 유효 오버클럭 포인트
+     */
+    UFUNCTION(BlueprintCallable, Category = "KatanaNeon|Overclock")
+    float GetCurrentOverclockPoint() const;
+
+    /** @brief 오버클럭 포인트가 전투 이탈로 감소 중인지 여부 */
+    UFUNCTION(BlueprintCallable, Category = "KatanaNeon|Overclock")
+    bool IsOverclockDecaying() const;
+
+    /**
+     * @brief 누적된 오버클럭 감소분을 어트리뷰트에 확정 반영합니다.
+     * @details 레벨 임계값 하향 돌파 시점에만 호출됩니다. (GE 실행 중에는 FoldPendingOverclockDecay 사용)
+     */
+    void CommitOverclockDecay();
+
+    /**
+     * @brief 실행 중인 오버클럭 Additive GE 수치에 아직 반영되지 않은 감소분을 합산합니다.
+     * @details KNAttributeSet::PreGameplayEffectExecute 전용입니다. BaseValue를 직접 쓰지 않으므로 GE 실행 중에도 재진입이 없습니다.
+     * @param Magnitude GE의 원래 Additive 수치
+     * @return 감소분을 합산한 수치
+     */
+    float FoldPendingOverclockDecay(float Magnitude) const;
+
+    /**
+     * @brief 자연 회복분을 포함한 현재 스태미나를 계산하여 반환합니다.
+     * @details 회복 중에는 어트리뷰트에 아직 반영되지 않은 회복량을
+     *          min(Max, 기준값 + 회복률 × 경과 시간)으로 해석적으로 계산합니다.
+     * @return 현재 유효 스태미나
+     */
+    UFUNCTION(BlueprintCallable, Category = "KatanaNeon|Stats|Stamina")
+    float GetCurrentStamina() const;
+
+    /** @brief 스태미나가 자연 회복 구간(딜레이 이후, 최대치 미만)에 있는지 여부 */
+    UFUNCTION(BlueprintCallable, Category = "KatanaNeon|Stats|Stamina")
+    bool IsStaminaRegenerating() const { return RegenAnchorTime >= 0.0f; }
+
+    /**
+     * @brief 누적된 자연 회복분을 스태미나 어트리뷰트에 확정 반영합니다.
+     * @details 회복률·최대치 변경, 저장 시점 등 이산 이벤트에서만 호출됩니다. (GE 실행 중에는 FoldPendingStaminaRegen 사용)
+     */
+    UFUNCTION(BlueprintCallable, Category = "KatanaNeon|Stats|Stamina")
+    void CommitStaminaRegen();
+
+    /**
+     * @brief 실행 중인 스태미나 Additive GE 수치에 아직 반영되지 않은 회복분을 합산하고 회복 기준점을 옮깁니다.
+     * @details KNAttributeSet::PreGameplayEffectExecute 전용입니다. BaseValue를 직접 쓰지 않으므로 GE 실행 중에도 재진입이 없습니다.
+     *          소모(음수) GE이면 회복을 멈추고 회복 딜레이를 다시 시작합니다.
+     * @param Magnitude GE의 원래 Additive 수치
+     * @return 회복분을 합산한 수치
+     */
+    float FoldPendingStaminaRegen(float Magnitude);
+
+    /**
+     * @brief ASC에 등록된 StatsComponent를 통해 자연 회복분을 포함한 스태미나를 조회합니다.
+     * @details 어빌리티 비용 검사용입니다. 컴포넌트 탐색 없이 UKNAbilitySystemComponent의 캐시를 사용하며,
+     *          StatsComponent가 없으면 어트리뷰트 값을 그대로 반환합니다.
+     * @param InASC 조회 대상 ASC
+     * @return 유효 스태미나
+     */
+    static float GetEffectiveStamina(const UAbilitySystemComponent* InASC);
+
+    /**
+     * @brief 진행 중인 크로노스 소모분을 반영한 현재 크로노스를 계산하여 반환합니다.
+     * @details 소모 중에는 max(0, 어트리뷰트 - 소모율 × 경과 시간)으로 해석적으로 계산합니다.
+     * @return 현재 유효 크로노스
+     */
+    UFUNCTION(BlueprintCallable, Category = "KatanaNeon|Stats|Chronos")
+    float GetCurrentChronos() const;
+
+    /** @brief 크로노스가 해석적 소모 구간에 있는지 여부 */
+    UFUNCTION(BlueprintCallable, Category = "KatanaNeon|Stats|Chronos")
+    bool IsChronosDraining() const { return ChronosDrainStartTime >= 0.0f; }
 #pragma endregion 데이터 조회
 
+#pragma region 크로노스 소모 API
+public:
+    /**
+     * @brief 현재 시각을 기준으로 크로노스 해석적 소모를 시작합니다.
+     * @details 어트리뷰트는 EndChronosDrain 이후 호출자가 1회만 확정합니다.
+     * @param DrainRatePerSecond 초당 소모량
+     */
+    void BeginChronosDrain(float DrainRatePerSecond);
+
+    /**
+     * @brief 크로노스 소모를 종료하고, 확정해야 할 총 소모량을 반환합니다.
+     * @details 소모량은 시작 이후의 어트리뷰트 잔량을 넘지 않도록 잘립니다.
+     * @return 어트리뷰트에서 차감할 양 (0 이상)
+     */
+    float EndChronosDrain();
+
+    /**
+     * @brief 현재 잔량 기준으로 크로노스가 0에 도달하기까지 남은 시간을 반환합니다.
+     * @return 남은 시간 (초), 소모 중이 아니거나 소모율이 0이면 음수
+     */
+    float GetChronosTimeToDepletion() const;
+#pragma endregion 크로노스 소모 API
+
 #pragma region 영구 및 시간제 버프 API
 public:
     /**
@@ -194,17 +293,21 @@ private:
     void ApplyBaseStats(const FKNBaseStatRow* BaseStatRow, const FKNOverclockSettingRow* OCRow);
 
     /**
-     * @brief 현재 누적된 오버클럭 포인트 수치에 맞춰 오버클럭 레벨 태그(Lv1~Lv3)를 정리하고 부여합니다.
-     * @param CurrentPoint 검사할 현재 오버클럭 포인트
+     * @brief 포인트로 레벨을 판정하여, 임계값을 넘은 경우에만 레벨 태그(Lv1~Lv3)를 증감하고 이벤트를 발송합니다.
+     * @param CurrentPoint 판정할 현재 오버클럭 포인트
      */
-    void SyncOverclockLevelTags(float CurrentPoint);
+    void ApplyOverclockLevel(float CurrentPoint);
 
     /**
-     * @brief 단일 GameplayTag를 조건에 따라 플레이어 ASC에 부여하거나 제거하는 편의성 유틸리티 함수입니다.
-     * @param Tag 제어할 대상 네이티브 GameplayTag
-     * @param bGrant true일 경우 부여, false일 경우 제거
+     * @brief 다음 감소 이벤트(레벨 하향 돌파 또는 0 도달) 시각에 단발 타이머를 예약합니다.
      */
-    void SetGameplayTagActive(const FGameplayTag& Tag, bool bGrant);
+    void ScheduleOverclockDecay();
+
+    /**
+     * @brief 감소 이벤트 시각에 호출되어 감소분을 확정합니다.
+     */
+    UFUNCTION()
+    void OnOverclockDecayEvent();
 
     /**
      * @brief 내부적으로 Instant GE 객체를 동적으로 생성하여 지정된 어트리뷰트의 수치를 즉시 변경합니다.
@@ -274,15 +377,15 @@ private:
 
 #pragma region 스태미나 리젠 내부 구현
 private:
-    /** @brief 스태미나 자연 회복 루프 타이머 핸들 */
+    /** @brief 회복이 최대치에 도달하는 시점에 1회 발동하는 확정 타이머 핸들 */
     FTimerHandle StaminaRegenTimerHandle;
 
     /** @brief 스태미나 소모 후 리젠 시작까지의 딜레이 타이머 핸들 */
     FTimerHandle StaminaRegenDelayHandle;
 
     /**
-     * @brief 스태미나 자연 회복 타이머를 시작합니다.
-     * @details InitializeStatComponent 완료 후 호출됩니다.
+     * @brief 현재 시각과 스태미나를 기준점으로 해석적 자연 회복을 시작합니다.
+     * @details InitializeStatComponent 완료 후, 그리고 소모 딜레이가 끝날 때 호출됩니다.
      *          StaminaRegenRate가 DataTable로 초기화된 이후 시점이 보장됩니다.
      */
     void StartStaminaRegen();
@@ -294,18 +397,54 @@ private:
     void RestartRegenDelay();
 
     /**
-     * @brief StaminaRegenTickInterval마다 호출되어 스태미나를 회복합니다.
-     * @details 이미 최대치이면 GE 호출 자체를 차단하여 불필요한 연산을 방지합니다.
+     * @brief 회복이 최대치에 도달하는 시점에 호출되어 최종값을 확정합니다.
+     * @details 회복 구간 전체에서 GE/스펙 생성은 0회이며, 어트리뷰트 갱신은 이 시점 1회뿐입니다.
      */
     UFUNCTION()
-    void OnStaminaRegenTick();
+    void OnStaminaRegenCapReached();
+
+    /**
+     * @brief 회복률/최대치가 바뀌었을 때 기존 회복분을 확정하고 새 값으로 기준점을 다시 잡습니다.
+     * @param Data 변경된 어트리뷰트 정보
+     */
+    void OnStaminaRegenParamsChanged(const FOnAttributeChangeData& Data);
 #pragma endregion 스태미나 리젠 내부 구현
 
-#pragma region 스태미나 리젠 설정 데이터
+#pragma region 스태미나 리젠 해석적 상태
+private:
+    /** @brief 회복 기준 시각 (월드 시간, 음수 = 회복 중 아님) */
+    float RegenAnchorTime = -1.0f;
+
+    /** @brief 기준 시각의 스태미나 어트리뷰트 값 */
+    float RegenAnchorStamina = 0.0f;
+
+    /** @brief 기준 시각에 샘플링한 초당 회복률 */
+    float RegenAnchorRate = 0.0f;
+#pragma endregion 스태미나 리젠 해석적 상태
+
+#pragma region 오버클럭 미터 상태
 private:
-    /** @brief 스태미나 자연 회복 틱 간격 (초) */
-    static constexpr float StaminaRegenTickInterval = 0.1f;
+    /** @brief 레벨 캐시와 지연 감소를 계산하는 오버클럭 미터 */
+    FKNOverclockMeter OverclockMeter;
 
+    /** @brief 다음 감소 이벤트에 1회 발동하는 타이머 핸들 */
+    FTimerHandle OverclockDecayTimerHandle;
+
+    /** @brief 감소분 확정 중 여부 (변경 델리게이트에서 유예 재시작과 구분) */
+    bool bCommittingOverclockDecay = false;
+#pragma endregion 오버클럭 미터 상태
+
+#pragma region 크로노스 소모 해석적 상태
+private:
+    /** @brief 소모 시작 시각 (월드 시간, 음수 = 소모 중 아님) */
+    float ChronosDrainStartTime = -1.0f;
+
+    /** @brief 초당 소모량 */
+    float ChronosDrainRate = 0.0f;
+#pragma endregion 크로노스 소모 해석적 상태
+
+#pragma region 스태미나 리젠 설정 데이터
+private:
     /**
      * @brief 스태미나 소모 후 리젠이 시작되기까지의 대기 시간 (초).
      * @details 소모가 연속으로 발생하면 이 딜레이가 매번 초기화됩니다.
@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffect.h"
+#include "GameplayEffectExecutionCalculation.h"
+#include "KNDamageEffect.generated.h"
+
+/**
+ * @file    KNDamageEffect.h
+ * @brief   플레이어 콤보 · 참격 발사체 · 적 근접 공격이 공유하는 데미지 GE와 실행 계산 클래스입니다.
+ * @details
+ * [파이프라인]
+ * - 공격자는 기본 데미지(Damage.Base)와 공격자 측 누적 배율(Damage.Multiplier) 두 값만 SetByCaller로 전달합니다.
+ * - 배율은 피격마다 ASC 상태 비트와 부여 시점에 캐싱한 DataTable 수치로 계산하므로, 태그 컨테이너 검사나 행 조회가 없습니다.
+ * - 최종 데미지는 대상 측 실행 계산에서 단일 패스로 확정되어 Health에 음수 Additive로 출력됩니다.
+ */
+
+#pragma region Damage Gameplay Effect 클래스
+/**
+ * @class  UKNDamageEffect
+ * @brief  UKNDamageExecution을 실행하는 Instant 데미지 GE 클래스입니다.
+ */
+UCLASS()
+class KATANANEON_API UKNDamageEffect : public UGameplayEffect
+{
+    GENERATED_BODY()
+
+public:
+    /** @brief GE 정책 초기화 (Instant 지정 및 데미지 Execution 등록) */
+    UKNDamageEffect();
+
+    /**
+     * @brief GE 클래스가 UKNDamageExecution으로 Damage SetByCaller를 처리하는지 확인합니다.
+     * @param EffectClass 검사할 GE 클래스
+     * @return UKNDamageEffect 파생이거나 CDO에 UKNDamageExecution이 등록되어 있으면 true
+     */
+    static bool IsDamageEffectClass(TSubclassOf<UGameplayEffect> EffectClass);
+};
+#pragma endregion Damage Gameplay Effect 클래스
+
+// ────────────────────────────────────────────────────────────
+
+#pragma region Execution Calculation 클래스
+/**
+ * @class  UKNDamageExecution
+ * @brief  SetByCaller 기본 데미지 × 배율을 대상 Health 감소로 변환하는 실행 계산 클래스입니다.
+ * @details 어트리뷰트 캡처가 없으므로 버프 종류가 늘어도 피격 1회당 비용은 일정합니다.
+ */
+UCLASS()
+class KATANANEON_API UKNDamageExecution : public UGameplayEffectExecutionCalculation
+{
+    GENERATED_BODY()
+
+public:
+    /** @brief 캡처 정의 없이 생성합니다. */
+    UKNDamageExecution();
+
+    /**
+     * @brief GE 실행 로직 – Damage.Base × Damage.Multiplier를 Health 감소 모디파이어로 출력합니다.
+     * @param ExecutionParams GE 실행 컨텍스트 및 파라미터 (Spec, ASC 등)
+     * @param OutExecutionOutput 최종적으로 적용될 Modifier 결과를 담는 출력 객체
+     */
+    virtual void Execute_Implementation(
+        const FGameplayEffectCustomExecutionParameters& ExecutionParams,
+        FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const override;
+
+    /**
+     * @brief 데미지 스펙에 기본 데미지와 배율을 기록합니다.
+     * @details 풀링된 스펙은 재사용 시 SetByCaller 값이 비워지므로 두 값을 항상 함께 기록합니다.
+     * @param Spec       대상 스펙
+     * @param BaseDamage 배율 적용 전 기본 데미지 (양수)
+     * @param Multiplier 공격자 측 누적 배율
+     */
+    static void SetDamage(FGameplayEffectSpec& Spec, float BaseDamage, float Multiplier = 1.0f);
+};
+#pragma endregion Execution Calculation 클래스
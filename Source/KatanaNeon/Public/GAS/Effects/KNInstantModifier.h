@@ -47,7 +47,9 @@ public:
 /**
  * @class  UKNInstantModifierExecution
  * @brief  UKNInstantModifier의 실제 스탯 증감 연산을 담당하는 실행 계산 클래스입니다.
- * @details 런타임 성능 최적화를 위해 실시간 리플렉션을 배제하고 정적 캐싱 맵을 활용합니다.
+ * @details 스태미나 틱·오버클럭 획득·스탯 초기화마다 실행되는 경로이므로 할당 없는 전용 경로로 동작합니다.
+ * - 어트리뷰트 캡처 없음 (현재값을 읽지 않음)
+ * - SetByCaller 수치를 어트리뷰트 인덱스별 고정 배열에 모은 뒤 Max 계열 → 나머지 순으로 출력
  */
 UCLASS()
 class KATANANEON_API UKNInstantModifierExecution : public UGameplayEffectExecutionCalculation
@@ -55,16 +57,45 @@ class KATANANEON_API UKNInstantModifierExecution : public UGameplayEffectExecuti
     GENERATED_BODY()
 
 public:
-    /** @brief AttributeSet의 모든 어트리뷰트를 캡처 목록에 등록하여 수정을 준비합니다. */
+    /** @brief 캡처 정의 없이 생성합니다. (대상 어트리뷰트 값을 읽지 않음) */
     UKNInstantModifierExecution();
 
     /**
-     * @brief GE 실행 로직 – SetByCaller로 전달받은 태그를 캐시 맵에서 찾아 Additive 연산을 즉시 수행합니다.
+     * @brief GE 실행 로직 – SetByCaller로 전달받은 태그를 인덱스 표로 변환해 Additive 연산을 즉시 수행합니다.
      * @param ExecutionParams GE 실행 컨텍스트 및 파라미터 (Spec, ASC 등)
      * @param OutExecutionOutput 최종적으로 적용될 Modifier 결과를 담는 출력 객체
      */
     virtual void Execute_Implementation(
         const FGameplayEffectCustomExecutionParameters& ExecutionParams,
         FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const override;
+
+    /**
+     * @brief SetByCaller 수치 맵을 Additive 모디파이어 목록으로 변환합니다.
+     * @param SetByCallerTagMagnitudes 스펙의 태그별 수치
+     * @param OutExecutionOutput 모디파이어를 추가할 출력 객체
+     */
+    static void BuildModifiers(
+        const TMap<FGameplayTag, float>& SetByCallerTagMagnitudes,
+        FGameplayEffectCustomExecutionOutput& OutExecutionOutput);
+};
+
+/**
+ * @class  UKNInstantModifierReferenceExecution
+ * @brief  KN.GAS.BenchmarkInstantExec의 비교 기준으로만 쓰는, 최적화 이전 Instant 실행 계산의 재현입니다.
+ * @details 모든 어트리뷰트를 Target 캡처로 등록하고, 리플렉션으로 만든 태그 → 어트리뷰트 TMap과
+ * Max 우선 TSet으로 모디파이어를 출력합니다. 게임 GE에는 연결하지 않습니다.
+ */
+UCLASS(HideDropdown)
+class KATANANEON_API UKNInstantModifierReferenceExecution : public UGameplayEffectExecutionCalculation
+{
+    GENERATED_BODY()
+
+public:
+    /** @brief 리플렉션으로 UKNAttributeSet의 모든 어트리뷰트를 Target 캡처로 등록합니다. */
+    UKNInstantModifierReferenceExecution();
+
+    virtual void Execute_Implementation(
+        const FGameplayEffectCustomExecutionParameters& ExecutionParams,
+        FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const override;
 };
 #pragma endregion Execution Calculation 클래스
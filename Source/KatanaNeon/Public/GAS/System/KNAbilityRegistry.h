@@ -0,0 +1,153 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "GameplayAbilitySpecHandle.h"
+#include "Abilities/GameplayAbility.h"
+
+#pragma region 전방 선언
+class UAbilitySystemComponent;
+struct FAbilityEndedData;
+#pragma endregion 전방 선언
+
+/**
+ * @file    KNAbilityRegistry.h
+ * @brief   ASC 단위로 어빌리티 태그 → 스펙 핸들 / 주 인스턴스를 O(1)로 조회하는 레지스트리입니다.
+ * @details 애님 노티파이와 입력 콜백이 매번 GetActivatableGameplayAbilitySpecsByAllMatchingTags로
+ * 임시 TArray를 만들고 인스턴스를 선형 탐색하던 비용을 단일 해시 조회로 대체합니다.
+ */
+
+#pragma region 레지스트리 항목
+/**
+ * @struct FKNAbilityRegistryEntry
+ * @brief  어빌리티 태그 1개에 대응하는 스펙 핸들과 주 인스턴스, 활성 여부입니다.
+ */
+struct KATANANEON_API FKNAbilityRegistryEntry
+{
+    /** @brief ASC에 부여된 스펙 핸들 */
+    FGameplayAbilitySpecHandle Handle;
+
+    /** @brief InstancedPerActor 주 인스턴스 (NonInstanced면 CDO) */
+    TWeakObjectPtr<UGameplayAbility> PrimaryInstance = nullptr;
+
+    /** @brief ASC 활성/종료 콜백으로 갱신되는 활성 여부 */
+    bool bActive = false;
+};
+#pragma endregion 레지스트리 항목
+
+#pragma region 어빌리티 레지스트리
+/**
+ * @class  FKNAbilityRegistry
+ * @brief  캐릭터가 소유하며, 바인딩된 ASC의 활성/종료 델리게이트로 항목을 최신 상태로 유지합니다.
+ *
+ * @details
+ * [생명주기]
+ * 1. Bind(ASC)           : 활성/종료 콜백 구독 (AKNCharacterBase::BeginPlay)
+ * 2. RegisterSpec(Handle): GiveAbility 직후 호출하여 어빌리티 에셋 태그마다 항목을 등록
+ * 3. Unbind()            : 콜백 구독 해제 (AKNCharacterBase::EndPlay)
+ */
+class KATANANEON_API FKNAbilityRegistry
+{
+public:
+    ~FKNAbilityRegistry();
+
+    /**
+     * @brief ASC의 어빌리티 활성/종료 델리게이트를 구독합니다.
+     * @param InASC 추적할 어빌리티 시스템 컴포넌트
+     */
+    void Bind(UAbilitySystemComponent* InASC);
+
+    /** @brief 구독을 해제하고 모든 항목을 비웁니다. */
+    void Unbind();
+
+    /**
+     * @brief 부여된 스펙을 해당 어빌리티의 모든 에셋 태그 키로 등록합니다.
+     * @param Handle GiveAbility가 반환한 스펙 핸들
+     */
+    void RegisterSpec(const FGameplayAbilitySpecHandle& Handle);
+
+    /**
+     * @brief 태그에 해당하는 항목을 반환합니다.
+     * @param AbilityTag 어빌리티 식별 태그 (예: KatanaNeon::Ability::Combat::Attack)
+     * @return 항목 포인터, 미등록 시 nullptr
+     */
+    const FKNAbilityRegistryEntry* Find(const FGameplayTag& AbilityTag) const
+    {
+        return Entries.Find(AbilityTag);
+    }
+
+    /**
+     * @brief 태그에 해당하는 어빌리티가 현재 활성 상태인지 반환합니다.
+     * @param AbilityTag 어빌리티 식별 태그
+     * @return 활성 상태이면 true
+     */
+    bool IsActive(const FGameplayTag& AbilityTag) const
+    {
+        const FKNAbilityRegistryEntry* Entry = Entries.Find(AbilityTag);
+        return Entry && Entry->bActive;
+    }
+
+    /**
+     * @brief 태그에 해당하는 스펙 핸들을 반환합니다.
+     * @param AbilityTag 어빌리티 식별 태그
+     * @return 스펙 핸들, 미등록 시 무효 핸들
+     */
+    FGameplayAbilitySpecHandle GetHandle(const FGameplayTag& AbilityTag) const
+    {
+        const FKNAbilityRegistryEntry* Entry = Entries.Find(AbilityTag);
+        return Entry ? Entry->Handle : FGameplayAbilitySpecHandle();
+    }
+
+    /**
+     * @brief 태그에 해당하는 주 인스턴스를 활성 여부와 무관하게 반환합니다.
+     * @tparam T 기대하는 어빌리티 클래스
+     * @param AbilityTag 어빌리티 식별 태그
+     * @return 주 인스턴스, 미등록이거나 타입 불일치 시 nullptr
+     */
+    template <typename T>
+    T* GetInstance(const FGameplayTag& AbilityTag) const
+    {
+        const FKNAbilityRegistryEntry* Entry = Entries.Find(AbilityTag);
+        return Entry ? Cast<T>(Entry->PrimaryInstance.Get()) : nullptr;
+    }
+
+    /**
+     * @brief 태그에 해당하는 주 인스턴스를 활성 상태일 때만 반환합니다.
+     * @tparam T 기대하는 어빌리티 클래스
+     * @param AbilityTag 어빌리티 식별 태그
+     * @return 활성 중인 주 인스턴스, 아니면 nullptr
+     */
+    template <typename T>
+    T* GetActiveInstance(const FGameplayTag& AbilityTag) const
+    {
+        const FKNAbilityRegistryEntry* Entry = Entries.Find(AbilityTag);
+        return (Entry && Entry->bActive) ? Cast<T>(Entry->PrimaryInstance.Get()) : nullptr;
+    }
+
+private:
+    /** @brief ASC AbilityActivatedCallbacks 수신 — 활성 플래그와 인스턴스를 갱신합니다. */
+    void HandleAbilityActivated(UGameplayAbility* Ability);
+
+    /** @brief ASC OnAbilityEnded 수신 — 활성 플래그를 해제합니다. */
+    void HandleAbilityEnded(const FAbilityEndedData& EndedData);
+
+    /**
+     * @brief 스펙 핸들로 해당 어빌리티의 모든 항목에 갱신 함수를 적용합니다.
+     * @param Handle 대상 스펙 핸들
+     * @param Ability 대상 어빌리티 (에셋 태그 조회용)
+     * @param bActive 설정할 활성 여부
+     */
+    void SetActiveByHandle(const FGameplayAbilitySpecHandle& Handle, const UGameplayAbility* Ability, bool bActive);
+
+    /** @brief 태그 → 항목 해시맵 */
+    TMap<FGameplayTag, FKNAbilityRegistryEntry> Entries;
+
+    /** @brief 추적 중인 ASC */
+    TWeakObjectPtr<UAbilitySystemComponent> BoundASC = nullptr;
+
+    FDelegateHandle ActivatedDelegateHandle;
+    FDelegateHandle EndedDelegateHandle;
+};
+#pragma endregion 어빌리티 레지스트리
@@ -0,0 +1,157 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "Data/Structs/KNPlayerStatTable.h"
+
+#pragma region 전방 선언
+class UDataTable;
+#pragma endregion 전방 선언
+
+/**
+ * @file    KNComboGraph.h
+ * @brief   콤보 DataTable 2종(발도/납도)을 [스탠스][공격 타입][단계] 밀집 배열로 컴파일한 상태 그래프입니다.
+ * @details 콤보 단계마다 FName 행 키를 만들고 FindRow 후 행 전체를 복사하던 경로를 대체합니다.
+ * 컴파일은 어빌리티 부여 시 1회 수행되며, 이후 단계 진행은 미리 계산된 전이 인덱스 조회뿐입니다.
+ */
+
+#pragma region 콤보 노드
+/**
+ * @struct FKNComboNode
+ * @brief  콤보 그래프의 노드 1개 — 행 데이터와 약/강 입력 시 다음 노드 인덱스입니다.
+ */
+struct KATANANEON_API FKNComboNode
+{
+    /** @brief 컴파일 시 1회 복사된 행 데이터 */
+    FKNComboAttackRow Row;
+
+    /** @brief 약공격 입력 시 이어지는 노드 (INDEX_NONE = 전이 없음) */
+    int32 NextLight = INDEX_NONE;
+
+    /** @brief 강공격 입력 시 이어지는 노드 (INDEX_NONE = 전이 없음) */
+    int32 NextHeavy = INDEX_NONE;
+
+    /** @brief 원본 테이블에 행이 존재하여 재생 가능한 노드인지 여부 */
+    bool bValid = false;
+};
+#pragma endregion 콤보 노드
+
+#pragma region 콤보 그래프
+/**
+ * @class  FKNComboGraph
+ * @brief  콤보 어빌리티 인스턴스가 소유하는 컴파일된 콤보 상태 그래프입니다.
+ *
+ * @details
+ * [노드 인덱스 규약]
+ * Index = (Stance × 2 + Type) × MaxStep + (Step - 1)
+ * - Stance : 0 = 납도, 1 = 발도
+ * - Type   : 0 = 약공격, 1 = 강공격
+ *
+ * [전이 규칙] (FKNComboAttackRow 콤보 트리와 동일)
+ * - 약공 N → 약공 N+1 / 강공 N+1
+ * - 강공 N, 약공 5 → 전이 없음 (피니셔)
+ *
+ * [검증]
+ * 누락 행, 단계/타입 불일치, 몽타주 미할당, 판정 구간 역전을 컴파일 시점에 로그로 보고합니다.
+ */
+class KATANANEON_API FKNComboGraph
+{
+public:
+    /** @brief 최대 콤보 단계 */
+    static constexpr int32 MaxStep = 5;
+
+    /** @brief 전체 노드 수 (스탠스 2 × 타입 2 × 단계 5) */
+    static constexpr int32 NumNodes = 2 * 2 * MaxStep;
+
+    /**
+     * @brief 두 스탠스 테이블을 그래프로 컴파일합니다.
+     * @param DrawnTable   발도 콤보 테이블
+     * @param SheathTable  납도 콤보 테이블
+     * @param OwnerName    오류 로그에 표시할 소유자 이름
+     * @return 누락 행 없이 모든 노드가 유효하면 true
+     */
+    bool Compile(const UDataTable* DrawnTable, const UDataTable* SheathTable, const FString& OwnerName);
+
+    /** @brief 컴파일이 한 번이라도 수행되었는지 여부 */
+    bool IsCompiled() const { return bCompiled; }
+
+    /**
+     * @brief 노드 인덱스를 계산합니다.
+     * @param bDrawn 발도 스탠스 여부
+     * @param bHeavy 강공격 여부
+     * @param Step   콤보 단계 (1 ~ MaxStep)
+     * @return 노드 인덱스, 범위 밖이면 INDEX_NONE
+     */
+    static int32 MakeNodeIndex(bool bDrawn, bool bHeavy, int32 Step)
+    {
+        if (Step < 1 || Step > MaxStep) return INDEX_NONE;
+        return ((bDrawn ? 2 : 0) + (bHeavy ? 1 : 0)) * MaxStep + (Step - 1);
+    }
+
+    /**
+     * @brief 콤보 첫 타 노드를 반환합니다.
+     * @param bDrawn 발도 스탠스 여부
+     * @param bHeavy 강공격으로 시작하는지 여부
+     * @return 유효한 노드 인덱스, 행이 없으면 INDEX_NONE
+     */
+    int32 GetEntryNode(bool bDrawn, bool bHeavy) const
+    {
+        const int32 Index = MakeNodeIndex(bDrawn, bHeavy, 1);
+        return IsValidNode(Index) ? Index : INDEX_NONE;
+    }
+
+    /**
+     * @brief 미리 계산된 전이를 따라 다음 노드를 반환합니다.
+     * @param NodeIndex 현재 노드
+     * @param bHeavy    다음 입력이 강공격인지 여부
+     * @return 다음 노드 인덱스, 전이가 없으면 INDEX_NONE
+     */
+    int32 GetNextNode(int32 NodeIndex, bool bHeavy) const
+    {
+        if (!IsValidNode(NodeIndex)) return INDEX_NONE;
+        return bHeavy ? Nodes[NodeIndex].NextHeavy : Nodes[NodeIndex].NextLight;
+    }
+
+    /**
+     * @brief 노드의 행 데이터를 반환합니다.
+     * @param NodeIndex 노드 인덱스
+     * @return 행 포인터 (그래프 수명 동안 안정), 무효 노드면 nullptr
+     */
+    const FKNComboAttackRow* GetRow(int32 NodeIndex) const
+    {
+        return IsValidNode(NodeIndex) ? &Nodes[NodeIndex].Row : nullptr;
+    }
+
+    /** @brief 노드 인덱스에 해당하는 콤보 단계 (1 ~ MaxStep) */
+    static int32 GetNodeStep(int32 NodeIndex) { return NodeIndex % MaxStep + 1; }
+
+    /** @brief 노드 인덱스가 강공격 노드인지 여부 */
+    static bool IsHeavyNode(int32 NodeIndex) { return (NodeIndex / MaxStep) % 2 == 1; }
+
+    /** @brief 노드 인덱스가 범위 안이고 행이 존재하는지 여부 */
+    bool IsValidNode(int32 NodeIndex) const
+    {
+        return NodeIndex >= 0 && NodeIndex < NumNodes && Nodes[NodeIndex].bValid;
+    }
+
+private:
+    /**
+     * @brief 스탠스 1종의 행 10개를 노드에 적재합니다.
+     * @param Table     원본 테이블
+     * @param bDrawn    발도 스탠스 여부
+     * @param OwnerName 로그용 소유자 이름
+     * @return 누락 행이 없으면 true
+     */
+    bool CompileStance(const UDataTable* Table, bool bDrawn, const FString& OwnerName);
+
+    /** @brief 유효 노드 사이의 약/강 전이 인덱스를 계산합니다. */
+    void LinkTransitions();
+
+    /** @brief 밀집 노드 배열 */
+    TStaticArray<FKNComboNode, NumNodes> Nodes;
+
+    bool bCompiled = false;
+};
+#pragma endregion 콤보 그래프
@@ -0,0 +1,140 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectTypes.h"
+#include "GameplayEffect.h"
+
+#pragma region 전방 선언
+class UAbilitySystemComponent;
+#pragma endregion 전방 선언
+
+/**
+ * @file    KNEffectSpecCache.h
+ * @brief   ASC별 Instant GE 스펙 템플릿 캐시와 이펙트 컨텍스트 순환 풀입니다.
+ * @details MakeEffectContext + MakeOutgoingSpec은 호출마다 GE 정의를 해석하여 컨텍스트와 스펙을 새로 만듭니다.
+ * 이 캐시는 (GE 클래스, 레벨)별 스펙을 1회만 만들어 두고, 이후에는 생성 직후 상태의 템플릿을 복사해 되돌린 뒤
+ * 컨텍스트만 갱신하여 재사용합니다. 엔진은 Instant 스펙을 적용할 때 여전히 자체 복사본을 만들므로,
+ * 절감되는 것은 GE 정의 해석·스펙/컨텍스트 생성 비용이며 적용 경로의 할당이 모두 사라지지는 않습니다.
+ */
+
+#pragma region 스펙 캐시 통계
+/**
+ * @struct FKNEffectSpecCacheStats
+ * @brief  스펙/컨텍스트 생성 대비 재사용 횟수 카운터입니다. (KN.GAS.SpecCacheStats로 출력)
+ */
+struct FKNEffectSpecCacheStats
+{
+    /** @brief MakeOutgoingSpec으로 새로 만든 스펙 수 (캐시 미스) */
+    int32 SpecsCreated = 0;
+
+    /** @brief 캐시에서 재사용한 스펙 수 */
+    int32 SpecsReused = 0;
+
+    /** @brief 새로 할당한 이펙트 컨텍스트 수 */
+    int32 ContextsCreated = 0;
+
+    /** @brief 순환 풀에서 재사용한 이펙트 컨텍스트 수 */
+    int32 ContextsReused = 0;
+
+    /** @brief Instant가 아니어서 캐시를 거치지 않고 새로 만든 스펙 수 */
+    int32 Bypassed = 0;
+
+    /** @brief 같은 (GE 클래스, 레벨) 스펙이 아직 사용 중이어서 건너뛴 횟수 (중첩 획득) */
+    int32 InUseSkipped = 0;
+};
+#pragma endregion 스펙 캐시 통계
+
+#pragma region 스펙 캐시
+/**
+ * @class  FKNEffectSpecCache
+ * @brief  UKNAbilitySystemComponent가 소유하는 GE 스펙 템플릿 캐시입니다.
+ *
+ * @details
+ * [재사용 규칙]
+ * - Instant GE만 캐시합니다. 엔진은 Instant 스펙을 적용 시 스택 복사본으로 실행하므로 원본을 보관하지 않습니다.
+ * - Duration/Infinite GE는 활성 이펙트가 스펙과 컨텍스트를 계속 참조하므로 매번 새로 만듭니다.
+ * - 재사용 시 스펙을 생성 직후 템플릿으로 되돌리므로 SetByCaller·동적 에셋/부여 태그·캡처 값이 이전 호출에서 넘어오지 않습니다.
+ *   (SetByCaller 값은 비어 있으므로 호출자가 필요한 값을 다시 설정합니다.)
+ * - 캐시 외에 핸들을 쥔 호출자가 있는 스펙은 사용 중으로 보고 건너뜁니다. 적용 도중 같은 GE를 다시 획득하면
+ *   (예: 피격 반응이 다시 데미지를 적용) 같은 키의 스펙을 하나 더 만들어 쌓으므로 바깥 호출의 스펙을 덮어쓰지 않습니다.
+ *
+ * [컨텍스트 순환 풀]
+ * 컨텍스트는 ContextPoolSize개를 돌려 쓰되, 컨텍스트 핸들의 공유 참조 수로 풀(과 이 캐시의 유휴 스펙)만 쥐고 있는지 확인한 뒤
+ * 제자리 초기화합니다. GameplayCue 파라미터·대기 중인 큐 배치·사용 중인 스펙 등이 아직 쥐고 있으면 새로 할당하므로
+ * 중첩 깊이나 큐 지연과 무관하게 바깥의 컨텍스트를 덮어쓰지 않습니다.
+ */
+class KATANANEON_API FKNEffectSpecCache
+{
+public:
+    /** @brief 순환 재사용하는 이펙트 컨텍스트 개수 */
+    static constexpr int32 ContextPoolSize = 4;
+
+    /**
+     * @brief 적용 준비가 끝난 스펙을 반환합니다.
+     * @param Owner        스펙의 소스 ASC
+     * @param EffectClass  GE 클래스
+     * @param Level        GE 레벨
+     * @param Instigator   인스티게이터 (nullptr이면 Owner의 OwnerActor)
+     * @param EffectCauser 이펙트 유발자 (nullptr이면 Owner의 AvatarActor)
+     * @return 스펙 핸들, EffectClass가 없으면 무효 핸들
+     */
+    FGameplayEffectSpecHandle Acquire(
+        UAbilitySystemComponent& Owner,
+        TSubclassOf<UGameplayEffect> EffectClass,
+        float Level,
+        AActor* Instigator = nullptr,
+        AActor* EffectCauser = nullptr);
+
+    /** @brief 캐시된 스펙과 컨텍스트를 모두 비웁니다. */
+    void Reset();
+
+    /** @brief 생성/재사용 카운터 */
+    const FKNEffectSpecCacheStats& GetStats() const { return Stats; }
+
+    /** @brief 카운터를 0으로 되돌립니다. */
+    void ResetStats() { Stats = FKNEffectSpecCacheStats(); }
+
+private:
+    /**
+     * @brief 순환 풀에서 컨텍스트를 꺼내 초기화하고 인스티게이터를 설정합니다.
+     * @param Owner        소스 ASC
+     * @param Instigator   인스티게이터
+     * @param EffectCauser 이펙트 유발자
+     * @return 초기화된 컨텍스트 핸들
+     */
+    FGameplayEffectContextHandle AcquireContext(UAbilitySystemComponent& Owner, AActor* Instigator, AActor* EffectCauser);
+
+    /**
+     * @brief 컨텍스트를 풀과 이 캐시의 템플릿/유휴 스펙만 쥐고 있어 제자리 초기화해도 되는지 확인합니다.
+     * @param Context 순환 풀의 컨텍스트 핸들
+     * @return 바깥 참조가 없으면 true
+     */
+    bool IsContextSolelyPooled(const FGameplayEffectContextHandle& Context) const;
+
+    /** @brief (GE 클래스, 레벨) → 스펙 항목 */
+    struct FEntry
+    {
+        TWeakObjectPtr<UClass> EffectClass;
+        float Level = 1.0f;
+
+        /** @brief 호출자에게 내주는 스펙 */
+        FGameplayEffectSpecHandle Spec;
+
+        /** @brief MakeOutgoingSpec 직후 상태의 복사본 (재사용 시 Spec을 이 상태로 되돌림) */
+        FGameplayEffectSpecHandle Template;
+    };
+
+    /** @brief 캐시 항목 (캐릭터당 GE 종류가 적으므로 선형 탐색, 중첩 획득 시 같은 키가 여러 개) */
+    TArray<FEntry, TInlineAllocator<8>> Entries;
+
+    /** @brief 이펙트 컨텍스트 순환 풀 */
+    TArray<FGameplayEffectContextHandle, TInlineAllocator<ContextPoolSize>> ContextPool;
+
+    /** @brief 다음에 재사용할 컨텍스트 인덱스 */
+    int32 NextContext = 0;
+
+    FKNEffectSpecCacheStats Stats;
+};
+#pragma endregion 스펙 캐시
@@ -5,26 +5,93 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "AttributeSet.h"
+#include "GAS/Attributes/KNAttributeSet.h"
 
 /**
  * @file    KNGASAttributeCache.h
- * @brief   GAS 어트리뷰트 리플렉션 캐싱을 전담하는 공용 유틸리티 클래스입니다.
+ * @brief   GAS 어트리뷰트 ↔ 네이티브 스탯 태그 매핑을 전담하는 공용 유틸리티 클래스입니다.
  * @details 단일 책임 원칙(SRP)과 DRY(Don't Repeat Yourself) 원칙에 따라,
- * 여러 Execution Calculation 클래스에서 중복되던 리플렉션 캐싱 로직을 한 곳으로 통합했습니다.
+ * 여러 Execution Calculation 클래스에서 중복되던 매핑 로직을 한 곳으로 통합했습니다.
+ * 매핑은 KN_ATTRIBUTE_LIST X-매크로로 컴파일 타임에 생성되며, 런타임 리플렉션 순회가 없습니다.
  */
 
+#pragma region 어트리뷰트 인덱스
+/**
+ * @enum  EKNAttribute
+ * @brief UKNAttributeSet 어트리뷰트의 밀집 인덱스입니다. (KN_ATTRIBUTE_LIST 선언 순서)
+ */
+enum class EKNAttribute : uint8
+{
+#define KN_ATTRIBUTE_ENUM_ENTRY(Name) Name,
+    KN_ATTRIBUTE_LIST(KN_ATTRIBUTE_ENUM_ENTRY)
+#undef KN_ATTRIBUTE_ENUM_ENTRY
+    Count
+};
+#pragma endregion 어트리뷰트 인덱스
+
 #pragma region 어트리뷰트 캐시 매니저
  /**
   * @class  FKNGASAttributeCache
-  * @brief  엔진 리플렉션 부하를 막기 위해 네이티브 태그와 어트리뷰트 매핑을 O(1) 해시맵으로 제공합니다.
+  * @brief  네이티브 태그 → 어트리뷰트 인덱스 → FGameplayAttribute 를 배열 인덱싱으로 제공합니다.
+  *
+  * @details
+  * - 태그 → 인덱스 : KN_ATTRIBUTE_LIST로 생성한 네이티브 태그 표 선형 비교 (해시 조회/할당 없음)
+  *   (KN_ATTRIBUTE_LIST와 UKNAttributeSet 프로퍼티의 1:1 일치 여부는 에디터 빌드에서 엔진 초기화 직후 1회 check로 검사)
+  * - 인덱스 → 어트리뷰트 : 정적 배열 인덱싱
+  * - 정적 배열은 함수 지역 static(매직 스태틱)으로 1회 초기화되므로 스레드 안전합니다.
   */
 class KATANANEON_API FKNGASAttributeCache
 {
 public:
+    /** @brief 어트리뷰트 개수 */
+    static constexpr int32 Num = static_cast<int32>(EKNAttribute::Count);
+
+    /**
+     * @brief 인덱스가 Max 계열(상한) 어트리뷰트인지 반환합니다. (이름이 "Max"로 시작)
+     * @param Index 어트리뷰트 인덱스
+     * @return 상한 어트리뷰트이면 true
+     */
+    static constexpr bool IsMaxAttribute(EKNAttribute Index)
+    {
+        constexpr bool Table[] =
+        {
+#define KN_ATTRIBUTE_IS_MAX_ENTRY(Name) (#Name[0] == 'M' && #Name[1] == 'a' && #Name[2] == 'x'),
+            KN_ATTRIBUTE_LIST(KN_ATTRIBUTE_IS_MAX_ENTRY)
+#undef KN_ATTRIBUTE_IS_MAX_ENTRY
+        };
+        return Index < EKNAttribute::Count && Table[static_cast<int32>(Index)];
+    }
+
+    /**
+     * @brief 스탯 태그에 대응하는 어트리뷰트 인덱스를 반환합니다.
+     * @param Tag KatanaNeon::Data::Stats 태그
+     * @return 어트리뷰트 인덱스, 매핑되지 않은 태그면 EKNAttribute::Count
+     */
+    static EKNAttribute ToIndex(const FGameplayTag& Tag);
+
+    /**
+     * @brief 인덱스에 대응하는 어트리뷰트를 반환합니다.
+     * @param Index 어트리뷰트 인덱스 (Count 미만)
+     * @return UKNAttributeSet 어트리뷰트
+     */
+    static const FGameplayAttribute& GetAttribute(EKNAttribute Index);
+
+    /**
+     * @brief 인덱스에 대응하는 스탯 태그를 반환합니다.
+     * @param Index 어트리뷰트 인덱스 (Count 미만)
+     * @return KatanaNeon::Data::Stats 태그
+     */
+    static FGameplayTag GetTag(EKNAttribute Index);
+
     /**
-     * @brief 어트리뷰트 맵을 반환합니다. 최초 1회만 엔진 리플렉션을 수행하고 이후엔 캐시를 반환합니다.
-     * @return FGameplayTag를 키로, FGameplayAttribute를 값으로 가지는 정적 캐시 맵
+     * @brief 스탯 태그에 대응하는 어트리뷰트를 조회합니다.
+     * @param Tag KatanaNeon::Data::Stats 태그
+     * @return 어트리뷰트 포인터, 매핑되지 않은 태그면 nullptr
      */
-    static const TMap<FGameplayTag, FGameplayAttribute>& Get();
+    static const FGameplayAttribute* Find(const FGameplayTag& Tag)
+    {
+        const EKNAttribute Index = ToIndex(Tag);
+        return Index != EKNAttribute::Count ? &GetAttribute(Index) : nullptr;
+    }
 };
-#pragma endregion 어트리뷰트 캐시 매니저
\ No newline at end of file
+#pragma endregion 어트리뷰트 캐시 매니저
@@ -0,0 +1,115 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/Structs/KNPlayerStatTable.h"
+
+/**
+ * @file    KNOverclockMeter.h
+ * @brief   오버클럭 포인트 → 레벨(0~3) 판정과 시간 기반 지연 감소를 계산하는 순수 계산기입니다.
+ * @details 포인트가 바뀔 때마다 레벨 태그 3개를 검사/갱신하던 경로를 대체합니다.
+ * 레벨은 캐시되며 임계값을 넘나들 때만 변경을 보고하고, 감소는 타임스탬프로 필요할 때만 계산합니다.
+ * UObject/ASC에 의존하지 않으므로 태그 부여와 타이머 예약은 소유자(UKNStatsComponent)가 담당합니다.
+ */
+
+#pragma region 오버클럭 미터
+/**
+ * @class  FKNOverclockMeter
+ * @brief  UKNStatsComponent가 소유하는 오버클럭 게이지 상태 계산기입니다.
+ *
+ * @details
+ * [감소 모델]
+ * Point(t) = max(0, AnchorPoint - DecayRate × max(0, t - DecayStartTime))
+ * - 외부 증감(획득/소모) 시 : DecayStartTime = 현재 + OverclockDecayDelay (전투 이탈 유예 재시작)
+ * - 감소분 확정 시          : DecayStartTime = 현재 (진행 중인 감소를 이어서 유지)
+ *
+ * [레벨 판정]
+ * Level = Point ≥ LvN 임계값을 만족하는 최대 N. UpdateLevel은 캐시와 다를 때만 true를 반환합니다.
+ */
+class KATANANEON_API FKNOverclockMeter
+{
+public:
+    /** @brief 최대 오버클럭 레벨 */
+    static constexpr int32 MaxLevel = 3;
+
+    /**
+     * @brief 임계값과 감소 파라미터를 설정합니다.
+     * @param Setting 오버클럭 설정 행
+     */
+    void Configure(const FKNOverclockSettingRow& Setting);
+
+    /**
+     * @brief 외부 증감으로 확정된 포인트를 기록하고 감소 유예를 처음부터 다시 셉니다.
+     * @param Point 확정된 포인트
+     * @param Now   현재 월드 시간
+     */
+    void ResetAnchor(float Point, float Now);
+
+    /**
+     * @brief 감소분을 확정한 포인트를 기록합니다. 진행 중인 감소는 유예 없이 이어집니다.
+     * @param Point 확정된 포인트
+     * @param Now   현재 월드 시간
+     */
+    void CommitAnchor(float Point, float Now);
+
+    /**
+     * @brief 지연 감소를 반영한 현재 포인트를 계산합니다.
+     * @param Now 현재 월드 시간
+     * @return 현재 포인트
+     */
+    float GetPoint(float Now) const;
+
+    /**
+     * @brief 현재 시각에 포인트가 실제로 감소 중인지 여부 (유예 종료 후, 0 초과)
+     * @param Now 현재 월드 시간
+     */
+    bool IsDecaying(float Now) const
+    {
+        return DecayRate > 0.0f && AnchorPoint > 0.0f && Now >= DecayStartTime;
+    }
+
+    /**
+     * @brief 포인트에 해당하는 레벨을 계산합니다.
+     * @param Point 검사할 포인트
+     * @return 레벨 (0 ~ MaxLevel)
+     */
+    int32 ComputeLevel(float Point) const;
+
+    /** @brief 마지막으로 판정된 레벨 (태그 조회 없음) */
+    int32 GetLevel() const { return CachedLevel; }
+
+    /**
+     * @brief 포인트로 레벨을 다시 판정하여 캐시합니다.
+     * @param Point       판정할 포인트
+     * @param OutOldLevel 판정 이전 레벨
+     * @return 임계값을 넘어 레벨이 바뀌었으면 true
+     */
+    bool UpdateLevel(float Point, int32& OutOldLevel);
+
+    /**
+     * @brief 다음 감소 이벤트(현재 레벨 임계값 하향 돌파 또는 0 도달) 시각을 계산합니다.
+     * @return 월드 시간, 감소가 없으면 음수
+     */
+    float GetNextDecayEventTime() const;
+
+private:
+    /** @brief Lv1 ~ Lv3 진입 임계값 */
+    float Thresholds[MaxLevel] = { 100.0f, 200.0f, 300.0f };
+
+    /** @brief 초당 감소량 */
+    float DecayRate = 0.0f;
+
+    /** @brief 마지막 획득/소모 후 감소 시작까지의 유예 (초) */
+    float DecayDelay = 0.0f;
+
+    /** @brief 마지막으로 확정된 포인트 */
+    float AnchorPoint = 0.0f;
+
+    /** @brief 감소가 시작되는(된) 월드 시간 */
+    float DecayStartTime = 0.0f;
+
+    /** @brief 캐시된 레벨 */
+    int32 CachedLevel = 0;
+};
+#pragma endregion 오버클럭 미터
@@ -0,0 +1,83 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "GAS/Tags/KNStatsTags.h"
+
+/**
+ * @file    KNStateTagBits.h
+ * @brief   KatanaNeon::State 네이티브 태그를 고정 비트셋으로 미러링하기 위한 인덱스와 비트셋 타입입니다.
+ * @details 인덱스는 KN_STATE_TAG_LIST X-매크로로 컴파일 타임에 생성됩니다.
+ * 비트 조회는 HasMatchingGameplayTag의 태그 카운트 맵 조회를 단일 비트 연산으로 대체합니다.
+ */
+
+#pragma region 상태 태그 인덱스
+/**
+ * @enum  EKNStateTag
+ * @brief KN_STATE_TAG_LIST 선언 순서의 상태 태그 비트 인덱스입니다.
+ */
+enum class EKNStateTag : uint8
+{
+#define KN_STATE_TAG_ENUM_ENTRY(Name, Tag) Name,
+    KN_STATE_TAG_LIST(KN_STATE_TAG_ENUM_ENTRY)
+#undef KN_STATE_TAG_ENUM_ENTRY
+    Count
+};
+#pragma endregion 상태 태그 인덱스
+
+#pragma region 상태 태그 비트셋
+/**
+ * @struct FKNStateTagBits
+ * @brief  상태 태그 보유 여부를 1비트씩 저장하는 고정 크기 비트셋입니다.
+ *
+ * @details
+ * - 비트는 태그의 명시적(Explicit) 보유 여부를 의미합니다. State 태그는 모두 말단 태그이므로
+ *   HasMatchingGameplayTag 결과와 같습니다.
+ * - 태그 → 인덱스 변환(ToIndex)은 태그 카운트가 0 ↔ 1 이상으로 바뀔 때만 호출되는 콜드 패스입니다.
+ */
+struct KATANANEON_API FKNStateTagBits
+{
+    /** @brief 추적하는 상태 태그 개수 */
+    static constexpr int32 Num = static_cast<int32>(EKNStateTag::Count);
+    static_assert(Num <= 64, "KN_STATE_TAG_LIST 항목이 비트셋 크기(64)를 초과했습니다.");
+
+    /** @brief 비트가 켜져 있는지 검사합니다. */
+    bool Has(EKNStateTag Tag) const
+    {
+        return (Bits & Mask(Tag)) != 0;
+    }
+
+    /** @brief 비트를 켜거나 끕니다. */
+    void Set(EKNStateTag Tag, bool bValue)
+    {
+        Bits = bValue ? (Bits | Mask(Tag)) : (Bits & ~Mask(Tag));
+    }
+
+    /** @brief 모든 비트를 끕니다. */
+    void Reset() { Bits = 0; }
+
+    /**
+     * @brief 네이티브 태그에 대응하는 비트 인덱스를 반환합니다.
+     * @param Tag 검사할 태그
+     * @return 비트 인덱스, 추적 대상이 아니면 EKNStateTag::Count
+     */
+    static EKNStateTag ToIndex(const FGameplayTag& Tag);
+
+    /**
+     * @brief 비트 인덱스에 대응하는 네이티브 태그를 반환합니다.
+     * @param Index 비트 인덱스 (Count 미만)
+     * @return KatanaNeon::State 태그
+     */
+    static FGameplayTag GetTag(EKNStateTag Index);
+
+private:
+    static uint64 Mask(EKNStateTag Tag)
+    {
+        return uint64(1) << static_cast<uint32>(Tag);
+    }
+
+    uint64 Bits = 0;
+};
+#pragma endregion 상태 태그 비트셋
@@ -52,6 +52,15 @@ namespace KatanaNeon
             KATANANEON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(AttackSpeed)
         }
 
+        namespace Damage
+        {
+            // ── 데미지 파이프라인 (UKNDamageExecution SetByCaller) ──
+            /** @brief 배율 적용 전 기본 데미지 (양수) */
+            KATANANEON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Base)
+            /** @brief 공격자 측 누적 데미지 배율 (콤보 × 전술 × 시간 정지 등) */
+            KATANANEON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Multiplier)
+        }
+
         namespace Actor
         {
             /**
@@ -258,4 +267,33 @@ namespace KatanaNeon
         }
     }
 #pragma endregion 어빌리티 실행 태그 선언
-}
\ No newline at end of file
+}
+
+#pragma region 상태 태그 목록 (X-매크로)
+/**
+ * @brief ASC 비트셋 미러(FKNStateTagBits)가 추적하는 KatanaNeon::State 네이티브 태그 목록입니다.
+ * @details 각 항목은 X(비트 이름, 네이티브 태그) 쌍입니다.
+ * 위 State 네임스페이스에 태그를 추가하면 이 목록에도 한 줄을 추가해야 비트 조회가 가능합니다.
+ * 목록 순서가 곧 EKNStateTag 비트 인덱스입니다.
+ */
+#define KN_STATE_TAG_LIST(X) \
+    X(DoubleJumped,       KatanaNeon::State::Movement::DoubleJumped) \
+    X(Sprinting,          KatanaNeon::State::Movement::Sprinting) \
+    X(OverclockLv1,       KatanaNeon::State::Overclock::Lv1) \
+    X(OverclockLv2,       KatanaNeon::State::Overclock::Lv2) \
+    X(OverclockLv3,       KatanaNeon::State::Overclock::Lv3) \
+    X(Invincible,         KatanaNeon::State::Combat::Invincible) \
+    X(FlurryRush,         KatanaNeon::State::Combat::FlurryRush) \
+    X(Parrying,           KatanaNeon::State::Combat::Parrying) \
+    X(WeaponDrawn,        KatanaNeon::State::Combat::WeaponDrawn) \
+    X(ChronosActive,      KatanaNeon::State::Combat::ChronosActive) \
+    X(Groggy,             KatanaNeon::State::Combat::Groggy) \
+    X(StaminaImmune,      KatanaNeon::State::Combat::StaminaImmune) \
+    X(OverclockTactical,  KatanaNeon::State::Combat::OverclockTactical) \
+    X(WorldTimeFrozen,    KatanaNeon::State::Combat::WorldTimeFrozen) \
+    X(Dashing,            KatanaNeon::State::Combat::Dashing) \
+    X(ComboStep1,         KatanaNeon::State::Combat::Combo::Step1) \
+    X(ComboStep2,         KatanaNeon::State::Combat::Combo::Step2) \
+    X(ComboStep3,         KatanaNeon::State::Combat::Combo::Step3) \
+    X(ChronosSkillActive, KatanaNeon::State::Chronos::Active)
+#pragma endregion 상태 태그 목록 (X-매크로)
@@ -0,0 +1,219 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/Tasks/AbilityTask.h"
+#include "WorldCollision.h"
+#include "KNAbilityTask_BladeSweep.generated.h"
+
+#pragma region 전방 선언
+class UAnimMontage;
+class UAnimInstance;
+class UStaticMeshComponent;
+#pragma endregion 전방 선언
+
+#pragma region 델리게이트 선언
+/**
+ * @brief 스윙 중 새로운 액터가 칼날에 처음 적중했을 때 브로드캐스트됩니다.
+ * @param Hit 최초 적중 시점의 히트 결과
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FKNBladeSweepHitDelegate, const FHitResult&, Hit);
+
+/**
+ * @brief 판정 구간이 처음 열린 프레임에 브로드캐스트됩니다.
+ * @param BladeRoot 칼날 시작점(코등이) 월드 위치
+ * @param BladeTip  칼날 끝점 월드 위치
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FKNBladeSweepWindowDelegate, FVector, BladeRoot, FVector, BladeTip);
+#pragma endregion 델리게이트 선언
+
+/**
+ * @file    KNAbilityTask_BladeSweep.h
+ * @class   UKNAbilityTask_BladeSweep
+ * @brief   몽타주의 정규화 판정 구간 동안 칼날 선분을 연속 스윕하는 틱 기반 어빌리티 태스크입니다.
+ *
+ * @details
+ * [연속 판정 흐름]
+ * 0. 활성화 시점의 무기 포즈와 재생 위치를 보간 기준점으로 기록합니다.
+ * 1. 매 틱마다 몽타주 재생 위치를 정규화 시간(0~1)으로 환산합니다.
+ *    섹션 이름이 주어지면 몽타주 전체가 아닌 해당 섹션 구간 기준으로 환산합니다. (단일 몽타주 섹션 콤보)
+ * 2. 직전 프레임의 무기 트랜스폼과 현재 트랜스폼 사이를 서브스텝으로 보간합니다. (회전은 Slerp)
+ * 3. 서브스텝마다 Root → Tip 칼날 선분을 구체 스윕하여 두 프레임 사이를 빈틈없이 훑습니다.
+ * 4. [Start, End] 경계를 걸친 프레임은 구간 안쪽 비율만큼만 보간하여 프레임레이트와 무관하게 판정합니다.
+ *
+ * [최적화]
+ * - 서브스텝 수 = 칼끝 이동 거리 / SubStepDistance, 단 MaxSubStepsPerFrame 으로 상한을 둡니다.
+ * - 소켓 로컬 위치는 활성화 시 1회만 캐싱합니다. (스태틱 메시 소켓은 불변)
+ * - 적중 중복 제거는 태스크(= 한 번의 스윙) 단위로 유지됩니다.
+ * - 비동기 모드에서는 AsyncSweepByChannel로 쿼리를 예약만 하고, 결과는 다음 프레임 시작 시
+ *   트레이스 델리게이트로 받습니다. (게임 스레드 비차단, 적중 지연 최대 1프레임)
+ *   판정 구간이 끝나도 태스크를 1틱 늦게 종료하여 마지막 프레임의 결과를 놓치지 않습니다.
+ */
+UCLASS()
+class KATANANEON_API UKNAbilityTask_BladeSweep : public UAbilityTask
+{
+	GENERATED_BODY()
+
+#pragma region 기본 생성자 및 팩토리
+public:
+    /** @brief 틱 태스크로 설정합니다. */
+    UKNAbilityTask_BladeSweep(const FObjectInitializer& ObjectInitializer);
+
+    /**
+     * @brief 스윙 1회분의 칼날 스윕 태스크를 생성합니다.
+     * @param OwningAbility       소유 어빌리티
+     * @param InMontage           판정 구간의 기준이 되는 몽타주
+     * @param InWeaponMesh        소켓을 보유한 무기 스태틱 메시
+     * @param InRootSocket        칼날 시작점 소켓 이름
+     * @param InTipSocket         칼날 끝점 소켓 이름
+     * @param InStartNormTime     판정 시작 정규화 시간 (0~1)
+     * @param InEndNormTime       판정 종료 정규화 시간 (0~1)
+     * @param InSweepRadius       칼날 두께 (구체 반경, cm)
+     * @param InSubStepDistance   서브스텝 1회당 허용되는 칼끝 최대 이동 거리 (cm)
+     * @param InMaxSubStepsPerFrame 프레임당 최대 서브스텝 수 (비용 상한)
+     * @param InSectionName       정규화 기준 섹션 (NAME_None = 몽타주 전체)
+     * @param bInAsyncQueries     true면 비동기 스윕으로 판정합니다. (적중 지연 최대 1프레임)
+     * @return 생성된 태스크
+     */
+    static UKNAbilityTask_BladeSweep* CreateBladeSweepTask(
+        UGameplayAbility* OwningAbility,
+        UAnimMontage* InMontage,
+        UStaticMeshComponent* InWeaponMesh,
+        FName InRootSocket,
+        FName InTipSocket,
+        float InStartNormTime,
+        float InEndNormTime,
+        float InSweepRadius,
+        float InSubStepDistance,
+        int32 InMaxSubStepsPerFrame,
+        FName InSectionName = NAME_None,
+        bool bInAsyncQueries = false);
+#pragma endregion 기본 생성자 및 팩토리
+
+#pragma region 델리게이트
+public:
+    /** @brief 새로운 액터 최초 적중 이벤트 */
+    UPROPERTY(BlueprintAssignable)
+    FKNBladeSweepHitDelegate OnBladeHit;
+
+    /** @brief 판정 구간 진입 이벤트 (스윙당 1회) */
+    UPROPERTY(BlueprintAssignable)
+    FKNBladeSweepWindowDelegate OnWindowOpened;
+#pragma endregion 델리게이트
+
+#pragma region 태스크 오버라이드
+protected:
+    virtual void Activate() override;
+    virtual void TickTask(float DeltaTime) override;
+    virtual void OnDestroy(bool bInOwnerFinished) override;
+#pragma endregion 태스크 오버라이드
+
+#pragma region 런타임 상태
+private:
+    /** @brief 판정 기준 몽타주 */
+    UPROPERTY()
+    TObjectPtr<UAnimMontage> Montage = nullptr;
+
+    /** @brief 소켓을 보유한 무기 메시 */
+    TWeakObjectPtr<UStaticMeshComponent> WeaponMesh = nullptr;
+
+    /** @brief 몽타주를 재생 중인 애님 인스턴스 캐시 */
+    TWeakObjectPtr<UAnimInstance> AnimInstance = nullptr;
+
+    FName RootSocket = NAME_None;
+    FName TipSocket = NAME_None;
+
+    /** @brief 정규화 기준 섹션 이름 (NAME_None = 몽타주 전체) */
+    FName SectionName = NAME_None;
+
+    /** @brief 기준 구간 시작 시간 (초, 활성화 시 캐싱) */
+    float RangeStartTime = 0.0f;
+
+    /** @brief 기준 구간 길이 (초, 활성화 시 캐싱) */
+    float RangeLength = 0.0f;
+
+    float StartNormTime = 0.0f;
+    float EndNormTime = 1.0f;
+    float SweepRadius = 8.0f;
+    float SubStepDistance = 16.0f;
+    int32 MaxSubStepsPerFrame = 4;
+
+    /** @brief 무기 컴포넌트 공간 기준 칼날 시작점 (활성화 시 캐싱) */
+    FVector LocalRoot = FVector::ZeroVector;
+
+    /** @brief 무기 컴포넌트 공간 기준 칼날 끝점 (활성화 시 캐싱) */
+    FVector LocalTip = FVector::ZeroVector;
+
+    /** @brief 직전 틱의 무기 월드 트랜스폼 */
+    FTransform PrevWeaponTransform = FTransform::Identity;
+
+    /** @brief 직전 틱의 정규화 재생 시간 (음수 = 미기록) */
+    float PrevNormTime = -1.0f;
+
+    /** @brief 직전 포즈를 이미 스윕했는지 여부 (활성화·되감기 기준점은 false) */
+    bool bPrevPoseSwept = false;
+
+    /** @brief 판정 구간 진입 이벤트 송신 여부 */
+    bool bWindowOpened = false;
+
+    /** @brief 이번 스윙에서 이미 적중한 액터 (스윙 단위 중복 제거) */
+    TSet<TWeakObjectPtr<AActor>> SwingHitActors;
+
+    /** @brief 스윕 결과 재사용 버퍼 (프레임마다 재할당 방지) */
+    TArray<FHitResult> HitBuffer;
+
+    /** @brief 비동기 스윕 사용 여부 */
+    bool bAsyncQueries = false;
+
+    /** @brief 판정 구간이 끝나 다음 틱에 종료 대기 중인지 여부 (비동기 결과 수신용) */
+    bool bSweepWindowDone = false;
+
+    /** @brief 비동기 스윕 완료 델리게이트 (활성화 시 1회 바인딩) */
+    FTraceDelegate AsyncSweepDelegate;
+#pragma endregion 런타임 상태
+
+#pragma region 내부 헬퍼 함수
+private:
+    /**
+     * @brief 현재 몽타주 재생 위치를 기준 구간(섹션 또는 전체) 정규화 시간으로 반환합니다.
+     * @return 0~1 정규화 시간, 몽타주가 재생 중이 아니거나 구간 이전으로 되돌아가면 음수
+     */
+    float GetMontageNormTime() const;
+
+    /**
+     * @brief 두 무기 트랜스폼 사이의 [AlphaFrom, AlphaTo] 구간을 서브스텝 스윕합니다.
+     * @param From      직전 무기 트랜스폼
+     * @param To        현재 무기 트랜스폼
+     * @param AlphaFrom 보간 시작 비율 (0~1)
+     * @param AlphaTo   보간 종료 비율 (0~1)
+     */
+    void SweepInterpolated(const FTransform& From, const FTransform& To, float AlphaFrom, float AlphaTo);
+
+    /**
+     * @brief 단일 칼날 선분을 구체 스윕하고 신규 적중 액터를 브로드캐스트합니다.
+     * @param Root   칼날 시작점
+     * @param Tip    칼날 끝점
+     * @param Params 시전자 제외가 적용된 쿼리 파라미터
+     */
+    void SweepSegment(const FVector& Root, const FVector& Tip, const FCollisionQueryParams& Params);
+
+    /**
+     * @brief 스윕 결과에서 이번 스윙 최초 적중 액터만 브로드캐스트합니다.
+     * @param Hits 스윕 결과 (동기 버퍼 또는 비동기 결과)
+     */
+    void ProcessSweepHits(TConstArrayView<FHitResult> Hits);
+
+    /**
+     * @brief 판정 구간 종료 처리 — 비동기 모드면 결과 수신을 위해 1틱 뒤에 종료합니다.
+     */
+    void FinishSweepWindow();
+
+    /**
+     * @brief 비동기 스윕 결과 수신 콜백 (다음 프레임 시작 시 게임 스레드에서 호출)
+     * @param TraceHandle 트레이스 핸들
+     * @param TraceDatum  스윕 요청 및 결과
+     */
+    void OnAsyncSweepCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+#pragma endregion 내부 헬퍼 함수
+};
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Data/Structs/KNPlayerStatTable.h"
+#include "Framework/System/KNPooledActorInterface.h"
 #include "KNSlashProjectile.generated.h"
 
 #pragma region 전방 선언
@@ -30,9 +31,13 @@ class UGameplayEffect;
  * Lifespan을 계산하여 엔진이 비용 0으로 자동 소멸시키도록 설계했습니다.
  * 2. O(1) 피격 판정: FindComponentByClass를 배제하고 IAbilitySystemInterface를 통해
  * 적의 ASC를 즉시 가져옵니다.
+ * 3. 액터 풀 재사용: UKNActorPoolSubsystem에서 꺼내 쓰고, 피격·수명 만료 시 Destroy 대신 반납합니다.
+ *
+ * [풀 수명주기]
+ * AcquireDeferred → SetPayload(발사 데이터 주입) → FinishAcquire(OnAcquiredFromPool) → ReleaseActor(OnReleasedToPool)
  */
 UCLASS()
-class KATANANEON_API AKNSlashProjectile : public AActor
+class KATANANEON_API AKNSlashProjectile : public AActor, public IKNPooledActor
 {
     GENERATED_BODY()
 
@@ -45,25 +50,36 @@ public:
     AKNSlashProjectile();
 
 protected:
-    virtual void BeginPlay() override;
+    /** @brief 수명 만료 시 Destroy 대신 풀로 반납합니다. */
+    virtual void LifeSpanExpired() override;
 #pragma endregion 기본 생성자 및 초기화
 
 #pragma region 발사 초기화 인터페이스
 public:
     /**
-     * @brief 발사체를 초기화합니다. 지연 스폰(Deferred Spawn) 직후 수동으로 호출됩니다.
+     * @brief 발사 데이터를 주입합니다. AcquireDeferred와 FinishAcquire 사이에 호출됩니다.
+     * @details 컴포넌트 적용은 OnAcquiredFromPool에서 이루어집니다.
      * @param InInstigatorASC  발사한 플레이어의 AbilitySystemComponent
      * @param InDamageGEClass  피격 시 적용할 데미지 Instant GE 클래스
      * @param InGrogyGEClass   피격 시 적용할 그로기 Duration GE 클래스
      * @param InRow            DT_OverclockLv2Setting 에서 로드한 수치 행
      */
-    void InitProjectile(
+    void SetPayload(
         UAbilitySystemComponent* InInstigatorASC,
         TSubclassOf<UGameplayEffect>  InDamageGEClass,
         TSubclassOf<UGameplayEffect>  InGrogyGEClass,
         const FKNOverclockLv2Row& InRow);
 #pragma endregion 발사 초기화 인터페이스
 
+#pragma region 액터 풀 수명주기
+public:
+    /** @brief 충돌 크기·속도·수명·이펙트를 주입된 데이터로 적용하고 Hit 콜백을 연결합니다. */
+    virtual void OnAcquiredFromPool_Implementation() override;
+
+    /** @brief Hit 콜백 해제, 이동 정지, 이펙트 즉시 정지 및 발사별 상태를 초기화합니다. */
+    virtual void OnReleasedToPool_Implementation() override;
+#pragma endregion 액터 풀 수명주기
+
 #pragma region 에디터 설정 데이터
 protected:
     /** @brief 발사체 Box Collision — 충돌 판정 */
@@ -111,7 +127,7 @@ private:
         const FHitResult& Hit);
 
     /**
-     * @brief 피격 처리 공통 로직 — 데미지 GE + 그로기 태그를 대상에게 적용합니다.
+     * @brief 피격 처리 공통 로직 — 데미지는 피격 큐에 등록하고, 그로기 GE는 즉시 적용합니다.
      * @param TargetActor 피격 대상 Actor
      */
     void ProcessHit(AActor* TargetActor);
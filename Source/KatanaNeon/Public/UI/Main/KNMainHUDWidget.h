@@ -31,6 +31,12 @@ class KATANANEON_API UKNMainHUDWidget : public UKNUserWidgetBase
 #pragma region 위젯 생명주기 오버라이드
 protected:
     virtual void NativeConstruct() override;
+
+    /**
+     * @brief 스태미나 회복 / 크로노스 소모 / 오버클럭 감소 구간에서만 해석적 값으로 게이지를 보간합니다.
+     * @details 회복분과 소모분은 어트리뷰트에 이산 시점에만 확정되므로, 델리게이트만으로는 바가 움직이지 않습니다.
+     */
+    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 #pragma endregion 위젯 생명주기 오버라이드
 
 #pragma region 외부 제어 인터페이스
@@ -149,6 +155,21 @@ private:
     void OnWeaponStateChangedCallback(bool bIsDrawn);
 #pragma endregion 내부 콜백 함수
 
+#pragma region 게이지 보간 상태
+private:
+    /** @brief 해석적 스태미나/크로노스 조회 대상 (InitHUD에서 설정) */
+    TWeakObjectPtr<UKNStatsComponent> StatsComponent;
+
+    /** @brief 마지막으로 전달받은 최대 스태미나 */
+    float CachedMaxStamina = 0.0f;
+
+    /** @brief 마지막으로 전달받은 최대 크로노스 */
+    float CachedMaxChronos = 0.0f;
+
+    /** @brief 마지막으로 전달받은 최대 오버클럭 포인트 */
+    float CachedMaxOverclockPoint = 0.0f;
+#pragma endregion 게이지 보간 상태
+
 #pragma region UMG 바인딩 스탯 바
 protected:
     /** @brief 플레이어 체력 바 (WBP_HealthBar) */